@@ -0,0 +1,146 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "bench_data_generator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+const std::size_t   bench_data_generator::DEFAULT_DIMENSION     = 2;
+const std::size_t   bench_data_generator::HIGH_DIMENSION        = 64;
+const double        bench_data_generator::SPACE_SIZE            = 100.0;
+const double        bench_data_generator::CLUSTER_DEVIATION     = 1.5;
+
+
+bench_data_generator::bench_data_generator(const std::size_t p_seed) :
+    m_generator(static_cast<std::mt19937::result_type>(p_seed))
+{ }
+
+
+std::shared_ptr<dataset> bench_data_generator::generate(const bench_data_type p_type, const std::size_t p_size, const std::size_t p_amount_clusters) const {
+    std::shared_ptr<dataset> data = std::make_shared<dataset>();
+    data->reserve(p_size);
+
+    switch (p_type) {
+    case bench_data_type::GAUSSIAN_BLOBS:
+        generate_blobs(p_size, p_amount_clusters, DEFAULT_DIMENSION, *data);
+        break;
+
+    case bench_data_type::ANISOTROPIC:
+        generate_blobs(p_size, p_amount_clusters, DEFAULT_DIMENSION, *data);
+        stretch(*data);
+        break;
+
+    case bench_data_type::UNIFORM_NOISE:
+        generate_noise(p_size, DEFAULT_DIMENSION, *data);
+        break;
+
+    case bench_data_type::HIGH_DIMENSIONAL:
+        generate_blobs(p_size, p_amount_clusters, HIGH_DIMENSION, *data);
+        break;
+
+    default:
+        throw std::invalid_argument("Unknown type of benchmark data is specified");
+    }
+
+    return data;
+}
+
+
+std::string bench_data_generator::to_string(const bench_data_type p_type) {
+    switch (p_type) {
+    case bench_data_type::GAUSSIAN_BLOBS:   return "blobs";
+    case bench_data_type::ANISOTROPIC:      return "anisotropic";
+    case bench_data_type::UNIFORM_NOISE:    return "noise";
+    case bench_data_type::HIGH_DIMENSIONAL: return "high-dimensional";
+    default:
+        throw std::invalid_argument("Unknown type of benchmark data is specified");
+    }
+}
+
+
+bench_data_type bench_data_generator::from_string(const std::string & p_name) {
+    for (const auto type : { bench_data_type::GAUSSIAN_BLOBS, bench_data_type::ANISOTROPIC, bench_data_type::UNIFORM_NOISE, bench_data_type::HIGH_DIMENSIONAL }) {
+        if (to_string(type) == p_name) {
+            return type;
+        }
+    }
+
+    throw std::invalid_argument("Unknown type of benchmark data '" + p_name + "' is specified");
+}
+
+
+void bench_data_generator::generate_blobs(const std::size_t p_size, const std::size_t p_amount_clusters, const std::size_t p_dimension, dataset & p_data) const {
+    const std::size_t amount_clusters = std::max(p_amount_clusters, std::size_t(1));
+
+    std::uniform_real_distribution<double> center_distribution(0.0, SPACE_SIZE);
+    std::normal_distribution<double> point_distribution(0.0, CLUSTER_DEVIATION);
+
+    dataset centers(amount_clusters, point(p_dimension));
+    for (auto & center : centers) {
+        for (auto & coordinate : center) {
+            coordinate = center_distribution(m_generator);
+        }
+    }
+
+    for (std::size_t index = 0; index < p_size; index++) {
+        const point & center = centers[index % amount_clusters];
+
+        point value(p_dimension);
+        for (std::size_t dimension = 0; dimension < p_dimension; dimension++) {
+            value[dimension] = center[dimension] + point_distribution(m_generator);
+        }
+
+        p_data.push_back(std::move(value));
+    }
+
+    std::shuffle(p_data.begin(), p_data.end(), m_generator);
+}
+
+
+void bench_data_generator::generate_noise(const std::size_t p_size, const std::size_t p_dimension, dataset & p_data) const {
+    std::uniform_real_distribution<double> distribution(0.0, SPACE_SIZE);
+
+    for (std::size_t index = 0; index < p_size; index++) {
+        point value(p_dimension);
+        for (auto & coordinate : value) {
+            coordinate = distribution(m_generator);
+        }
+
+        p_data.push_back(std::move(value));
+    }
+}
+
+
+void bench_data_generator::stretch(dataset & p_data) const {
+    /* each pair of coordinates is transformed by the same shear matrix, clusters become elongated ellipses */
+    const double transformation[2][2] = { { 0.6, -0.6 }, { -0.4, 0.9 } };
+
+    for (auto & value : p_data) {
+        for (std::size_t dimension = 0; dimension + 1 < value.size(); dimension += 2) {
+            const double x = value[dimension];
+            const double y = value[dimension + 1];
+
+            value[dimension]     = transformation[0][0] * x + transformation[0][1] * y;
+            value[dimension + 1] = transformation[1][0] * x + transformation[1][1] * y;
+        }
+    }
+}
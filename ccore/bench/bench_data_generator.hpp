@@ -0,0 +1,98 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "definitions.hpp"
+
+
+/**
+*
+* @brief   Types of synthetic datasets that are used by the benchmark suite.
+*
+*/
+enum class bench_data_type {
+    GAUSSIAN_BLOBS,     /* isotropic gaussian clusters in 2-dimensional space */
+    ANISOTROPIC,        /* gaussian clusters that are stretched by linear transformation */
+    UNIFORM_NOISE,      /* points that are uniformly distributed without cluster structure */
+    HIGH_DIMENSIONAL,   /* isotropic gaussian clusters in high-dimensional space */
+};
+
+
+/**
+*
+* @brief   Generator of reproducible synthetic datasets for benchmarks.
+* @details Points of clusters are shuffled, therefore any prefix of the dataset (for example, initial centers
+*           that are taken from the beginning) represents all clusters.
+*
+*/
+class bench_data_generator {
+public:
+    const static std::size_t    DEFAULT_DIMENSION;
+    const static std::size_t    HIGH_DIMENSION;
+    const static double         SPACE_SIZE;
+    const static double         CLUSTER_DEVIATION;
+
+private:
+    mutable std::mt19937    m_generator;
+
+public:
+    /**
+    *
+    * @brief   Creates generator with the specified seed, generators with the same seed produce the same data.
+    *
+    */
+    explicit bench_data_generator(const std::size_t p_seed);
+
+public:
+    /**
+    *
+    * @brief   Generates dataset.
+    *
+    * @param[in] p_type: type of the dataset.
+    * @param[in] p_size: amount of points.
+    * @param[in] p_amount_clusters: amount of clusters, it is ignored for uniform noise.
+    *
+    */
+    std::shared_ptr<dataset> generate(const bench_data_type p_type, const std::size_t p_size, const std::size_t p_amount_clusters) const;
+
+public:
+    static std::string to_string(const bench_data_type p_type);
+
+    /**
+    *
+    * @brief   Converts name of dataset type to the type, throws 'std::invalid_argument' if the name is unknown.
+    *
+    */
+    static bench_data_type from_string(const std::string & p_name);
+
+private:
+    void generate_blobs(const std::size_t p_size, const std::size_t p_amount_clusters, const std::size_t p_dimension, dataset & p_data) const;
+
+    void generate_noise(const std::size_t p_size, const std::size_t p_dimension, dataset & p_data) const;
+
+    void stretch(dataset & p_data) const;
+};
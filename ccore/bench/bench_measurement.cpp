@@ -0,0 +1,101 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "bench_measurement.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+
+bench_timer::bench_timer(void) :
+    m_start(clock::now())
+{ }
+
+
+void bench_timer::restart(void) {
+    m_start = clock::now();
+}
+
+
+double bench_timer::elapsed(void) const {
+    return std::chrono::duration<double>(clock::now() - m_start).count();
+}
+
+
+bool bench_memory::reset_peak(void) {
+#if defined(__linux__)
+    std::ofstream stream("/proc/self/clear_refs");
+    if (!stream.is_open()) {
+        return false;
+    }
+
+    stream << "5";  /* resets peak resident set size (VmHWM) to the current value */
+    stream.flush();
+    return stream.good();
+#else
+    return false;
+#endif
+}
+
+
+std::size_t bench_memory::get_peak_kb(void) {
+    const std::size_t peak = read_status_value("VmHWM:");
+    if (peak != 0) {
+        return peak;
+    }
+
+#if defined(__unix__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<std::size_t>(usage.ru_maxrss);
+    }
+#endif
+
+    return 0;
+}
+
+
+std::size_t bench_memory::get_current_kb(void) {
+    return read_status_value("VmRSS:");
+}
+
+
+std::size_t bench_memory::read_status_value(const char * p_name) {
+    std::ifstream stream("/proc/self/status");
+
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.compare(0, std::strlen(p_name), p_name) == 0) {
+            std::istringstream value(line.substr(std::strlen(p_name)));
+
+            std::size_t result = 0;
+            value >> result;
+            return result;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <chrono>
+#include <cstddef>
+
+
+/**
+*
+* @brief   Stopwatch that is used to measure execution time of benchmark cases.
+*
+*/
+class bench_timer {
+private:
+    using clock = std::chrono::steady_clock;
+
+private:
+    clock::time_point   m_start;
+
+public:
+    bench_timer(void);
+
+public:
+    void restart(void);
+
+    /**
+    *
+    * @brief   Returns time in seconds that has passed since creation or the last restart.
+    *
+    */
+    double elapsed(void) const;
+};
+
+
+/**
+*
+* @brief   Provides resident set size of the current process.
+* @details Peak value can be reset only on Linux (using '/proc/self/clear_refs'), on other systems the peak value
+*           is the maximum for the whole lifetime of the process.
+*
+*/
+class bench_memory {
+public:
+    /**
+    *
+    * @brief   Resets peak resident set size to the current one, returns 'false' if it is not supported.
+    *
+    */
+    static bool reset_peak(void);
+
+    /**
+    *
+    * @brief   Returns peak resident set size in kilobytes or 0 if it cannot be obtained.
+    *
+    */
+    static std::size_t get_peak_kb(void);
+
+    /**
+    *
+    * @brief   Returns current resident set size in kilobytes or 0 if it cannot be obtained.
+    *
+    */
+    static std::size_t get_current_kb(void);
+
+private:
+    static std::size_t read_status_value(const char * p_name);
+};
@@ -0,0 +1,88 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "bench_report.hpp"
+
+#include <iomanip>
+
+
+double bench_result::get_throughput(void) const {
+    return (m_min_time > 0.0) ? static_cast<double>(m_size) / m_min_time : 0.0;
+}
+
+
+void bench_report::append(const bench_result & p_result) {
+    m_results.push_back(p_result);
+}
+
+
+const std::vector<bench_result> & bench_report::get_results(void) const {
+    return m_results;
+}
+
+
+void bench_report::write_json(std::ostream & p_stream) const {
+    p_stream << "[";
+    for (std::size_t index = 0; index < m_results.size(); index++) {
+        p_stream << ((index == 0) ? "\n  " : ",\n  ");
+        write_json(m_results[index], p_stream);
+    }
+
+    p_stream << "\n]\n";
+}
+
+
+void bench_report::write_json(const bench_result & p_result, std::ostream & p_stream) {
+    const std::ios_base::fmtflags flags = p_stream.flags();
+    const std::streamsize precision = p_stream.precision();
+
+    p_stream << std::setprecision(9)
+             << "{\"algorithm\": \"" << escape(p_result.m_algorithm) << "\""
+             << ", \"dataset\": \"" << escape(p_result.m_dataset) << "\""
+             << ", \"size\": " << p_result.m_size
+             << ", \"dimension\": " << p_result.m_dimension
+             << ", \"threads\": " << p_result.m_threads
+             << ", \"repeat\": " << p_result.m_repeat
+             << ", \"time_seconds\": " << p_result.m_min_time
+             << ", \"mean_time_seconds\": " << p_result.m_mean_time
+             << ", \"throughput_points_per_second\": " << p_result.get_throughput()
+             << ", \"baseline_rss_kb\": " << p_result.m_baseline_rss
+             << ", \"peak_rss_kb\": " << p_result.m_peak_rss
+             << "}";
+
+    p_stream.flags(flags);
+    p_stream.precision(precision);
+}
+
+
+std::string bench_report::escape(const std::string & p_value) {
+    std::string result;
+    result.reserve(p_value.size());
+
+    for (const char symbol : p_value) {
+        if ((symbol == '"') || (symbol == '\\')) {
+            result.push_back('\\');
+        }
+
+        result.push_back(symbol);
+    }
+
+    return result;
+}
@@ -0,0 +1,87 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/**
+*
+* @brief   Result of a benchmark case for a dataset of the specific size.
+*
+*/
+struct bench_result {
+    std::string     m_algorithm;
+    std::string     m_dataset;
+    std::size_t     m_size              = 0;
+    std::size_t     m_dimension         = 0;
+    std::size_t     m_threads           = 0;
+    std::size_t     m_repeat            = 0;
+    double          m_min_time          = 0.0;    /* seconds */
+    double          m_mean_time         = 0.0;    /* seconds */
+    std::size_t     m_baseline_rss      = 0;      /* kilobytes, resident set size before the first run */
+    std::size_t     m_peak_rss          = 0;      /* kilobytes, peak resident set size during runs */
+
+public:
+    /**
+    *
+    * @brief   Returns amount of points that are processed per second using the best time.
+    *
+    */
+    double get_throughput(void) const;
+};
+
+
+/**
+*
+* @brief   Writes results of benchmarks in JSON format.
+*
+*/
+class bench_report {
+private:
+    std::vector<bench_result>   m_results;
+
+public:
+    void append(const bench_result & p_result);
+
+    const std::vector<bench_result> & get_results(void) const;
+
+    /**
+    *
+    * @brief   Writes all results as JSON array of objects, each object describes one result.
+    *
+    */
+    void write_json(std::ostream & p_stream) const;
+
+    /**
+    *
+    * @brief   Writes one result as JSON object.
+    *
+    */
+    static void write_json(const bench_result & p_result, std::ostream & p_stream);
+
+private:
+    static std::string escape(const std::string & p_value);
+};
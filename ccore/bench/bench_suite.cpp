@@ -0,0 +1,163 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "bench_suite.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "bench_data_generator.hpp"
+
+#include "cluster/agglomerative.hpp"
+#include "cluster/cure.hpp"
+#include "cluster/dbscan.hpp"
+#include "cluster/kmeans.hpp"
+#include "cluster/kmedoids.hpp"
+#include "cluster/optics.hpp"
+#include "cluster/rock.hpp"
+#include "cluster/syncnet.hpp"
+#include "cluster/xmeans.hpp"
+
+#include "nnet/pcnn.hpp"
+#include "nnet/som.hpp"
+
+
+using namespace ccore::clst;
+using namespace ccore::nnet;
+
+
+const std::size_t   bench_suite::AMOUNT_NEIGHBORS   = 20;
+const double        bench_suite::TOLERANCE          = 0.001;
+
+
+const std::vector<bench_case> & bench_suite::get_cases(void) {
+    static const std::vector<bench_case> cases = create_cases();
+    return cases;
+}
+
+
+const bench_case & bench_suite::get_case(const std::string & p_name) {
+    for (const auto & current_case : get_cases()) {
+        if (current_case.m_name == p_name) {
+            return current_case;
+        }
+    }
+
+    throw std::invalid_argument("Benchmark for algorithm '" + p_name + "' does not exist");
+}
+
+
+std::vector<bench_case> bench_suite::create_cases(void) {
+    std::vector<bench_case> cases;
+
+    cases.push_back({ "kmeans", 10000000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        kmeans_data result;
+        kmeans(get_initial_centers(p_data, p_amount_clusters), TOLERANCE).process(p_data, result);
+    } });
+
+    cases.push_back({ "kmedoids", 10000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        medoid_sequence medoids(p_amount_clusters);
+        for (std::size_t index = 0; index < medoids.size(); index++) {
+            medoids[index] = index;
+        }
+
+        kmedoids_data result;
+        kmedoids(medoids, TOLERANCE).process(p_data, result);
+    } });
+
+    cases.push_back({ "dbscan", 100000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        dbscan_data result;
+        dbscan(get_connectivity_radius(p_data, p_amount_clusters), AMOUNT_NEIGHBORS / 2).process(p_data, result);
+    } });
+
+    cases.push_back({ "optics", 100000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        optics_data result;
+        optics(get_connectivity_radius(p_data, p_amount_clusters), AMOUNT_NEIGHBORS / 2).process(p_data, result);
+    } });
+
+    cases.push_back({ "agglomerative", 1000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        agglomerative_data result;
+        agglomerative(p_amount_clusters, type_link::CENTROID_LINK).process(p_data, result);
+    } });
+
+    cases.push_back({ "cure", 10000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        cure_data result;
+        cure(p_amount_clusters, 5, 0.5).process(p_data, result);
+    } });
+
+    cases.push_back({ "rock", 1000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        rock_data result;
+        rock(get_connectivity_radius(p_data, p_amount_clusters), p_amount_clusters, 0.5).process(p_data, result);
+    } });
+
+    cases.push_back({ "xmeans", 1000000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        xmeans_data result;
+        xmeans(get_initial_centers(p_data, 2), 2 * p_amount_clusters, TOLERANCE, splitting_type::BAYESIAN_INFORMATION_CRITERION).process(p_data, result);
+    } });
+
+    cases.push_back({ "som", 1000000, [](const dataset & p_data, const std::size_t) {
+        som network(8, 8, som_conn_type::SOM_GRID_FOUR, som_parameters());
+        network.train(p_data, 10, false);
+    } });
+
+    cases.push_back({ "sync", 1000, [](const dataset & p_data, const std::size_t p_amount_clusters) {
+        dataset data = p_data;  /* network requires mutable data */
+
+        syncnet_analyser analyser;
+        syncnet(&data, get_connectivity_radius(p_data, p_amount_clusters), false, initial_type::EQUIPARTITION)
+            .process(0.995, solve_type::FORWARD_EULER, false, analyser);
+    } });
+
+    cases.push_back({ "pcnn", 10000, [](const dataset & p_data, const std::size_t) {
+        /* the first coordinate of points is used as a stimulus of oscillators */
+        const auto bounds = std::minmax_element(p_data.begin(), p_data.end(), [](const point & p_point1, const point & p_point2) {
+            return p_point1[0] < p_point2[0];
+        });
+
+        const double minimum = (*bounds.first)[0];
+        const double range = std::max((*bounds.second)[0] - minimum, 1e-12);
+
+        pcnn_stimulus stimulus(p_data.size());
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            stimulus[index] = (p_data[index][0] - minimum) / range;
+        }
+
+        pcnn_dynamic dynamic;
+        pcnn(p_data.size(), connection_t::CONNECTION_LIST_BIDIRECTIONAL, pcnn_parameters()).simulate(20, stimulus, dynamic);
+    } });
+
+    return cases;
+}
+
+
+double bench_suite::get_connectivity_radius(const dataset & p_data, const std::size_t p_amount_clusters) {
+    const double dimension = static_cast<double>(p_data.empty() ? 1 : p_data.front().size());
+    const double fraction = static_cast<double>(AMOUNT_NEIGHBORS * p_amount_clusters) / static_cast<double>(std::max(p_data.size(), std::size_t(1)));
+
+    /* radius of gaussian cluster is scaled by the share of its points that should be covered */
+    return bench_data_generator::CLUSTER_DEVIATION * std::sqrt(2.0 * dimension) * std::pow(std::min(fraction, 1.0), 1.0 / dimension);
+}
+
+
+dataset bench_suite::get_initial_centers(const dataset & p_data, const std::size_t p_amount) {
+    /* points of synthetic datasets are shuffled, therefore the first points belong to random clusters */
+    return dataset(p_data.begin(), p_data.begin() + std::min(p_amount, p_data.size()));
+}
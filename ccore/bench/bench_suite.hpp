@@ -0,0 +1,85 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "definitions.hpp"
+
+
+/**
+*
+* @brief   Benchmark case of an algorithm.
+* @details Size of datasets is limited for each algorithm in line with its complexity, for example, agglomerative
+*           algorithm has cubic complexity and a sweep up to millions of points would never finish.
+*
+*/
+struct bench_case {
+    using executor = std::function<void(const dataset &, const std::size_t)>;
+
+    std::string     m_name;
+    std::size_t     m_max_size  = 0;    /* the largest dataset that is processed by default */
+    executor        m_execute;          /* processes dataset that consists of the specified amount of clusters */
+};
+
+
+/**
+*
+* @brief   Collection of benchmark cases of all algorithms that are covered by the benchmark suite.
+*
+*/
+class bench_suite {
+public:
+    /**
+    *
+    * @brief   Expected amount of neighbors in the connectivity radius of density based algorithms.
+    *
+    */
+    const static std::size_t    AMOUNT_NEIGHBORS;
+
+    const static double         TOLERANCE;
+
+public:
+    static const std::vector<bench_case> & get_cases(void);
+
+    /**
+    *
+    * @brief   Returns case of the algorithm, throws 'std::invalid_argument' if the algorithm is not covered.
+    *
+    */
+    static const bench_case & get_case(const std::string & p_name);
+
+private:
+    static std::vector<bench_case> create_cases(void);
+
+    /**
+    *
+    * @brief   Returns connectivity radius that contains approximately 'AMOUNT_NEIGHBORS' points of a cluster.
+    *
+    */
+    static double get_connectivity_radius(const dataset & p_data, const std::size_t p_amount_clusters);
+
+    static dataset get_initial_centers(const dataset & p_data, const std::size_t p_amount);
+};
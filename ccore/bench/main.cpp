@@ -0,0 +1,258 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "bench_data_generator.hpp"
+#include "bench_measurement.hpp"
+#include "bench_report.hpp"
+#include "bench_suite.hpp"
+
+#include "parallel/execution_context.hpp"
+
+
+using namespace ccore::parallel;
+
+
+struct bench_options {
+    std::vector<std::string>        m_algorithms;
+    std::vector<bench_data_type>    m_datasets          = { bench_data_type::GAUSSIAN_BLOBS };
+    std::size_t                     m_min_size          = 1000;
+    std::size_t                     m_max_size          = 10000000;
+    std::size_t                     m_repeat            = 3;
+    std::size_t                     m_amount_clusters   = 10;
+    std::size_t                     m_seed              = 1000;
+    std::size_t                     m_threads           = 0;
+    bool                            m_no_limits         = false;
+    std::string                     m_output;
+};
+
+
+static void print_usage(void) {
+    std::cout << "Usage: benchcore.exe [options]\n"
+              << "  --algorithm <name,...>  algorithms that should be measured (default: all).\n"
+              << "  --dataset <type,...>    datasets: blobs, anisotropic, noise, high-dimensional or all (default: blobs).\n"
+              << "  --min-size <size>       size of the smallest dataset (default: 1000).\n"
+              << "  --max-size <size>       size of the largest dataset (default: 10000000).\n"
+              << "  --repeat <amount>       amount of runs for each dataset (default: 3).\n"
+              << "  --clusters <amount>     amount of clusters in datasets (default: 10).\n"
+              << "  --seed <value>          seed of the data generator (default: 1000).\n"
+              << "  --threads <amount>      amount of threads that are used by algorithms (default: all hardware threads).\n"
+              << "  --no-limits             ignore limits of dataset sizes of algorithms.\n"
+              << "  --output <file>         file for results in JSON format (default: standard output).\n"
+              << "  --list                  print names of algorithms.\n";
+}
+
+
+static std::vector<std::string> split(const std::string & p_value) {
+    std::vector<std::string> result;
+
+    std::size_t position = 0;
+    while (position <= p_value.size()) {
+        const std::size_t next = std::min(p_value.find(',', position), p_value.size());
+        if (next > position) {
+            result.push_back(p_value.substr(position, next - position));
+        }
+
+        position = next + 1;
+    }
+
+    return result;
+}
+
+
+static std::size_t parse_size(const std::string & p_value) {
+    /* scientific notation is allowed, for example, '1e6' */
+    const double value = std::stod(p_value);
+    if (value < 1.0) {
+        throw std::invalid_argument("Positive value is expected instead of '" + p_value + "'");
+    }
+
+    return static_cast<std::size_t>(value);
+}
+
+
+static bench_options parse_options(const int p_argc, char * p_argv[]) {
+    bench_options options;
+
+    for (int index = 1; index < p_argc; index++) {
+        const std::string argument = p_argv[index];
+        if (argument == "--no-limits") {
+            options.m_no_limits = true;
+            continue;
+        }
+
+        if (index + 1 >= p_argc) {
+            throw std::invalid_argument("Value of argument '" + argument + "' is not specified");
+        }
+
+        const std::string value = p_argv[++index];
+        if (argument == "--algorithm") {
+            options.m_algorithms = (value == "all") ? std::vector<std::string>() : split(value);
+        }
+        else if (argument == "--dataset") {
+            options.m_datasets.clear();
+
+            const std::vector<std::string> names = (value == "all") ?
+                std::vector<std::string>({ "blobs", "anisotropic", "noise", "high-dimensional" }) : split(value);
+
+            for (const auto & name : names) {
+                options.m_datasets.push_back(bench_data_generator::from_string(name));
+            }
+        }
+        else if (argument == "--min-size") {
+            options.m_min_size = parse_size(value);
+        }
+        else if (argument == "--max-size") {
+            options.m_max_size = parse_size(value);
+        }
+        else if (argument == "--repeat") {
+            options.m_repeat = parse_size(value);
+        }
+        else if (argument == "--clusters") {
+            options.m_amount_clusters = parse_size(value);
+        }
+        else if (argument == "--seed") {
+            options.m_seed = static_cast<std::size_t>(std::stoull(value));
+        }
+        else if (argument == "--threads") {
+            options.m_threads = parse_size(value);
+        }
+        else if (argument == "--output") {
+            options.m_output = value;
+        }
+        else {
+            throw std::invalid_argument("Unknown argument '" + argument + "'");
+        }
+    }
+
+    if (options.m_algorithms.empty()) {
+        for (const auto & current_case : bench_suite::get_cases()) {
+            options.m_algorithms.push_back(current_case.m_name);
+        }
+    }
+
+    return options;
+}
+
+
+static bench_result run_case(const bench_case & p_case, const bench_data_type p_type, const dataset & p_data, const bench_options & p_options) {
+    bench_result result;
+    result.m_algorithm = p_case.m_name;
+    result.m_dataset = bench_data_generator::to_string(p_type);
+    result.m_size = p_data.size();
+    result.m_dimension = p_data.empty() ? 0 : p_data.front().size();
+    result.m_threads = execution_context::get_current_thread_count();
+    result.m_repeat = p_options.m_repeat;
+
+    bench_memory::reset_peak();
+    result.m_baseline_rss = bench_memory::get_current_kb();
+
+    double total_time = 0.0;
+    for (std::size_t index = 0; index < p_options.m_repeat; index++) {
+        bench_timer timer;
+        p_case.m_execute(p_data, p_options.m_amount_clusters);
+
+        const double time = timer.elapsed();
+        result.m_min_time = (index == 0) ? time : std::min(result.m_min_time, time);
+        total_time += time;
+    }
+
+    result.m_mean_time = total_time / static_cast<double>(p_options.m_repeat);
+    result.m_peak_rss = bench_memory::get_peak_kb();
+
+    return result;
+}
+
+
+static void run_benchmarks(const bench_options & p_options, bench_report & p_report) {
+    for (const auto & name : p_options.m_algorithms) {
+        const bench_case & current_case = bench_suite::get_case(name);
+        const std::size_t max_size = p_options.m_no_limits ? p_options.m_max_size : std::min(p_options.m_max_size, current_case.m_max_size);
+
+        for (const auto type : p_options.m_datasets) {
+            /* the same seed for each algorithm: all algorithms process the same data */
+            const bench_data_generator generator(p_options.m_seed);
+
+            for (std::size_t size = p_options.m_min_size; size <= max_size; size *= 10) {
+                const auto data = generator.generate(type, size, p_options.m_amount_clusters);
+                const bench_result result = run_case(current_case, type, *data, p_options);
+
+                std::cerr << result.m_algorithm << " [" << result.m_dataset << ", " << result.m_size << "]: "
+                          << result.m_min_time << " sec, " << result.m_peak_rss << " KB" << std::endl;
+
+                p_report.append(result);
+            }
+        }
+    }
+}
+
+
+int main(int argc, char * argv[]) {
+    for (int index = 1; index < argc; index++) {
+        const std::string argument = argv[index];
+        if ((argument == "--help") || (argument == "-h")) {
+            print_usage();
+            return EXIT_SUCCESS;
+        }
+        else if (argument == "--list") {
+            for (const auto & current_case : bench_suite::get_cases()) {
+                std::cout << current_case.m_name << " (limit: " << current_case.m_max_size << ")\n";
+            }
+
+            return EXIT_SUCCESS;
+        }
+    }
+
+    try {
+        const bench_options options = parse_options(argc, argv);
+        if (options.m_threads != 0) {
+            execution_context::set_default(execution_context(options.m_threads));
+        }
+
+        bench_report report;
+        run_benchmarks(options, report);
+
+        if (options.m_output.empty()) {
+            report.write_json(std::cout);
+        }
+        else {
+            std::ofstream stream(options.m_output);
+            if (!stream.is_open()) {
+                throw std::runtime_error("Impossible to open output file '" + options.m_output + "'");
+            }
+
+            report.write_json(stream);
+        }
+    }
+    catch (const std::exception & p_error) {
+        std::cerr << "Error: " << p_error.what() << std::endl;
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -21,10 +21,14 @@
 #include "cluster/agglomerative.hpp"
 
 #include <algorithm>
+#include <limits>
+
+#include "parallel/execution_context.hpp"
 
 #include "utils/metric.hpp"
 
 
+using namespace ccore::parallel;
 using namespace ccore::utils::metric;
 
 
@@ -72,7 +76,7 @@ void agglomerative::process(const dataset & data, cluster_data & result) {
         (*m_ptr_clusters)[i].push_back(i);
     }
 
-    while(current_number_clusters > m_number_clusters) {
+    while((current_number_clusters > m_number_clusters) && !execution_context::is_cancellation_requested()) {
         merge_similar_clusters();
         current_number_clusters = m_ptr_clusters->size();
     }
@@ -37,42 +37,53 @@ bsas::bsas(const std::size_t p_amount,
 
 
 void bsas::process(const dataset & p_data, cluster_data & p_result) {
+    process(container::dense_dataset(p_data), p_result);
+}
+
+
+void bsas::process(const container::dense_dataset & p_data, cluster_data & p_result) {
     m_result_ptr = (bsas_data *) &p_result;
 
+    const container::point_view first = p_data.row(0);
+
     m_result_ptr->clusters().push_back({ 0 });
-    m_result_ptr->representatives().push_back( p_data[0] );
+    m_result_ptr->representatives().emplace_back(first.begin(), first.end());
 
     for (std::size_t i = 1; i < p_data.size(); i++) {
-        auto nearest = find_nearest_cluster(p_data[i]);
+        const container::point_view object = p_data.row(i);
+        auto nearest = find_nearest_cluster(object);
 
         if ( (nearest.m_distance > m_threshold) && (m_result_ptr->clusters().size() < m_amount) ) {
-            m_result_ptr->representatives().push_back(p_data[i]);
+            m_result_ptr->representatives().emplace_back(object.begin(), object.end());
             m_result_ptr->clusters().push_back({ i });
         }
         else {
             m_result_ptr->clusters()[nearest.m_index].push_back(i);
-            update_representative(nearest.m_index, p_data[i]);
+            update_representative(nearest.m_index, object);
         }
     }
 }
 
 
-bsas::nearest_cluster bsas::find_nearest_cluster(const point & p_point) const {
+bsas::nearest_cluster bsas::find_nearest_cluster(const container::point_view & p_point) const {
     bsas::nearest_cluster result;
 
-    for (std::size_t i = 0; i < m_result_ptr->clusters().size(); i++) {
-        double distance = m_metric(p_point, m_result_ptr->representatives()[i]);
-        if (distance < result.m_distance) {
-            result.m_distance = distance;
-            result.m_index = i;
+    visit_metric(m_metric, [this, &p_point, &result](const auto & p_metric) {
+        const dataset & representatives = m_result_ptr->representatives();
+        for (std::size_t i = 0; i < m_result_ptr->clusters().size(); i++) {
+            double distance = p_metric(p_point, representatives[i]);
+            if (distance < result.m_distance) {
+                result.m_distance = distance;
+                result.m_index = i;
+            }
         }
-    }
+    });
 
     return result;
 }
 
 
-void bsas::update_representative(const std::size_t p_index, const point & p_point) {
+void bsas::update_representative(const std::size_t p_index, const container::point_view & p_point) {
     double len = (double) m_result_ptr->clusters().size();
     auto & rep = m_result_ptr->representatives()[p_index];
 
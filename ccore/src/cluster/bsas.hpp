@@ -21,6 +21,8 @@
 #pragma once
 
 
+#include <limits>
+
 #include "cluster/cluster_algorithm.hpp"
 #include "cluster/bsas_data.hpp"
 
@@ -69,10 +71,20 @@ public:
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) override;
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
 protected:
-    nearest_cluster find_nearest_cluster(const point & p_point) const;
+    nearest_cluster find_nearest_cluster(const container::point_view & p_point) const;
 
-    void update_representative(const std::size_t p_index, const point & p_point);
+    void update_representative(const std::size_t p_index, const container::point_view & p_point);
 };
 
 
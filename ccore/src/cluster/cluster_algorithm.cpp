@@ -30,6 +30,14 @@ namespace clst {
 cluster_algorithm::~cluster_algorithm(void) { }
 
 
+void cluster_algorithm::process(const container::dense_dataset & p_data, cluster_data & p_result) {
+    dataset data;
+    p_data.extract(data);
+
+    process(data, p_result);
+}
+
+
 }
 
 }
@@ -25,6 +25,8 @@
 
 #include "cluster/cluster_data.hpp"
 
+#include "container/dense_dataset.hpp"
+
 #include "definitions.hpp"
 
 
@@ -57,6 +59,18 @@ public:
     *
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) = 0;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    * @details  Default implementation copies points to 'dataset' and performs ordinary processing, algorithms
+    *            that are able to work with dense data directly override this method.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result);
 };
 
 
@@ -35,6 +35,18 @@ const cluster_sequence & cluster_data::clusters(void) const { return m_clusters;
 size_t cluster_data::size(void) const { return m_clusters.size(); }
 
 
+void cluster_data::enable_statistics(const bool p_enabled) { m_statistics_enabled = p_enabled; }
+
+
+bool cluster_data::is_statistics_enabled(void) const { return m_statistics_enabled; }
+
+
+utils::statistics::performance_statistics & cluster_data::statistics(void) { return m_statistics; }
+
+
+const utils::statistics::performance_statistics & cluster_data::statistics(void) const { return m_statistics; }
+
+
 cluster & cluster_data::operator[](const size_t p_index) { return m_clusters[p_index]; }
 
 
@@ -44,6 +56,8 @@ const cluster & cluster_data::operator[](const size_t p_index) const { return m_
 cluster_data & cluster_data::operator=(const cluster_data & p_other) {
     if (this != &p_other) {
         m_clusters = p_other.m_clusters;
+        m_statistics = p_other.m_statistics;
+        m_statistics_enabled = p_other.m_statistics_enabled;
     }
 
     return *this;
@@ -53,6 +67,8 @@ cluster_data & cluster_data::operator=(const cluster_data & p_other) {
 cluster_data & cluster_data::operator=(cluster_data && p_other) {
     if (this != &p_other) {
         m_clusters = std::move(p_other.m_clusters);
+        m_statistics = p_other.m_statistics;
+        m_statistics_enabled = p_other.m_statistics_enabled;
     }
 
     return *this;
@@ -24,6 +24,8 @@
 #include <vector>
 #include <memory>
 
+#include "utils/statistics.hpp"
+
 
 namespace ccore {
 
@@ -49,6 +51,9 @@ class cluster_data {
 protected:
     cluster_sequence      m_clusters;
 
+    utils::statistics::performance_statistics   m_statistics;
+    bool                  m_statistics_enabled = utils::statistics::performance_statistics::is_enabled_by_default();
+
 public:
     /**
     *
@@ -104,6 +109,36 @@ public:
     */
     size_t size(void) const;
 
+    /**
+    *
+    * @brief    Enables or disables collection of performance statistics by algorithms that process the data.
+    *
+    * @param[in] p_enabled: if 'true' then statistics of the next processing is collected.
+    *
+    */
+    void enable_statistics(const bool p_enabled);
+
+    /**
+    *
+    * @brief    Returns 'true' if algorithms collect performance statistics to the data.
+    *
+    */
+    bool is_statistics_enabled(void) const;
+
+    /**
+    *
+    * @brief    Returns performance statistics (counters and execution time of phases) of the last processing.
+    *
+    */
+    utils::statistics::performance_statistics & statistics(void);
+
+    /**
+    *
+    * @brief    Returns constant reference to performance statistics of the last processing.
+    *
+    */
+    const utils::statistics::performance_statistics & statistics(void) const;
+
 public:
     /**
     *
@@ -147,7 +182,8 @@ public:
     *
     * @param[in] p_other: another clustering data that is used for comparison.
     *
-    * @return  Returns true if both objects have the same amount of clusters with the same elements.
+    * @return  Returns true if both objects have the same amount of clusters with the same elements, statistics
+    *           is not compared.
     *
     */
     bool operator==(const cluster_data & p_other) const;
@@ -25,10 +25,13 @@
 
 #include "cluster/cure.hpp"
 
+#include "parallel/execution_context.hpp"
+
 #include "utils/metric.hpp"
 
 
 using namespace ccore::container;
+using namespace ccore::parallel;
 using namespace ccore::utils::metric;
 
 
@@ -79,13 +82,17 @@ cure_queue::cure_queue(const std::vector< std::vector<double> > * data) {
     queue = new std::list<cure_cluster *>();
     create_queue(data);
 
-    tree = new kdtree();
+    dataset points;
+    std::vector<void *> payloads;
 
     for (auto cluster : *queue) {
         for (auto point : *(cluster->rep)) {
-            tree->insert(*point, cluster);
+            points.push_back(*point);
+            payloads.push_back(cluster);
         }
     }
+
+    tree = new kdtree(points, payloads);
 }
 
 
@@ -367,7 +374,7 @@ void cure::process(const dataset & p_data, cluster_data & p_result) {
     data = &p_data;
 
     std::size_t allocated_clusters = queue->size();
-    while(allocated_clusters > number_clusters) {
+    while((allocated_clusters > number_clusters) && !execution_context::is_cancellation_requested()) {
         cure_cluster * cluster1 = *(queue->begin());
         cure_cluster * cluster2 = cluster1->closest;
 
@@ -297,6 +297,9 @@ public:
     *
     * @brief    Performs cluster analysis of an input data.
     *
+    * @details  Processing is stopped after the current merge if cancellation is requested by the execution context,
+    *            in this case the result contains clusters that have been allocated before.
+    *
     * @param[in]  p_data: input data for cluster analysis.
     * @param[out] p_result: clustering result of an input data.
     *
@@ -21,9 +21,15 @@
 
 #include "cluster/dbscan.hpp"
 
+#include <stdexcept>
 #include <string>
 #include <unordered_set>
 
+#include "utils/statistics.hpp"
+
+
+using namespace ccore::utils::statistics;
+
 
 namespace ccore {
 
@@ -31,12 +37,10 @@ namespace clst {
 
 
 dbscan::dbscan(const double p_radius_connectivity, const size_t p_minimum_neighbors) :
-        m_data_ptr(nullptr),
         m_result_ptr(nullptr),
         m_visited(std::vector<bool>()),
         m_belong(std::vector<bool>()),
         m_initial_radius(p_radius_connectivity),
-        m_radius(p_radius_connectivity * p_radius_connectivity),
         m_neighbors(p_minimum_neighbors)
 { }
 
@@ -47,19 +51,145 @@ void dbscan::process(const dataset & p_data, cluster_data & p_result) {
 
 
 void dbscan::process(const dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result) {
-    m_data_ptr  = &p_data;
-    m_type      = p_type;
+    if (p_type == dbscan_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);     /* rows are not copied */
+    }
+    else {
+        process(container::dense_dataset(p_data), p_type, p_result);
+    }
+}
+
+
+void dbscan::process(const container::dense_dataset & p_data, cluster_data & p_result) {
+    process(p_data, dbscan_data_t::POINTS, p_result);
+}
+
+
+void dbscan::process(const container::dense_dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result) {
+    if (p_type == dbscan_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);     /* rows are not copied */
+        return;
+    }
+
+    if (p_type != dbscan_data_t::POINTS) {
+        throw std::invalid_argument("Incorrect input data type is specified '" + std::to_string((unsigned) p_type) + "'");
+    }
+
+    m_type = p_type;
+
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
+    const container::neighbor_searcher searcher(p_data, m_index, m_metric);
+    const double radius = m_initial_radius;
+
+    process_objects(p_data.size(), [&searcher, radius](const std::size_t p_index, std::vector<std::size_t> & p_neighbors) {
+        phase_timer timer(phase_t::NEIGHBOR_SEARCH);
+        statistics_collector::increment(counter_t::NEIGHBOR_QUERIES);
+
+        searcher.find_neighbors(p_index, radius, [&p_neighbors](const std::size_t p_neighbor, const double) {
+            p_neighbors.push_back(p_neighbor);
+        });
+    }, p_result);
+}
+
+
+void dbscan::process(const container::neighbor_graph & p_graph, cluster_data & p_result) {
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+    process_graph(p_graph, p_result);
+}
+
+
+void dbscan::process_graph(const container::neighbor_graph & p_graph, cluster_data & p_result) {
+    if (p_graph.get_radius() < m_initial_radius) {
+        throw std::invalid_argument("CCORE [dbscan]: radius of neighbor graph '" + std::to_string(p_graph.get_radius()) +
+            "' is less than connectivity radius '" + std::to_string(m_initial_radius) + "'.");
+    }
+
+    const std::vector<std::size_t> & offsets = p_graph.get_offsets();
+    const std::vector<std::size_t> & indexes = p_graph.get_indexes();
+
+    if (p_graph.get_radius() == m_initial_radius) {
+        process_objects(p_graph.size(), [&offsets, &indexes](const std::size_t p_index, std::vector<std::size_t> & p_neighbors) {
+            p_neighbors.insert(p_neighbors.end(), indexes.begin() + offsets[p_index], indexes.begin() + offsets[p_index + 1]);
+        }, p_result);
+
+        return;
+    }
 
-    if (m_type == dbscan_data_t::POINTS) {
-        create_kdtree(*m_data_ptr);
+    if (!p_graph.has_distances()) {
+        throw std::invalid_argument("CCORE [dbscan]: neighbor graph with larger radius does not contain distances.");
     }
 
-    m_visited = std::vector<bool>(m_data_ptr->size(), false);
-    m_belong = std::vector<bool>(m_data_ptr->size(), false);
+    const std::vector<double> & distances = p_graph.get_distances();
+    const double radius = m_initial_radius;
+
+    process_objects(p_graph.size(), [&offsets, &indexes, &distances, radius](const std::size_t p_index, std::vector<std::size_t> & p_neighbors) {
+        for (std::size_t position = offsets[p_index]; position < offsets[p_index + 1]; position++) {
+            if (distances[position] <= radius) {
+                p_neighbors.push_back(indexes[position]);
+            }
+        }
+    }, p_result);
+}
+
+
+void dbscan::set_spatial_index(const container::spatial_index_t p_index) {
+    m_index = p_index;
+}
+
+
+container::spatial_index_t dbscan::get_spatial_index(void) const {
+    return m_index;
+}
+
+
+void dbscan::set_metric(const utils::metric::distance_metric<point> & p_metric) {
+    m_metric = p_metric;
+}
+
+
+const utils::metric::distance_metric<point> & dbscan::get_metric(void) const {
+    return m_metric;
+}
+
+
+void dbscan::process(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result) {
+    process_distance_matrix(p_matrix, p_result);
+}
+
+
+void dbscan::process(const container::pairwise_distance_matrix<float> & p_matrix, cluster_data & p_result) {
+    process_distance_matrix(p_matrix, p_result);
+}
+
+
+template <typename TypeValue>
+void dbscan::process_distance_matrix(const container::pairwise_distance_matrix<TypeValue> & p_matrix, cluster_data & p_result) {
+    const double radius = m_initial_radius;
+
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
+    process_objects(p_matrix.size(), [&p_matrix, radius](const std::size_t p_index, std::vector<std::size_t> & p_neighbors) {
+        phase_timer timer(phase_t::NEIGHBOR_SEARCH);
+        statistics_collector::increment(counter_t::NEIGHBOR_QUERIES);
+
+        p_matrix.for_each_distance(p_index, [radius, &p_neighbors](const std::size_t p_neighbor, const TypeValue p_distance) {
+            if ((double) p_distance <= radius) {
+                p_neighbors.push_back(p_neighbor);
+            }
+        });
+    }, p_result);
+}
+
+
+template <typename TypeSearcher>
+void dbscan::process_objects(const std::size_t p_size, const TypeSearcher & p_searcher, cluster_data & p_result) {
+    m_visited = std::vector<bool>(p_size, false);
+    m_belong = std::vector<bool>(p_size, false);
 
     m_result_ptr = (dbscan_data *) &p_result;
 
-    for (size_t i = 0; i < m_data_ptr->size(); i++) {
+    for (size_t i = 0; i < p_size; i++) {
         if (m_visited[i] == true) {
             continue;
         }
@@ -68,27 +198,27 @@ void dbscan::process(const dataset & p_data, const dbscan_data_t p_type, cluster
 
         /* expand cluster */
         cluster allocated_cluster;
-        expand_cluster(i, allocated_cluster);
+        expand_cluster(i, p_searcher, allocated_cluster);
 
         if (allocated_cluster.empty() != true) {
             m_result_ptr->clusters().emplace_back(std::move(allocated_cluster));
         }
     }
 
-    for (size_t i = 0; i < m_data_ptr->size(); i++) {
+    for (size_t i = 0; i < p_size; i++) {
         if (!m_belong[i]) {
             m_result_ptr->noise().emplace_back(i);
         }
     }
 
-    m_data_ptr = nullptr;
     m_result_ptr = nullptr;
 }
 
 
-void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_cluster) {
+template <typename TypeSearcher>
+void dbscan::expand_cluster(const std::size_t p_index, const TypeSearcher & p_searcher, cluster & allocated_cluster) {
     std::vector<size_t> index_matrix_neighbors;
-    get_neighbors(p_index, index_matrix_neighbors);
+    p_searcher(p_index, index_matrix_neighbors);
 
     if (index_matrix_neighbors.size() >= m_neighbors) {
         allocated_cluster.push_back(p_index);
@@ -102,7 +232,7 @@ void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_clust
 
                 /* check for neighbors of the current neighbor - maybe it's noise */
                 std::vector<size_t> neighbor_neighbor_indexes;
-                get_neighbors(index_neighbor, neighbor_neighbor_indexes);
+                p_searcher(index_neighbor, neighbor_neighbor_indexes);
                 if (neighbor_neighbor_indexes.size() >= m_neighbors) {
 
                     /* Add neighbors of the neighbor for checking */
@@ -128,50 +258,6 @@ void dbscan::expand_cluster(const std::size_t p_index, cluster & allocated_clust
 }
 
 
-void dbscan::get_neighbors(const size_t p_index, std::vector<size_t> & p_neighbors) {
-    switch(m_type) {
-    case dbscan_data_t::POINTS:
-        get_neighbors_from_points(p_index, p_neighbors);
-        break;
-
-    case dbscan_data_t::DISTANCE_MATRIX:
-        get_neighbors_from_distance_matrix(p_index, p_neighbors);
-        break;
-
-    default:
-        throw std::invalid_argument("Incorrect input data type is specified '" + std::to_string((unsigned) m_type) + "'");
-    }
-}
-
-
-void dbscan::get_neighbors_from_points(const size_t p_index, std::vector<size_t> & p_neighbors) {
-    container::kdtree_searcher searcher((*m_data_ptr)[p_index], m_kdtree.get_root(), m_initial_radius);
-    searcher.find_nearest([&p_index, &p_neighbors](const container::kdnode::ptr & node, const double distance) {
-            if (p_index != (std::size_t) node->get_payload()) {
-                p_neighbors.push_back((std::size_t) node->get_payload());
-            }
-        });
-}
-
-
-void dbscan::get_neighbors_from_distance_matrix(const size_t p_index, std::vector<size_t> & p_neighbors) {
-    const auto & distances = m_data_ptr->at(p_index);
-    for (std::size_t index_neighbor = 0; index_neighbor < distances.size(); index_neighbor++) {
-        const double candidate_distance = distances[index_neighbor];
-        if ( (candidate_distance <= m_initial_radius) && (index_neighbor != p_index) ) {
-            p_neighbors.push_back(index_neighbor);
-        }
-    }
-}
-
-
-void dbscan::create_kdtree(const dataset & p_data) {
-    for (std::size_t index = 0; index < p_data.size(); index++) {
-        m_kdtree.insert(p_data[index], (void *) index);
-    }
-}
-
-
 }
 
 }
\ No newline at end of file
@@ -24,7 +24,9 @@
 #include <cmath>
 #include <algorithm>
 
-#include "container/kdtree.hpp"
+#include "container/neighbor_graph.hpp"
+#include "container/pairwise_distance_matrix.hpp"
+#include "container/spatial_index.hpp"
 
 #include "cluster/cluster_algorithm.hpp"
 #include "cluster/dbscan_data.hpp"
@@ -49,8 +51,6 @@ enum class dbscan_data_t {
 */
 class dbscan {
 private:
-    const dataset       * m_data_ptr      = nullptr;       /* temporary pointer to input data that is used only during processing */
-
     dbscan_data         * m_result_ptr    = nullptr;       /* temporary pointer to clustering result that is used only during processing */
 
     std::vector<bool>   m_visited         = { };
@@ -59,13 +59,13 @@ private:
 
     double              m_initial_radius  = 0.0;    /* original radius that was specified by user */
 
-    double              m_radius          = 0.0;    /* square of the original radius to improve performance */
-
     size_t              m_neighbors       = 0;
 
     dbscan_data_t       m_type            = dbscan_data_t::POINTS;
 
-    container::kdtree   m_kdtree          = container::kdtree();
+    container::spatial_index_t  m_index   = container::spatial_index_t::KDTREE_STATIC;
+
+    utils::metric::distance_metric<point>   m_metric = utils::metric::distance_metric_factory<point>::euclidean();
 
 public:
     /**
@@ -116,24 +116,101 @@ public:
     */
     virtual void process(const dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result);
 
-private:
     /**
     *
-    * @brief    Obtains neighbors of the specified node (data object).
+    * @brief    Performs cluster analysis of an input data (points) that is stored in contiguous buffer.
     *
-    * @param[in]  p_index: index of the node (data object).
-    * @param[out] p_neighbors: neighbor indexes of the specified node (data object).
+    * @param[in]  p_data: input data (points) for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
     *
     */
-    void get_neighbors(const size_t p_index, std::vector<size_t> & p_neighbors);
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result);
 
-    void get_neighbors_from_points(const size_t p_index, std::vector<size_t> & p_neighbors);
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data of specific type that is stored in contiguous buffer.
+    * @details  Neighbors of each point are searched by the spatial index when the point is visited, therefore
+    *            memory does not depend on amount of neighbors. Neighborhood graph can be built in parallel and
+    *            processed instead when it is reused or memory for all neighbors is acceptable, see 'neighbor_graph'.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[in]  p_type: type of an input data that should be processed.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, const dbscan_data_t p_type, cluster_data & p_result);
+
+    /**
+    * @brief    Performs cluster analysis using precalculated distance matrix (condensed or square).
+    * @param[in]  p_matrix: distance matrix between objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
+    */
+    virtual void process(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result);
+
+    /**
+    * @brief    Performs cluster analysis using precalculated distance matrix in single precision.
+    * @param[in]  p_matrix: distance matrix between objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
+    */
+    virtual void process(const container::pairwise_distance_matrix<float> & p_matrix, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis using precalculated radius neighborhood graph.
+    * @details  The graph can be reused with different amount of neighbors. If radius of the graph is bigger than
+    *            connectivity radius then neighbors are filtered by distances that should be stored by the graph.
+    *
+    * @param[in]  p_graph: neighborhood graph of objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    * @throw    std::invalid_argument if radius of the graph is less than connectivity radius or if it is bigger and
+    *            the graph does not contain distances.
+    *
+    */
+    virtual void process(const container::neighbor_graph & p_graph, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Defines spatial index that is used to find neighbors of points, static k-d tree is used by default.
+    *
+    * @param[in]  p_index: spatial index that should be used by following processing.
+    *
+    */
+    void set_spatial_index(const container::spatial_index_t p_index);
+
+    container::spatial_index_t get_spatial_index(void) const;
+
+    /**
+    *
+    * @brief    Defines metric that is used to find neighbors of points, Euclidean metric is used by default.
+    * @details  Only VP-tree supports non-Euclidean metrics, therefore spatial index should be changed to
+    *            'spatial_index_t::VPTREE' before processing, otherwise exception 'std::invalid_argument' is thrown.
+    *            Distance matrix is processed without metric.
+    *
+    * @param[in]  p_metric: metric that satisfies the triangle inequality.
+    *
+    */
+    void set_metric(const utils::metric::distance_metric<point> & p_metric);
+
+    const utils::metric::distance_metric<point> & get_metric(void) const;
+
+private:
+    /**
+    * @brief    Allocates clusters and noise using specified neighbor searcher.
+    * @param[in]  p_size: amount of objects that should be clustered.
+    * @param[in]  p_searcher: callable object with signature 'void(const std::size_t p_index, std::vector<std::size_t> & p_neighbors)'.
+    * @param[out] p_result: clustering result of an input data.
+    */
+    template <typename TypeSearcher>
+    void process_objects(const std::size_t p_size, const TypeSearcher & p_searcher, cluster_data & p_result);
 
-    void get_neighbors_from_distance_matrix(const size_t p_index, std::vector<size_t> & p_neighbors);
+    template <typename TypeValue>
+    void process_distance_matrix(const container::pairwise_distance_matrix<TypeValue> & p_matrix, cluster_data & p_result);
 
-    void create_kdtree(const dataset & p_data);
+    void process_graph(const container::neighbor_graph & p_graph, cluster_data & p_result);
 
-    void expand_cluster(const std::size_t p_index, cluster & allocated_cluster);
+    template <typename TypeSearcher>
+    void expand_cluster(const std::size_t p_index, const TypeSearcher & p_searcher, cluster & allocated_cluster);
 };
 
 
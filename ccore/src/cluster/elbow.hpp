@@ -71,13 +71,15 @@ public:
         m_result = &p_result;
         m_elbow.clear();
 
+        const container::dense_dataset dense_data(p_data);
+
         for (std::size_t i = m_kmin; i < m_kmax; i++) {
             dataset initial_centers;
             TypeInitializer(i).initialize(p_data, initial_centers);
 
             kmeans_data result;
             kmeans instance(initial_centers, 0.0001);
-            instance.process(p_data, result);
+            instance.process(dense_data, result);
 
             m_result->get_wce().push_back(result.wce());
         }
@@ -23,11 +23,14 @@
 #include <limits>
 #include <cmath>
 
+#include "parallel/execution_context.hpp"
+
 #include "utils/metric.hpp"
 
 
 using namespace ccore::utils::metric;
 using namespace ccore::nnet;
+using namespace ccore::parallel;
 
 
 namespace ccore {
@@ -75,11 +78,19 @@ void hsyncnet::process(const double order, const solve_type solver, const bool c
         increase_step = DEFAULT_INCREASE_STEP;
     }
 
+    cancellation_scope cancellation;
+
     sync_dynamic current_dynamic;
+    bool cancelled = false;
     do {
         create_connections(radius, false);
 
-        simulate_dynamic(order, 0.1, solver, collect_dynamic, current_dynamic);
+        try {
+            simulate_dynamic(order, 0.1, solver, collect_dynamic, current_dynamic);
+        }
+        catch (const operation_cancelled &) {
+            cancelled = true;   /* phases are updated by whole steps, therefore the last stored state is consistent */
+        }
 
         if (collect_dynamic) {
             if (analyser.empty()) {
@@ -98,9 +109,13 @@ void hsyncnet::process(const double order, const solve_type solver, const bool c
         current_number_clusters = clusters.size();
 
         number_neighbors += increase_step;
-        radius = calculate_radius(radius, number_neighbors);
+
+        {
+            cancellation_scope uninterrupted(false);   /* neighbor search is parallel, cancellation is checked by the loop */
+            radius = calculate_radius(radius, number_neighbors);
+        }
     }
-    while(current_number_clusters > m_number_clusters);
+    while((current_number_clusters > m_number_clusters) && !cancelled && !execution_context::is_cancellation_requested());
 
     if (!collect_dynamic) {
         store_state(*(current_dynamic.end() - 1), analyser);
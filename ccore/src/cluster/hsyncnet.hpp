@@ -61,6 +61,13 @@ public:
     virtual ~hsyncnet(void);
 
 public:
+    /**
+    *
+    * @brief    Performs cluster analysis by hierarchical Sync network.
+    * @details  Processing is stopped if cancellation is requested by the execution context, in this case the analyser
+    *           contains dynamic that has been simulated before.
+    *
+    */
     virtual void process(const double order, const solve_type solver, const bool collect_dynamic, hsyncnet_analyser & analyser) override;
 
 private:
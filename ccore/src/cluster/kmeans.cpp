@@ -21,16 +21,23 @@
 #include "cluster/kmeans.hpp"
 
 #include "parallel/parallel.hpp"
+#include "parallel/parallel_algorithm.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <unordered_map>
 
 #include "utils/metric.hpp"
+#include "utils/metric_batch.hpp"
+#include "utils/statistics.hpp"
+#include "utils/trace.hpp"
 
 
 using namespace ccore::parallel;
 using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
+using namespace ccore::utils::trace;
 
 
 namespace ccore {
@@ -40,6 +47,8 @@ namespace clst {
 
 const double             kmeans::DEFAULT_TOLERANCE                       = 0.025;
 
+const std::size_t        kmeans::WCE_REDUCTION_GRAIN                     = 1024;
+
 
 kmeans::kmeans(const dataset & p_initial_centers, const double p_tolerance, const distance_metric<point> & p_metric) :
     m_tolerance(p_tolerance * p_tolerance),
@@ -56,15 +65,28 @@ void kmeans::process(const dataset & p_data, cluster_data & p_result) {
 
 
 void kmeans::process(const dataset & p_data, const index_sequence & p_indexes, cluster_data & p_result) {
+    process(container::dense_dataset(p_data), p_indexes, p_result);
+}
+
+
+void kmeans::process(const container::dense_dataset & p_data, cluster_data & p_result) {
+    process(p_data, { }, p_result);
+}
+
+
+void kmeans::process(const container::dense_dataset & p_data, const index_sequence & p_indexes, cluster_data & p_result) {
     m_ptr_data = &p_data;
     m_ptr_indexes = &p_indexes;
 
     m_ptr_result = (kmeans_data *) &p_result;
 
-    if (p_data[0].size() != m_initial_centers[0].size()) {
+    if (p_data.dimension() != m_initial_centers[0].size()) {
         throw std::runtime_error("CCORE [kmeans]: dimension of the input data and dimension of the initial cluster centers must be equal.");
     }
 
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+    trace_scope trace("kmeans", "algorithm");
+
     m_ptr_result->centers().assign(m_initial_centers.begin(), m_initial_centers.end());
 
     if (m_ptr_result->is_observed()) {
@@ -78,6 +100,8 @@ void kmeans::process(const dataset & p_data, const index_sequence & p_indexes, c
     double current_change = std::numeric_limits<double>::max();
 
     while(current_change > m_tolerance) {
+        statistics_collector::increment(counter_t::ITERATIONS);
+
         update_clusters(m_ptr_result->centers(), m_ptr_result->clusters());
         current_change = update_centers(m_ptr_result->clusters(), m_ptr_result->centers());
 
@@ -88,11 +112,19 @@ void kmeans::process(const dataset & p_data, const index_sequence & p_indexes, c
     }
 
     calculate_total_wce();
+
+    m_ptr_data = nullptr;
+    m_ptr_indexes = nullptr;
 }
 
 
 void kmeans::update_clusters(const dataset & p_centers, cluster_sequence & p_clusters) {
-    const dataset & data = *m_ptr_data;
+    const container::dense_dataset & data = *m_ptr_data;
+
+    phase_timer timer(phase_t::UPDATE_CLUSTERS);
+
+    const std::size_t amount_points = m_ptr_indexes->empty() ? data.size() : m_ptr_indexes->size();
+    statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, amount_points * p_centers.size());
 
     p_clusters.clear();
     p_clusters.resize(p_centers.size());
@@ -100,9 +132,16 @@ void kmeans::update_clusters(const dataset & p_centers, cluster_sequence & p_clu
     /* fill clusters again in line with centers. */
     if (m_ptr_indexes->empty()) {
         std::vector<std::size_t> winners(data.size(), 0);
-        parallel_for(std::size_t(0), data.size(), [this, &p_centers, &winners](std::size_t p_index) {
-            assign_point_to_cluster(p_index, p_centers, winners);
-        });
+        if (is_batch_assignment_supported(m_metric)) {
+            find_nearest_centers(data, p_centers, winners);
+        }
+        else {
+            visit_metric(m_metric, [this, &data, &p_centers, &winners](const auto & p_metric) {
+                parallel_for(std::size_t(0), data.size(), [this, &p_centers, &p_metric, &winners](std::size_t p_index) {
+                    assign_point_to_cluster(p_index, p_centers, p_metric, winners);
+                });
+            });
+        }
 
         for (std::size_t index_point = 0; index_point < winners.size(); index_point++) {
             const std::size_t suitable_index_cluster = winners[index_point];
@@ -110,13 +149,19 @@ void kmeans::update_clusters(const dataset & p_centers, cluster_sequence & p_clu
         }
     }
     else {
-        /* This part of code is used by X-Means and in case of parallel implementation of this part in scope of X-Means
-           performance is slightly reduced. Experiments has been performed our implementation and Intel TBB library. 
-           But in K-Means case only - it works perfectly and increase performance. */
+        /* This part of code is used by X-Means where it is called from parallel loop over clusters, the nested
+           parallel loop is executed by the same work-stealing pool and threads that wait for it help to process it. */
         std::vector<std::size_t> winners(data.size(), 0);
-        parallel_for_each(*m_ptr_indexes, [this, &p_centers, &winners](std::size_t p_index) {
-            assign_point_to_cluster(p_index, p_centers, winners);
-        });
+        if (is_batch_assignment_supported(m_metric)) {
+            find_nearest_centers(data, *m_ptr_indexes, p_centers, winners);
+        }
+        else {
+            visit_metric(m_metric, [this, &p_centers, &winners](const auto & p_metric) {
+                parallel_for_each(*m_ptr_indexes, [this, &p_centers, &p_metric, &winners](std::size_t p_index) {
+                    assign_point_to_cluster(p_index, p_centers, p_metric, winners);
+                });
+            });
+        }
 
         for (std::size_t index_point : *m_ptr_indexes) {
             const std::size_t suitable_index_cluster = winners[index_point];
@@ -128,12 +173,14 @@ void kmeans::update_clusters(const dataset & p_centers, cluster_sequence & p_clu
 }
 
 
-void kmeans::assign_point_to_cluster(const std::size_t p_index_point, const dataset & p_centers, std::vector<std::size_t> & p_clusters) {
+template <typename TypeMetric>
+void kmeans::assign_point_to_cluster(const std::size_t p_index_point, const dataset & p_centers, const TypeMetric & p_metric, std::vector<std::size_t> & p_clusters) const {
     double    minimum_distance = std::numeric_limits<double>::max();
     size_t    suitable_index_cluster = 0;
 
+    const container::point_view object = m_ptr_data->row(p_index_point);
     for (size_t index_cluster = 0; index_cluster < p_centers.size(); index_cluster++) {
-        double distance = m_metric(p_centers[index_cluster], (*m_ptr_data)[p_index_point]);
+        double distance = p_metric(p_centers[index_cluster], object);
 
         if (distance < minimum_distance) {
             minimum_distance = distance;
@@ -155,20 +202,23 @@ void kmeans::erase_empty_clusters(cluster_sequence & p_clusters) {
 
 
 double kmeans::update_centers(const cluster_sequence & clusters, dataset & centers) {
-    const dataset & data = *m_ptr_data;
-    const size_t dimension = data[0].size();
+    const size_t dimension = m_ptr_data->dimension();
+
+    phase_timer timer(phase_t::UPDATE_CENTERS);
+    statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, clusters.size());
 
     dataset calculated_clusters(clusters.size(), point(dimension, 0.0));
-    std::vector<double> changes(clusters.size(), 0.0);
 
-    parallel_for(std::size_t(0), clusters.size(), [this, &clusters, &centers, &calculated_clusters, &changes](const std::size_t p_index) {
-        calculated_clusters[p_index] = centers[p_index];
-        changes[p_index] = update_center(clusters[p_index], calculated_clusters[p_index]);
-    });
+    const auto maximum = [](const double p_change1, const double p_change2) { return std::max(p_change1, p_change2); };
+    const double maximum_change = parallel_transform_reduce(std::size_t(0), clusters.size(), 0.0, maximum,
+        [this, &clusters, &centers, &calculated_clusters](const std::size_t p_index) {
+            calculated_clusters[p_index] = centers[p_index];
+            return update_center(clusters[p_index], calculated_clusters[p_index]);
+        });
 
     centers = std::move(calculated_clusters);
 
-    return *(std::max_element(changes.begin(), changes.end()));
+    return maximum_change;
 }
 
 
@@ -177,9 +227,11 @@ double kmeans::update_center(const cluster & p_cluster, point & p_center) {
 
     /* for each object in cluster */
     for (auto object_index : p_cluster) {
+        const container::point_view object = m_ptr_data->row(object_index);
+
         /* for each dimension */
         for (size_t dimension = 0; dimension < total.size(); dimension++) {
-            total[dimension] += (*m_ptr_data)[object_index][dimension];
+            total[dimension] += object[dimension];
         }
     }
 
@@ -197,14 +249,25 @@ double kmeans::update_center(const cluster & p_cluster, point & p_center) {
 
 void kmeans::calculate_total_wce(void) {
     double & wce = m_ptr_result->wce();
-    for (std::size_t i = 0; i < m_ptr_result->clusters().size(); i++) {
-        const auto & current_cluster = m_ptr_result->clusters().at(i);
-        const auto & cluster_center = m_ptr_result->centers().at(i);
 
-        for (const auto & cluster_point : current_cluster) {
-            wce += m_metric(m_ptr_data->at(cluster_point), cluster_center);
-        }
-    }
+    const std::size_t amount_points = m_ptr_indexes->empty() ? m_ptr_data->size() : m_ptr_indexes->size();
+    statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, amount_points);
+
+    visit_metric(m_metric, [this, &wce](const auto & p_metric) {
+        const cluster_sequence & clusters = m_ptr_result->clusters();
+        const dataset & centers = m_ptr_result->centers();
+
+        wce += parallel_transform_reduce(std::size_t(0), clusters.size(), 0.0, std::plus<double>(),
+            [this, &clusters, &centers, &p_metric](const std::size_t p_index) {
+                const cluster & current_cluster = clusters[p_index];
+                const point & cluster_center = centers[p_index];
+
+                return parallel_transform_reduce(std::size_t(0), current_cluster.size(), 0.0, std::plus<double>(),
+                    [this, &current_cluster, &cluster_center, &p_metric](const std::size_t p_position) {
+                        return p_metric(m_ptr_data->row(current_cluster[p_position]), cluster_center);
+                    }, WCE_REDUCTION_GRAIN);
+            });
+    });
 }
 
 
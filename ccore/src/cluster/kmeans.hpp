@@ -47,6 +47,10 @@ class kmeans : public cluster_algorithm {
 public:
     const static double             DEFAULT_TOLERANCE;
 
+private:
+    /* amount of points that are processed by one task during calculation of within cluster error */
+    const static std::size_t        WCE_REDUCTION_GRAIN;
+
 private:
     double                  m_tolerance             = DEFAULT_TOLERANCE;
 
@@ -54,7 +58,7 @@ private:
 
     kmeans_data             * m_ptr_result          = nullptr;      /* temporary pointer to output result */
 
-    const dataset           * m_ptr_data            = nullptr;      /* used only during processing */
+    const container::dense_dataset  * m_ptr_data    = nullptr;      /* used only during processing */
 
     const index_sequence    * m_ptr_indexes         = nullptr;      /* temporary pointer to indexes */
 
@@ -116,12 +120,44 @@ public:
     */
     virtual void process(const dataset & p_data, const index_sequence & p_indexes, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]     p_data: input data for cluster analysis.
+    * @param[in|out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]     p_data: input data for cluster analysis.
+    * @param[in]     p_indexes: specify indexes of objects in 'p_data' that should be used during clustering process.
+    * @param[in|out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, const index_sequence & p_indexes, cluster_data & p_result);
+
 private:
     void update_clusters(const dataset & centers, cluster_sequence & clusters);
 
     double update_centers(const cluster_sequence & clusters, dataset & centers);
 
-    void assign_point_to_cluster(const std::size_t p_index_point, const dataset & p_centers, std::vector<std::size_t> & p_clusters);
+    /**
+    *
+    * @brief    Assigns point to the closest cluster, where distance is calculated by compile-time metric policy.
+    *
+    * @param[in] p_index_point: index of point that should be assigned.
+    * @param[in] p_centers: centers of clusters.
+    * @param[in] p_metric: metric policy (or metric itself in case of user-defined metric).
+    * @param[out] p_clusters: cluster index for each point.
+    *
+    */
+    template <typename TypeMetric>
+    void assign_point_to_cluster(const std::size_t p_index_point, const dataset & p_centers, const TypeMetric & p_metric, std::vector<std::size_t> & p_clusters) const;
 
     /**
     *
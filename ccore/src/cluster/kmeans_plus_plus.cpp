@@ -21,15 +21,22 @@
 
 #include "cluster/kmeans_plus_plus.hpp"
 
+#include "parallel/parallel_algorithm.hpp"
+
+#include "utils/metric_simd.hpp"
+
 #include <algorithm>
 #include <chrono>
 #include <exception>
+#include <functional>
 #include <limits>
-#include <numeric>
 #include <random>
 #include <string>
 
 
+using namespace ccore::parallel;
+
+
 namespace ccore {
 
 namespace clst {
@@ -37,6 +44,8 @@ namespace clst {
 
 const std::size_t kmeans_plus_plus::FARTHEST_CENTER_CANDIDATE = std::numeric_limits<std::size_t>::max();
 
+const std::size_t kmeans_plus_plus::PROBABILITY_SCAN_GRAIN = 4096;
+
 
 kmeans_plus_plus::kmeans_plus_plus(const std::size_t p_amount, const std::size_t p_candidates) noexcept :
         m_amount(p_amount),
@@ -51,7 +60,8 @@ kmeans_plus_plus::kmeans_plus_plus(const std::size_t p_amount, const std::size_t
 kmeans_plus_plus::kmeans_plus_plus(const std::size_t p_amount, const std::size_t p_candidates, const metric & p_functor) noexcept :
         m_amount(p_amount),
         m_candidates(p_candidates),
-        m_dist_func(p_functor)
+        m_dist_func(p_functor),
+        m_euclidean(false)
 { }
 
 
@@ -64,29 +74,43 @@ void kmeans_plus_plus::initialize(const dataset & p_data,
                                   const index_sequence & p_indexes,
                                   dataset & p_centers) const
 {
+    initialize_centers(p_data, p_indexes, p_centers);
+}
+
+
+void kmeans_plus_plus::initialize(const container::dense_dataset & p_data,
+                                  const index_sequence & p_indexes,
+                                  dataset & p_centers) const
+{
+    initialize_centers(p_data, p_indexes, p_centers);
+}
+
+
+template <typename TypeData>
+void kmeans_plus_plus::initialize_centers(const TypeData & p_data, const index_sequence & p_indexes, dataset & p_centers) const {
     p_centers.clear();
     p_centers.reserve(m_amount);
 
     if (!m_amount) { return; }
 
-    store_temporal_params(p_data, p_indexes, p_centers);
+    store_temporal_params(p_data.size(), p_indexes, p_centers);
 
-    p_centers.push_back(get_first_center());
+    p_centers.push_back(get_first_center(p_data));
 
     for (std::size_t i = 1; i < m_amount; i++) {
-        p_centers.push_back(get_next_center());
+        p_centers.push_back(get_next_center(p_data));
     }
 
     free_temporal_params();
 }
 
 
-void kmeans_plus_plus::store_temporal_params(const dataset & p_data, const index_sequence & p_indexes, const dataset & p_centers) const {
-    if (p_data.empty()) {
+void kmeans_plus_plus::store_temporal_params(const std::size_t p_size, const index_sequence & p_indexes, const dataset & p_centers) const {
+    if (p_size == 0) {
         throw std::invalid_argument("Input data is empty.");
     }
 
-    if (p_data.size() < m_amount) {
+    if (p_size < m_amount) {
         throw std::invalid_argument("Amount of objects should be equal or greater then amount of initialized centers.");
     }
 
@@ -94,21 +118,20 @@ void kmeans_plus_plus::store_temporal_params(const dataset & p_data, const index
         throw std::invalid_argument("Amount of objects defined by range should be equal or greater then amount of initialized centers.");
     }
 
-    m_data_ptr      = (dataset *) &p_data;
     m_indexes_ptr   = (index_sequence *) &p_indexes;
     m_centers_ptr   = (dataset *) &p_centers;
 }
 
 
 void kmeans_plus_plus::free_temporal_params(void) const {
-    m_data_ptr      = nullptr;
     m_indexes_ptr   = nullptr;
     m_centers_ptr   = nullptr;
 }
 
 
-point kmeans_plus_plus::get_first_center(void) const {
-    std::size_t length = m_indexes_ptr->empty() ? m_data_ptr->size() : m_indexes_ptr->size();
+template <typename TypeData>
+point kmeans_plus_plus::get_first_center(const TypeData & p_data) const {
+    std::size_t length = m_indexes_ptr->empty() ? p_data.size() : m_indexes_ptr->size();
 
     std::random_device random_device;
 
@@ -118,14 +141,16 @@ point kmeans_plus_plus::get_first_center(void) const {
     std::uniform_int_distribution<std::size_t> distribution(0, length - 1);
 
     std::size_t index = distribution(generator);
-    return m_indexes_ptr->empty() ? (*m_data_ptr)[index] : (*m_data_ptr)[ (*m_indexes_ptr)[index] ];
+    const auto & center = m_indexes_ptr->empty() ? p_data[index] : p_data[ (*m_indexes_ptr)[index] ];
+    return point(center.begin(), center.end());
 }
 
 
-point kmeans_plus_plus::get_next_center(void) const
+template <typename TypeData>
+point kmeans_plus_plus::get_next_center(const TypeData & p_data) const
 {
     std::vector<double> distances;
-    calculate_shortest_distances(distances);
+    calculate_shortest_distances(p_data, distances);
 
     std::size_t index = 0;
     if (m_candidates == FARTHEST_CENTER_CANDIDATE) {
@@ -139,24 +164,26 @@ point kmeans_plus_plus::get_next_center(void) const
     }
 
 
-    return m_indexes_ptr->empty() ? (*m_data_ptr)[index] : (*m_data_ptr)[ (*m_indexes_ptr)[index] ];
+    const auto & center = m_indexes_ptr->empty() ? p_data[index] : p_data[ (*m_indexes_ptr)[index] ];
+    return point(center.begin(), center.end());
 }
 
 
-void kmeans_plus_plus::calculate_shortest_distances(std::vector<double> & p_distances) const
+template <typename TypeData>
+void kmeans_plus_plus::calculate_shortest_distances(const TypeData & p_data, std::vector<double> & p_distances) const
 {
-    p_distances.reserve(m_data_ptr->size());
+    p_distances.reserve(p_data.size());
 
     if (m_indexes_ptr->empty())
     {
-        for (auto & point : (*m_data_ptr)) {
-            double shortest_distance = get_shortest_distance(point);
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            double shortest_distance = get_shortest_distance(p_data[index]);
             p_distances.push_back(shortest_distance);
         }
     }
     else {
         for (auto index : (*m_indexes_ptr)) {
-            double shortest_distance = get_shortest_distance((*m_data_ptr)[index]);
+            double shortest_distance = get_shortest_distance(p_data[index]);
             p_distances.push_back(shortest_distance);
         }
     }
@@ -177,17 +204,31 @@ double kmeans_plus_plus::get_shortest_distance(const point & p_point) const {
 }
 
 
-void kmeans_plus_plus::calculate_probabilities(const std::vector<double> & p_distances, std::vector<double> & p_probabilities) const {
-    double sum = std::accumulate(p_distances.begin(), p_distances.end(), 0.0);
+double kmeans_plus_plus::get_shortest_distance(const container::point_view & p_point) const {
+    if (!m_euclidean) {
+        return get_shortest_distance(point(p_point.begin(), p_point.end()));
+    }
+
+    double shortest_distance = std::numeric_limits<double>::max();
+    for (auto & center : (*m_centers_ptr)) {
+        const double distance = simd::euclidean_distance_square(p_point.data(), center.data(), p_point.size());
+        if (distance < shortest_distance) {
+            shortest_distance = distance;
+        }
+    }
+
+    return shortest_distance;
+}
 
-    p_probabilities.reserve(m_data_ptr->size());
-    double previous_probability = 0.0;
-    for (auto distance : p_distances) {
-        double current_probability = distance / sum;
 
-        p_probabilities.push_back( current_probability + previous_probability );
+void kmeans_plus_plus::calculate_probabilities(const std::vector<double> & p_distances, std::vector<double> & p_probabilities) const {
+    /* cumulative probabilities are prefix sums of distances that are normalized by total sum */
+    p_probabilities.resize(p_distances.size());
+    parallel_inclusive_scan(p_distances.begin(), p_distances.end(), p_probabilities.begin(), std::plus<double>(), PROBABILITY_SCAN_GRAIN);
 
-        previous_probability += current_probability;
+    const double sum = p_probabilities.back();
+    for (auto & probability : p_probabilities) {
+        probability /= sum;
     }
 
     p_probabilities.back() = 1.0;
@@ -26,6 +26,9 @@
 
 #include "cluster/center_initializer.hpp"
 #include "cluster/cluster_data.hpp"
+
+#include "container/dense_dataset.hpp"
+
 #include "utils/metric.hpp"
 
 
@@ -59,13 +62,17 @@ public:
      */
     using metric = distance_functor< std::vector<double> >;
 
+private:
+    /* amount of distances that are processed by one task during calculation of cumulative probabilities */
+    static const std::size_t PROBABILITY_SCAN_GRAIN;
+
 private:
     std::size_t         m_amount        = 0;
     std::size_t         m_candidates    = 0;
     metric              m_dist_func;
+    bool                m_euclidean     = true;     /* default metric is used, rows of dense dataset are not copied */
 
     /* temporal members that are used only during initialization */
-    mutable dataset const *           m_data_ptr      = nullptr;
     mutable index_sequence const *    m_indexes_ptr   = nullptr;
     mutable dataset const *           m_centers_ptr   = nullptr;
 
@@ -152,21 +159,35 @@ public:
     */
     void initialize(const dataset & p_data, const index_sequence & p_indexes, dataset & p_centers) const override;
 
+    /**
+    *
+    * @brief    Performs center initialization process for specific range of points that are stored in
+    *           contiguous buffer, points of the range are not copied.
+    *
+    * @param[in]  p_data: data for that centers are calculated.
+    * @param[in]  p_indexes: point indexes from data that are defines which points should be considered
+    *              during calculation process. If empty then all data points are considered.
+    * @param[out] p_centers: initialized centers for the specified data.
+    *
+    */
+    void initialize(const container::dense_dataset & p_data, const index_sequence & p_indexes, dataset & p_centers) const;
+
 private:
+    template <typename TypeData>
+    void initialize_centers(const TypeData & p_data, const index_sequence & p_indexes, dataset & p_centers) const;
+
     /**
     *
-    * @brief    Store pointers to data, indexes and centers to avoiding passing them between class methods.
+    * @brief    Store pointers to indexes and centers to avoiding passing them between class methods.
     * @details  Pointers are reseted when center initialization is over.
     *
-    * @param[in]  p_data: data for that centers are calculated.
+    * @param[in]  p_size: amount of points in data for that centers are calculated.
     * @param[in]  p_indexes: point indexes from data that are defines which points should be
     *              considered during calculation process.
     * @param[in]  p_centers: initialized centers for the specified data.
     *
-    * @return   The first initialized center.
-    *
     */
-    void store_temporal_params(const dataset & p_data, const index_sequence & p_indexes, const dataset & p_centers) const;
+    void store_temporal_params(const std::size_t p_size, const index_sequence & p_indexes, const dataset & p_centers) const;
 
     /**
     *
@@ -179,28 +200,36 @@ private:
     *
     * @brief    Calculates the first initial center using uniform distribution.
     *
+    * @param[in]  p_data: data for that centers are calculated.
+    *
     * @return   The first initialized center.
     *
     */
-    point get_first_center(void) const;
+    template <typename TypeData>
+    point get_first_center(const TypeData & p_data) const;
 
     /**
     *
     * @brief    Calculates the next most probable center in line with weighted distribution.
     *
+    * @param[in]  p_data: data for that centers are calculated.
+    *
     * @return   The next initialized center.
     *
     */
-    point get_next_center(void) const;
+    template <typename TypeData>
+    point get_next_center(const TypeData & p_data) const;
 
     /**
     *
     * @brief    Calculates distances from each point to closest center.
     *
+    * @param[in]  p_data: data for that centers are calculated.
     * @param[out] p_distances: the shortest distances from each point to center.
     *
     */
-    void calculate_shortest_distances(std::vector<double> & p_distances) const;
+    template <typename TypeData>
+    void calculate_shortest_distances(const TypeData & p_data, std::vector<double> & p_distances) const;
 
     /**
     *
@@ -211,6 +240,8 @@ private:
     */
     double get_shortest_distance(const point & p_point) const;
 
+    double get_shortest_distance(const container::point_view & p_point) const;
+
     /**
     *
     * @brief    Calculates center probability for each point using distances to closest centers.
@@ -20,12 +20,17 @@
 
 #include "cluster/kmedians.hpp"
 
+#include "parallel/parallel_algorithm.hpp"
+
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "utils/metric.hpp"
+#include "utils/metric_batch.hpp"
 
 
+using namespace ccore::parallel;
 using namespace ccore::utils::metric;
 
 
@@ -47,10 +52,16 @@ kmedians::kmedians(const dataset & initial_medians, const double tolerance, cons
 
 
 void kmedians::process(const dataset & data, cluster_data & output_result) {
-    m_ptr_data = &data;
+    const container::dense_dataset dense_data(data);
+    process(dense_data, output_result);
+}
+
+
+void kmedians::process(const container::dense_dataset & p_data, cluster_data & output_result) {
+    m_ptr_data = &p_data;
     m_ptr_result = (kmedians_data *) &output_result;
 
-    if (data[0].size() != m_initial_medians[0].size()) {
+    if (p_data.dimension() != m_initial_medians[0].size()) {
         throw std::invalid_argument("kmedians: dimension of the input data and dimension of the initial medians must be equal.");
     }
 
@@ -83,26 +94,42 @@ void kmedians::process(const dataset & data, cluster_data & output_result) {
 
 
 void kmedians::update_clusters(const dataset & medians, cluster_sequence & clusters) {
-    const dataset & data = *m_ptr_data;
+    const container::dense_dataset & data = *m_ptr_data;
 
     clusters.clear();
     clusters.resize(medians.size());
 
-    for (size_t index_point = 0; index_point < data.size(); index_point++) {
-        size_t index_cluster_optim = 0;
-        double distance_optim = std::numeric_limits<double>::max();
+    if (is_batch_assignment_supported(m_metric)) {
+        std::vector<std::size_t> labels;
+        find_nearest_centers(data, medians, labels);
 
-        for (size_t index_cluster = 0; index_cluster < medians.size(); index_cluster++) {
-            double distance = m_metric(data[index_point], medians[index_cluster]);
-            if (distance < distance_optim) {
-                index_cluster_optim = index_cluster;
-                distance_optim = distance;
-            }
+        for (std::size_t index_point = 0; index_point < labels.size(); index_point++) {
+            clusters[labels[index_point]].push_back(index_point);
         }
 
-        clusters[index_cluster_optim].push_back(index_point);
+        erase_empty_clusters(clusters);
+        return;
     }
 
+    visit_metric(m_metric, [&data, &medians, &clusters](const auto & p_metric) {
+        for (size_t index_point = 0; index_point < data.size(); index_point++) {
+            const container::point_view object = data.row(index_point);
+
+            size_t index_cluster_optim = 0;
+            double distance_optim = std::numeric_limits<double>::max();
+
+            for (size_t index_cluster = 0; index_cluster < medians.size(); index_cluster++) {
+                double distance = p_metric(object, medians[index_cluster]);
+                if (distance < distance_optim) {
+                    index_cluster_optim = index_cluster;
+                    distance_optim = distance;
+                }
+            }
+
+            clusters[index_cluster_optim].push_back(index_point);
+        }
+    });
+
     erase_empty_clusters(clusters);
 }
 
@@ -117,49 +144,53 @@ void kmedians::erase_empty_clusters(cluster_sequence & p_clusters) {
 
 
 double kmedians::update_medians(cluster_sequence & clusters, dataset & medians) {
-    const dataset & data = *m_ptr_data;
-    const size_t dimension = data[0].size();
+    const size_t dimension = m_ptr_data->dimension();
 
     std::vector<point> prev_medians(medians);
 
     medians.clear();
     medians.resize(clusters.size(), point(dimension, 0.0));
 
-    double maximum_change = 0.0;
-
-    for (size_t index_cluster = 0; index_cluster < clusters.size(); index_cluster++) {
-        calculate_median(clusters[index_cluster], medians[index_cluster]);
-
-        double change = m_metric(prev_medians[index_cluster], medians[index_cluster]);
-        if (change > maximum_change) {
-            maximum_change = change;
-        }
-    }
-
-    return maximum_change;
+    const auto maximum = [](const double p_change1, const double p_change2) { return std::max(p_change1, p_change2); };
+    return parallel_transform_reduce(std::size_t(0), clusters.size(), 0.0, maximum,
+        [this, &clusters, &medians, &prev_medians](const std::size_t p_index_cluster) {
+            calculate_median(clusters[p_index_cluster], medians[p_index_cluster]);
+            return m_metric(prev_medians[p_index_cluster], medians[p_index_cluster]);
+        });
 }
 
 
 void kmedians::calculate_median(cluster & current_cluster, point & median) {
-    const dataset & data = *m_ptr_data;
-    const std::size_t dimension = data[0].size();
+    const container::dense_dataset & data = *m_ptr_data;
+    const std::size_t dimension = data.dimension();
+
+    /* order does not depend on dimension, therefore objects are sorted once, equal objects are ordered by index */
+    parallel_sort(current_cluster.begin(), current_cluster.end(),
+        [&data](std::size_t index_object1, std::size_t index_object2)
+    {
+        const container::point_view object1 = data.row(index_object1);
+        const container::point_view object2 = data.row(index_object2);
+
+        if (std::lexicographical_compare(object2.begin(), object2.end(), object1.begin(), object1.end())) {
+            return true;
+        }
+        else if (std::lexicographical_compare(object1.begin(), object1.end(), object2.begin(), object2.end())) {
+            return false;
+        }
 
-    for (size_t index_dimension = 0; index_dimension < dimension; index_dimension++) {
-        std::sort(current_cluster.begin(), current_cluster.end(), 
-            [this](std::size_t index_object1, std::size_t index_object2) 
-        {
-            return (*m_ptr_data)[index_object1] > (*m_ptr_data)[index_object2];
-        });
+        return index_object1 < index_object2;
+    });
 
+    for (size_t index_dimension = 0; index_dimension < dimension; index_dimension++) {
         size_t relative_index_median = (size_t) floor((current_cluster.size() - 1) / 2.0);
         size_t index_median = current_cluster[relative_index_median];
 
         if (current_cluster.size() % 2 == 0) {
             size_t index_median_second = current_cluster[relative_index_median + 1];
-            median[index_dimension] = (data[index_median][index_dimension] + data[index_median_second][index_dimension]) / 2.0;
+            median[index_dimension] = (data.at(index_median, index_dimension) + data.at(index_median_second, index_dimension)) / 2.0;
         }
         else {
-            median[index_dimension] = data[index_median][index_dimension];
+            median[index_dimension] = data.at(index_median, index_dimension);
         }
     }
 }
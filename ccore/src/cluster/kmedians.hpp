@@ -54,7 +54,7 @@ private:
 
     kmedians_data         * m_ptr_result        = nullptr;   /* temporary pointer to output result */
 
-    const dataset         * m_ptr_data          = nullptr;     /* used only during processing */
+    const container::dense_dataset  * m_ptr_data    = nullptr;     /* used only during processing */
 
     distance_metric<point>  m_metric;
 
@@ -99,6 +99,16 @@ public:
     */
     void process(const dataset & data, cluster_data & output_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
 private:
     /**
     *
@@ -25,8 +25,13 @@
 
 #include "parallel/parallel.hpp"
 
+#include "utils/statistics.hpp"
+#include "utils/trace.hpp"
+
 
 using namespace ccore::parallel;
+using namespace ccore::utils::statistics;
+using namespace ccore::utils::trace;
 
 
 namespace ccore {
@@ -36,6 +41,8 @@ namespace clst {
 
 const std::size_t kmedoids::OBJECT_ALREADY_CONTAINED = std::numeric_limits<std::size_t>::max();
 
+const std::size_t kmedoids::MEDOID_CANDIDATE_GRAIN = 4;
+
 
 kmedoids::kmedoids(const medoid_sequence & p_initial_medoids,
                    const double p_tolerance,
@@ -57,35 +64,100 @@ void kmedoids::process(const dataset & p_data, cluster_data & p_result) {
 
 
 void kmedoids::process(const dataset & p_data, const kmedoids_data_t p_type, cluster_data & p_result) {
+    if (p_type == kmedoids_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);     /* rows are not copied */
+    }
+    else {
+        process(container::dense_dataset(p_data), p_type, p_result);
+    }
+}
+
+
+void kmedoids::process(const container::dense_dataset & p_data, cluster_data & p_result) {
+    process(p_data, kmedoids_data_t::POINTS, p_result);
+}
+
+
+void kmedoids::process(const container::dense_dataset & p_data, const kmedoids_data_t p_type, cluster_data & p_result) {
+    if (p_type == kmedoids_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);     /* rows are not copied */
+        return;
+    }
+
+    if (p_type != kmedoids_data_t::POINTS) {
+        throw std::invalid_argument("Unknown type data is specified");
+    }
+
     m_data_ptr = &p_data;
     m_result_ptr = (kmedoids_data *) &p_result;
-    m_calculator = create_distance_calculator(p_type);
 
+    visit_metric(m_metric, [this](const auto & p_metric) {
+        const container::dense_dataset & data = *m_data_ptr;
+        process_iterations(data.size(), [&data, &p_metric](const std::size_t index1, const std::size_t index2) {
+            return p_metric(data.row(index1), data.row(index2));
+        });
+    });
+
+    m_data_ptr = nullptr;
+    m_result_ptr = nullptr;
+}
+
+
+void kmedoids::process(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result) {
+    process_distance_matrix(p_matrix, p_result);
+}
+
+
+void kmedoids::process(const container::pairwise_distance_matrix<float> & p_matrix, cluster_data & p_result) {
+    process_distance_matrix(p_matrix, p_result);
+}
+
+
+template <typename TypeValue>
+void kmedoids::process_distance_matrix(const container::pairwise_distance_matrix<TypeValue> & p_matrix, cluster_data & p_result) {
+    m_result_ptr = (kmedoids_data *) &p_result;
+
+    process_iterations(p_matrix.size(), [&p_matrix](const std::size_t index1, const std::size_t index2) {
+        return (double) p_matrix(index1, index2);
+    });
+
+    m_result_ptr = nullptr;
+}
+
+
+template <typename TypeCalculator>
+void kmedoids::process_iterations(const std::size_t p_size, const TypeCalculator & p_calculator) {
     medoid_sequence & medoids = m_result_ptr->medoids();
     medoids.assign(m_initial_medoids.begin(), m_initial_medoids.end());
 
+    statistics_collector collector(m_result_ptr->statistics(), m_result_ptr->is_statistics_enabled());
+    trace_scope trace("kmedoids", "algorithm");
+
     double changes = 0.0;
     do {
-        update_clusters();
+        statistics_collector::increment(counter_t::ITERATIONS);
+
+        update_clusters(p_size, p_calculator);
 
         std::vector<size_t> updated_medoids;
-        calculate_medoids(updated_medoids);
+        calculate_medoids(p_calculator, updated_medoids);
 
-        changes = calculate_changes(updated_medoids);
+        changes = calculate_changes(updated_medoids, p_calculator);
 
         medoids.swap(updated_medoids);
     }
     while (changes > m_tolerance);
-
-    m_data_ptr = nullptr;
-    m_result_ptr = nullptr;
 }
 
 
-void kmedoids::update_clusters(void) {
+template <typename TypeCalculator>
+void kmedoids::update_clusters(const std::size_t p_size, const TypeCalculator & p_calculator) {
     cluster_sequence & clusters = m_result_ptr->clusters();
     medoid_sequence & medoids = m_result_ptr->medoids();
 
+    phase_timer timer(phase_t::UPDATE_CLUSTERS);
+    statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, p_size * medoids.size());
+
     clusters.clear();
     clusters.resize(medoids.size());
 
@@ -93,12 +165,12 @@ void kmedoids::update_clusters(void) {
         clusters[i].push_back(medoids[i]);
     }
 
-    std::vector<std::size_t> cluster_markers(m_data_ptr->size());
-    parallel_for(std::size_t(0), m_data_ptr->size(), [this, &medoids, &cluster_markers](const std::size_t p_index) {
-        cluster_markers[p_index] = find_appropriate_cluster(p_index, medoids);
+    std::vector<std::size_t> cluster_markers(p_size);
+    parallel_for(std::size_t(0), p_size, [this, &medoids, &cluster_markers, &p_calculator](const std::size_t p_index) {
+        cluster_markers[p_index] = find_appropriate_cluster(p_index, medoids, p_calculator);
     });
 
-    for (std::size_t index_point = 0; index_point < m_data_ptr->size(); index_point++) {
+    for (std::size_t index_point = 0; index_point < p_size; index_point++) {
         const std::size_t index_optim = cluster_markers[index_point];
         if (index_optim != OBJECT_ALREADY_CONTAINED) {
             clusters[index_optim].push_back(index_point);
@@ -107,45 +179,67 @@ void kmedoids::update_clusters(void) {
 }
 
 
-void kmedoids::calculate_medoids(cluster & p_medoids) {
+template <typename TypeCalculator>
+void kmedoids::calculate_medoids(const TypeCalculator & p_calculator, cluster & p_medoids) {
     cluster_sequence & clusters = m_result_ptr->clusters();
 
+    phase_timer timer(phase_t::UPDATE_CENTERS);
+
     p_medoids.clear();
     p_medoids.resize(clusters.size());
 
-    parallel_for(std::size_t(0), clusters.size(), [this, &p_medoids, &clusters](const std::size_t index) {
-        p_medoids[index] = calculate_cluster_medoid(clusters[index]);
-    });
-}
+    /* Candidates of all clusters are processed by one loop because cost of cluster is quadratic to its size and
+       one large cluster would occupy a single thread for the most part of the iteration. */
+    std::vector<std::size_t> cluster_offsets(clusters.size() + 1, 0);
+    for (std::size_t index = 0; index < clusters.size(); index++) {
+        cluster_offsets[index + 1] = cluster_offsets[index] + clusters[index].size();
+        statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, clusters[index].size() * clusters[index].size());
+    }
 
+    std::vector<double> candidate_distances(cluster_offsets.back());
+    parallel_for(std::size_t(0), candidate_distances.size(), [this, &clusters, &cluster_offsets, &candidate_distances, &p_calculator](const std::size_t p_index) {
+        const std::size_t index_cluster = std::upper_bound(cluster_offsets.begin(), cluster_offsets.end(), p_index) - cluster_offsets.begin() - 1;
+        const cluster & current_cluster = clusters[index_cluster];
+        const std::size_t index_candidate = current_cluster[p_index - cluster_offsets[index_cluster]];
 
-size_t kmedoids::calculate_cluster_medoid(const cluster & p_cluster) const {
-    size_t index_medoid = 0;
-    double distance = std::numeric_limits<double>::max();
+        candidate_distances[p_index] = calculate_candidate_distance(current_cluster, index_candidate, p_calculator);
+    }, schedule(schedule_policy::GUIDED, MEDOID_CANDIDATE_GRAIN));
 
-    for (auto index_candidate : p_cluster) {
-        double distance_candidate = 0.0;
-        for (auto index_point : p_cluster) {
-            distance_candidate += m_calculator(index_point, index_candidate);
-        }
+    for (std::size_t index = 0; index < clusters.size(); index++) {
+        std::size_t index_medoid = 0;
+        double distance = std::numeric_limits<double>::max();
 
-        if (distance_candidate < distance) {
-            index_medoid = index_candidate;
-            distance = distance_candidate;
+        for (std::size_t index_candidate = cluster_offsets[index]; index_candidate < cluster_offsets[index + 1]; index_candidate++) {
+            if (candidate_distances[index_candidate] < distance) {
+                index_medoid = clusters[index][index_candidate - cluster_offsets[index]];
+                distance = candidate_distances[index_candidate];
+            }
         }
+
+        p_medoids[index] = index_medoid;
+    }
+}
+
+
+template <typename TypeCalculator>
+double kmedoids::calculate_candidate_distance(const cluster & p_cluster, const std::size_t p_candidate, const TypeCalculator & p_calculator) const {
+    double distance = 0.0;
+    for (auto index_point : p_cluster) {
+        distance += p_calculator(index_point, p_candidate);
     }
 
-    return index_medoid;
+    return distance;
 }
 
 
-double kmedoids::calculate_changes(const medoid_sequence & p_medoids) const {
+template <typename TypeCalculator>
+double kmedoids::calculate_changes(const medoid_sequence & p_medoids, const TypeCalculator & p_calculator) const {
     double maximum_difference = 0.0;
     for (size_t index = 0; index < p_medoids.size(); index++) {
         const size_t index_point1 = p_medoids[index];
         const size_t index_point2 = m_result_ptr->medoids()[index];
 
-        const double distance = m_calculator(index_point1, index_point2);
+        const double distance = p_calculator(index_point1, index_point2);
         if (distance > maximum_difference) {
             maximum_difference = distance;
         }
@@ -155,34 +249,18 @@ double kmedoids::calculate_changes(const medoid_sequence & p_medoids) const {
 }
 
 
-kmedoids::distance_calculator kmedoids::create_distance_calculator(const kmedoids_data_t p_type) {
-    if (p_type == kmedoids_data_t::POINTS) {
-        return [this](const std::size_t index1, const std::size_t index2) {
-          return m_metric((*m_data_ptr)[index1], (*m_data_ptr)[index2]); 
-        };
-    }
-    else if (p_type == kmedoids_data_t::DISTANCE_MATRIX) {
-        return [this](const std::size_t index1, const std::size_t index2) {
-          return (*m_data_ptr)[index1][index2];
-        };
-    }
-    else {
-        throw std::invalid_argument("Unknown type data is specified");
-    }
-}
-
-
-std::size_t kmedoids::find_appropriate_cluster(const std::size_t p_index, medoid_sequence & p_medoids) {
+template <typename TypeCalculator>
+std::size_t kmedoids::find_appropriate_cluster(const std::size_t p_index, const medoid_sequence & p_medoids, const TypeCalculator & p_calculator) const {
     if (std::find(p_medoids.begin(), p_medoids.end(), p_index) != p_medoids.cend()) {
         return OBJECT_ALREADY_CONTAINED;
     }
 
     size_t index_optim = 0;
-    double dist_optim = m_calculator(p_index, p_medoids[index_optim]);
+    double dist_optim = p_calculator(p_index, p_medoids[index_optim]);
 
     for (size_t index = 1; index < p_medoids.size(); index++) {
         const size_t index_medoid = p_medoids[index];
-        const double distance = m_calculator(p_index, index_medoid);
+        const double distance = p_calculator(p_index, index_medoid);
 
         if (distance < dist_optim) {
             index_optim = index;
@@ -26,6 +26,8 @@
 #include "cluster/cluster_algorithm.hpp"
 #include "cluster/kmedoids_data.hpp"
 
+#include "container/pairwise_distance_matrix.hpp"
+
 #include "utils/metric.hpp"
 
 
@@ -54,11 +56,11 @@ class kmedoids : public cluster_algorithm {
 private:
     static const std::size_t OBJECT_ALREADY_CONTAINED;
 
-private:
-    using distance_calculator = std::function<double(const std::size_t, const std::size_t)>;
+    /* minimum amount of medoid candidates that are processed by one task, cost of candidate is defined by size of its cluster */
+    static const std::size_t MEDOID_CANDIDATE_GRAIN;
 
 private:
-    const dataset                   * m_data_ptr      = nullptr;   /* temporary pointer to input data that is used only during processing */
+    const container::dense_dataset  * m_data_ptr      = nullptr;   /* temporary pointer to input data that is used only during processing */
 
     kmedoids_data                   * m_result_ptr    = nullptr; /* temporary pointer to clustering result that is used only during processing */
 
@@ -68,8 +70,6 @@ private:
 
     distance_metric<point>          m_metric;
 
-    distance_calculator             m_calculator;
-
 public:
     /**
     *
@@ -122,55 +122,120 @@ public:
     */
     virtual void process(const dataset & p_data, const kmedoids_data_t p_type, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[in]  p_type: data type (points or distance matrix).
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, const kmedoids_data_t p_type, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis using precalculated distance matrix (condensed or square).
+    *
+    * @param[in]  p_matrix: distance matrix between objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis using precalculated distance matrix in single precision.
+    *
+    * @param[in]  p_matrix: distance matrix between objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::pairwise_distance_matrix<float> & p_matrix, cluster_data & p_result);
+
 private:
     /**
     *
-    * @brief    Updates clusters in line with current medoids.
+    * @brief    Performs cluster analysis using precalculated distance matrix of any precision.
+    *
+    * @param[in]  p_matrix: distance matrix between objects that should be clustered.
+    * @param[out] p_result: clustering result of an input data.
     *
     */
-    void update_clusters(void);
+    template <typename TypeValue>
+    void process_distance_matrix(const container::pairwise_distance_matrix<TypeValue> & p_matrix, cluster_data & p_result);
 
     /**
     *
-    * @brief    Calculates medoids in line with current clusters.
+    * @brief    Performs iterations of the algorithm using specified distance calculator.
+    * @details  Distance calculator is a callable object that returns distance between two objects by their
+    *           indexes, it is a template parameter to avoid indirect call per distance calculation.
     *
-    * @param[out] p_medoids: calculated medoids for current clusters.
+    * @param[in] p_size: amount of objects that are clustered.
+    * @param[in] p_calculator: distance calculator (based on metric policy or distance matrix).
     *
     */
-    void calculate_medoids(cluster & p_medoids);
+    template <typename TypeCalculator>
+    void process_iterations(const std::size_t p_size, const TypeCalculator & p_calculator);
 
     /**
     *
-    * @brief    Calculates medoid for specified cluster.
+    * @brief    Updates clusters in line with current medoids.
+    *
+    * @param[in] p_size: amount of objects that are clustered.
+    * @param[in] p_calculator: distance calculator.
     *
-    * @param[in] p_cluster: cluster that is used for medoid calculation.
+    */
+    template <typename TypeCalculator>
+    void update_clusters(const std::size_t p_size, const TypeCalculator & p_calculator);
+
+    /**
     *
-    * @return   Medoid (index point) of specified cluster.
+    * @brief    Calculates medoids in line with current clusters.
+    *
+    * @param[in] p_calculator: distance calculator.
+    * @param[out] p_medoids: calculated medoids for current clusters.
     *
     */
-    size_t calculate_cluster_medoid(const cluster & p_cluster) const;
+    template <typename TypeCalculator>
+    void calculate_medoids(const TypeCalculator & p_calculator, cluster & p_medoids);
 
     /**
     *
-    * @brief    Calculates maximum difference in data allocation between previous medoids and specified.
+    * @brief    Calculates total distance from medoid candidate to all points of its cluster.
     *
-    * @param[in] p_medoids: medoids that should be used for difference calculation.
+    * @param[in] p_cluster: cluster that contains the candidate.
+    * @param[in] p_candidate: index point of the candidate.
+    * @param[in] p_calculator: distance calculator.
     *
-    * @return   Maximum difference between current medoids and specified.
+    * @return   Sum of distances from the candidate to points of the cluster.
     *
     */
-    double calculate_changes(const medoid_sequence & p_medoids) const;
+    template <typename TypeCalculator>
+    double calculate_candidate_distance(const cluster & p_cluster, const std::size_t p_candidate, const TypeCalculator & p_calculator) const;
 
     /**
     *
-    * @brief    Creates distance calcultor in line with data type and distance metric metric.
+    * @brief    Calculates maximum difference in data allocation between previous medoids and specified.
     *
-    * @param[in] p_type: data type (points or distance matrix).
+    * @param[in] p_medoids: medoids that should be used for difference calculation.
+    * @param[in] p_calculator: distance calculator.
     *
-    * @return   Distance calculator.
+    * @return   Maximum difference between current medoids and specified.
     *
     */
-    distance_calculator create_distance_calculator(const kmedoids_data_t p_type);
+    template <typename TypeCalculator>
+    double calculate_changes(const medoid_sequence & p_medoids, const TypeCalculator & p_calculator) const;
 
     /**
     *
@@ -178,12 +243,14 @@ private:
     *
     * @param[in] p_index: Index of point that should be placed to cluster.
     * @param[in] p_medoids: Medoids that corresponds to clusters.
+    * @param[in] p_calculator: distance calculator.
     *
     * @return   Index of cluster that is appropriate for the particular point. If point is a medoid
     *           then OBJECT_ALREADY_CONTAINED value is returned.
     *
     */
-    std::size_t find_appropriate_cluster(const std::size_t p_index, medoid_sequence & p_medoids);
+    template <typename TypeCalculator>
+    std::size_t find_appropriate_cluster(const std::size_t p_index, const medoid_sequence & p_medoids, const TypeCalculator & p_calculator) const;
 };
 
 
@@ -35,18 +35,26 @@ mbsas::mbsas(const std::size_t p_amount,
 
 
 void mbsas::process(const dataset & p_data, cluster_data & p_result) {
+    process(container::dense_dataset(p_data), p_result);
+}
+
+
+void mbsas::process(const container::dense_dataset & p_data, cluster_data & p_result) {
     m_result_ptr = (mbsas_data *) &p_result;
 
+    const container::point_view first = p_data.row(0);
+
     m_result_ptr->clusters().push_back({ 0 });
-    m_result_ptr->representatives().push_back( p_data[0] );
+    m_result_ptr->representatives().emplace_back(first.begin(), first.end());
 
     std::vector<std::size_t> skipped_objects = { };
 
     for (std::size_t i = 1; i < p_data.size(); i++) {
-        auto nearest = find_nearest_cluster(p_data[i]);
+        const container::point_view object = p_data.row(i);
+        auto nearest = find_nearest_cluster(object);
 
         if ( (nearest.m_distance > m_threshold) && (m_result_ptr->clusters().size() < m_amount) ) {
-            m_result_ptr->representatives().push_back(p_data[i]);
+            m_result_ptr->representatives().emplace_back(object.begin(), object.end());
             m_result_ptr->clusters().push_back({ i });
         }
         else {
@@ -55,10 +63,11 @@ void mbsas::process(const dataset & p_data, cluster_data & p_result) {
     }
 
     for (auto index : skipped_objects) {
-        auto nearest = find_nearest_cluster(p_data[index]);
+        const container::point_view object = p_data.row(index);
+        auto nearest = find_nearest_cluster(object);
 
         m_result_ptr->clusters().at(nearest.m_index).push_back(index);
-        update_representative(nearest.m_index, p_data[index]);
+        update_representative(nearest.m_index, object);
     }
 }
 
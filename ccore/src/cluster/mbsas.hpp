@@ -53,6 +53,16 @@ public:
     *
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
 };
 
 
@@ -23,10 +23,19 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <stdexcept>
 #include <string>
 
 #include "ordering_analyser.hpp"
 
+#include "parallel/parallel.hpp"
+
+#include "utils/statistics.hpp"
+
+
+using namespace ccore::parallel;
+using namespace ccore::utils::statistics;
+
 
 namespace ccore {
 
@@ -55,10 +64,88 @@ void optics::process(const dataset & p_data, cluster_data & p_result) {
 
 
 void optics::process(const dataset & p_data, const optics_data_t p_type, cluster_data & p_result) {
-    m_data_ptr    = &p_data;
+    if (p_type == optics_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);     /* rows are not copied */
+    }
+    else {
+        process(container::dense_dataset(p_data), p_type, p_result);
+    }
+}
+
+
+void optics::process(const container::dense_dataset & p_data, cluster_data & p_result) {
+    process(p_data, optics_data_t::POINTS, p_result);
+}
+
+
+void optics::process(const container::dense_dataset & p_data, const optics_data_t p_type, cluster_data & p_result) {
+    if (p_type == optics_data_t::DISTANCE_MATRIX) {
+        process_distance_matrix(container::pairwise_distance_matrix<double>(p_data), p_result);
+        return;
+    }
+
     m_result_ptr  = (optics_data *) &p_result;
     m_type        = p_type;
 
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
+    const container::neighbor_searcher searcher(p_data, m_index, m_metric);
+    m_searcher_ptr = &searcher;
+
+    process_objects();
+
+    m_searcher_ptr = nullptr;
+    m_result_ptr  = nullptr;
+}
+
+
+void optics::process_distance_matrix(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result) {
+    m_result_ptr  = (optics_data *) &p_result;
+    m_type        = optics_data_t::DISTANCE_MATRIX;
+    m_matrix_ptr  = &p_matrix;
+
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
+    process_objects();
+
+    m_matrix_ptr  = nullptr;
+    m_result_ptr  = nullptr;
+}
+
+
+void optics::process(const container::neighbor_graph & p_graph, cluster_data & p_result) {
+    m_result_ptr  = (optics_data *) &p_result;
+    m_type        = optics_data_t::POINTS;
+
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
+    process_graph(p_graph);
+
+    m_result_ptr  = nullptr;
+}
+
+
+void optics::process_graph(const container::neighbor_graph & p_graph) {
+    if (!p_graph.has_distances()) {
+        throw std::invalid_argument("CCORE [optics]: neighbor graph does not contain distances.");
+    }
+
+    if (p_graph.get_radius() < m_radius) {
+        throw std::invalid_argument("CCORE [optics]: radius of neighbor graph '" + std::to_string(p_graph.get_radius()) + 
+            "' is less than connectivity radius '" + std::to_string(m_radius) + "'.");
+    }
+
+    m_graph_ptr = &p_graph;
+
+    calculate_core_distances();     /* the second pass uses smaller radius, therefore they are calculated once */
+    process_objects();
+
+    m_core_distances.clear();
+    m_graph_ptr = nullptr;
+}
+
+
+void optics::process_objects(void) {
     calculate_cluster_result();
 
     if ( (m_amount_clusters > 0) && (m_amount_clusters != m_result_ptr->clusters().size()) ) {
@@ -71,13 +158,32 @@ void optics::process(const dataset & p_data, const optics_data_t p_type, cluster
     }
 
     m_result_ptr->set_radius(m_radius);
+}
 
-    m_data_ptr    = nullptr;
-    m_result_ptr  = nullptr;
+
+void optics::set_spatial_index(const container::spatial_index_t p_index) {
+    m_index = p_index;
+}
+
+
+container::spatial_index_t optics::get_spatial_index(void) const {
+    return m_index;
+}
+
+
+void optics::set_metric(const utils::metric::distance_metric<point> & p_metric) {
+    m_metric = p_metric;
+}
+
+
+const utils::metric::distance_metric<point> & optics::get_metric(void) const {
+    return m_metric;
 }
 
 
 void optics::calculate_cluster_result(void) {
+    statistics_collector::increment(counter_t::ITERATIONS);
+
     initialize();
     allocate_clusters();
     calculate_ordering();
@@ -85,15 +191,19 @@ void optics::calculate_cluster_result(void) {
 
 
 void optics::initialize(void) {
-    if (m_type == optics_data_t::POINTS) {
-        create_kdtree();
+    std::size_t amount_objects = 0;
+    if (m_graph_ptr != nullptr) {
+        amount_objects = m_graph_ptr->size();
+    }
+    else {
+        amount_objects = (m_type == optics_data_t::POINTS) ? m_searcher_ptr->size() : m_matrix_ptr->size();
     }
 
     m_optics_objects = &(m_result_ptr->optics_objects());
     if (m_optics_objects->empty()) {
-        m_optics_objects->reserve(m_data_ptr->size());
+        m_optics_objects->reserve(amount_objects);
 
-        for (std::size_t i = 0; i < m_data_ptr->size(); i++) {
+        for (std::size_t i = 0; i < amount_objects; i++) {
             m_optics_objects->emplace_back(i, optics::NONE_DISTANCE, optics::NONE_DISTANCE);
         }
     }
@@ -128,10 +238,8 @@ void optics::expand_cluster_order(optics_descriptor & p_object) {
 
     m_ordered_database.push_back(&p_object);
 
-    if (neighbors.size() >= m_neighbors) {
-        std::sort(neighbors.begin(), neighbors.end(), [](const auto & a, const auto & b) { return std::get<1>(a) < std::get<1>(b); });
-        p_object.m_core_distance = std::get<1>(neighbors[m_neighbors - 1]);
-
+    p_object.m_core_distance = get_core_distance(p_object.m_index, neighbors);
+    if (p_object.m_core_distance != optics::NONE_DISTANCE) {
         std::list<optics_descriptor *> order_seed;
         update_order_seed(p_object, neighbors, order_seed);
 
@@ -145,22 +253,31 @@ void optics::expand_cluster_order(optics_descriptor & p_object) {
 
             m_ordered_database.push_back(descriptor);
 
-            if (neighbors.size() >= m_neighbors) {
-                std::sort(neighbors.begin(), neighbors.end(), [](const auto & a, const auto & b) { return std::get<1>(a) < std::get<1>(b); });
-                descriptor->m_core_distance = std::get<1>(neighbors[m_neighbors - 1]);
-
+            descriptor->m_core_distance = get_core_distance(descriptor->m_index, neighbors);
+            if (descriptor->m_core_distance != optics::NONE_DISTANCE) {
                 update_order_seed(*descriptor, neighbors, order_seed);
             }
-            else {
-                descriptor->m_core_distance = optics::NONE_DISTANCE;
-            }
 
             order_seed_length = order_seed.size();
         }
     }
-    else {
-        p_object.m_core_distance = optics::NONE_DISTANCE;
+}
+
+
+double optics::get_core_distance(const std::size_t p_index, const neighbors_collection & p_neighbors) const {
+    if (p_neighbors.size() < m_neighbors) {
+        return optics::NONE_DISTANCE;
+    }
+
+    if (m_neighbors == 0) {
+        return 0.0;
+    }
+
+    if (m_graph_ptr != nullptr) {
+        return m_core_distances[p_index];
     }
+
+    return std::get<1>(p_neighbors[m_neighbors - 1]);     /* neighbors are sorted by distance */
 }
 
 
@@ -220,46 +337,66 @@ void optics::extract_clusters(void) {
 
 
 void optics::get_neighbors(const size_t p_index, neighbors_collection & p_neighbors) {
-    switch(m_type) {
-    case optics_data_t::POINTS:
-        get_neighbors_from_points(p_index, p_neighbors);
-        break;
+    if (m_graph_ptr != nullptr) {
+        get_neighbors_from_graph(p_index, p_neighbors);
+    }
+    else {
+        phase_timer timer(phase_t::NEIGHBOR_SEARCH);
+        statistics_collector::increment(counter_t::NEIGHBOR_QUERIES);
 
-    case optics_data_t::DISTANCE_MATRIX:
-        get_neighbors_from_distance_matrix(p_index, p_neighbors);
-        break;
+        switch(m_type) {
+        case optics_data_t::POINTS:
+            get_neighbors_from_points(p_index, p_neighbors);
+            break;
 
-    default:
-        throw std::invalid_argument("Incorrect input data type is specified '" + std::to_string((unsigned) m_type) + "'");
+        case optics_data_t::DISTANCE_MATRIX:
+            get_neighbors_from_distance_matrix(p_index, p_neighbors);
+            break;
+
+        default:
+            throw std::invalid_argument("Incorrect input data type is specified '" + std::to_string((unsigned) m_type) + "'");
+        }
     }
+
+    /* order of seeds with equal reachability distance depends on order of neighbors, therefore it should not depend on data source */
+    std::sort(p_neighbors.begin(), p_neighbors.end(), [](const auto & a, const auto & b) {
+        return (std::get<1>(a) < std::get<1>(b)) || ((std::get<1>(a) == std::get<1>(b)) && (std::get<0>(a) < std::get<0>(b)));
+    });
 }
 
 
 void optics::get_neighbors_from_points(const std::size_t p_index, neighbors_collection & p_neighbors) {
     p_neighbors.clear();
 
-    container::kdtree_searcher searcher((*m_data_ptr)[p_index], m_kdtree.get_root(), m_radius);
+    m_searcher_ptr->find_neighbors(p_index, m_radius, [&p_neighbors](const std::size_t p_neighbor, const double p_distance) {
+        p_neighbors.push_back(std::make_tuple(p_neighbor, p_distance));
+    });
+}
 
-    container::kdtree_searcher::rule_store rule = [&p_index, &p_neighbors](const container::kdnode::ptr & p_node, const double p_distance) {
-            if (p_index != (std::size_t) p_node->get_payload()) {
-                p_neighbors.push_back(std::make_tuple((std::size_t) p_node->get_payload(), std::sqrt(p_distance)));
-            }
-        };
 
-    searcher.find_nearest(rule);
+void optics::get_neighbors_from_graph(const std::size_t p_index, neighbors_collection & p_neighbors) {
+    p_neighbors.clear();
+
+    const std::vector<std::size_t> & offsets = m_graph_ptr->get_offsets();
+    const std::vector<std::size_t> & indexes = m_graph_ptr->get_indexes();
+    const std::vector<double> & distances = m_graph_ptr->get_distances();
+
+    for (std::size_t position = offsets[p_index]; position < offsets[p_index + 1]; position++) {
+        if (distances[position] <= m_radius) {
+            p_neighbors.push_back(std::make_tuple(indexes[position], distances[position]));
+        }
+    }
 }
 
 
 void optics::get_neighbors_from_distance_matrix(const std::size_t p_index, neighbors_collection & p_neighbors) {
     p_neighbors.clear();
 
-    const auto & distances = m_data_ptr->at(p_index);
-    for (std::size_t index_neighbor = 0; index_neighbor < distances.size(); index_neighbor++) {
-        const double candidate_distance = distances[index_neighbor];
-        if ( (candidate_distance <= m_radius) && (index_neighbor != p_index) ) {
-            p_neighbors.push_back(std::make_tuple(index_neighbor, candidate_distance));
+    m_matrix_ptr->for_each_distance(p_index, [this, &p_neighbors](const std::size_t p_neighbor, const double p_distance) {
+        if (p_distance <= m_radius) {
+            p_neighbors.push_back(std::make_tuple(p_neighbor, p_distance));
         }
-    }
+    });
 }
 
 
@@ -280,12 +417,22 @@ void optics::calculate_ordering(void) {
 }
 
 
-void optics::create_kdtree(void) {
-    m_kdtree = container::kdtree();
+void optics::calculate_core_distances(void) {
+    const std::vector<std::size_t> & offsets = m_graph_ptr->get_offsets();
+    const std::vector<double> & distances = m_graph_ptr->get_distances();
 
-    for (std::size_t index = 0; index < m_data_ptr->size(); index++) {
-        m_kdtree.insert((*m_data_ptr)[index], (void *) index);
+    m_core_distances.assign(m_graph_ptr->size(), std::numeric_limits<double>::max());
+    if (m_neighbors == 0) {
+        return;
     }
+
+    parallel_for(std::size_t(0), m_graph_ptr->size(), [this, &offsets, &distances](const std::size_t p_index) {
+        if (offsets[p_index + 1] - offsets[p_index] >= m_neighbors) {
+            std::vector<double> neighbor_distances(distances.begin() + offsets[p_index], distances.begin() + offsets[p_index + 1]);
+            std::nth_element(neighbor_distances.begin(), neighbor_distances.begin() + m_neighbors - 1, neighbor_distances.end());
+            m_core_distances[p_index] = neighbor_distances[m_neighbors - 1];
+        }
+    });
 }
 
 
@@ -25,7 +25,9 @@
 #include <list>
 #include <tuple>
 
-#include "container/kdtree.hpp"
+#include "container/neighbor_graph.hpp"
+#include "container/pairwise_distance_matrix.hpp"
+#include "container/spatial_index.hpp"
 
 #include "cluster/cluster_algorithm.hpp"
 #include "cluster/optics_data.hpp"
@@ -65,7 +67,7 @@ private:
     using neighbors_collection = std::vector< std::tuple<std::size_t, double> >;
 
 private:
-    const dataset       * m_data_ptr        = nullptr;
+    const container::pairwise_distance_matrix<double> * m_matrix_ptr = nullptr;   /* distance matrix that is used only during processing */
 
     optics_data         * m_result_ptr      = nullptr;
 
@@ -77,7 +79,15 @@ private:
 
     optics_data_t       m_type              = optics_data_t::POINTS;
 
-    container::kdtree   m_kdtree            = container::kdtree();
+    container::spatial_index_t  m_index     = container::spatial_index_t::KDTREE_STATIC;
+
+    utils::metric::distance_metric<point>   m_metric = utils::metric::distance_metric_factory<point>::euclidean();
+
+    const container::neighbor_searcher *    m_searcher_ptr = nullptr;   /* spatial index of points that is used only during processing */
+
+    const container::neighbor_graph *   m_graph_ptr = nullptr;  /* neighborhood of points that is used only during processing */
+
+    std::vector<double> m_core_distances    = { };  /* distances to the k-th neighbor in case of neighborhood graph */
 
     optics_object_sequence *            m_optics_objects    = nullptr;
 
@@ -160,7 +170,78 @@ public:
     */
     virtual void process(const dataset & p_data, const optics_data_t p_type, cluster_data & p_result);
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters,
+    *              cluster-ordering, noise and proper connectivity radius).
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
+    /**
+    *
+    * @brief    Performs cluster analysis of specific input data (points or distance matrix) that is stored
+    *            in contiguous buffer.
+    * @details  Neighbors of each point are searched by the spatial index when the point is processed, therefore
+    *            memory does not depend on amount of neighbors. Neighborhood graph can be built in parallel and
+    *            processed instead when it is reused or memory for all neighbors is acceptable, see 'neighbor_graph'.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[in]  p_type: type of input data (points or distance matrix).
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters,
+    *              cluster-ordering, noise and proper connectivity radius).
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, const optics_data_t p_type, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Performs cluster analysis using precalculated radius neighborhood graph of points.
+    * @details  Neighbors that are farther than connectivity radius are ignored, therefore the graph can be reused
+    *            with smaller radius and different amount of neighbors.
+    *
+    * @param[in]  p_graph: neighborhood graph with distances, its radius should not be less than connectivity radius.
+    * @param[out] p_result: clustering result of an input data (consists of allocated clusters,
+    *              cluster-ordering, noise and proper connectivity radius).
+    *
+    */
+    virtual void process(const container::neighbor_graph & p_graph, cluster_data & p_result);
+
+    /**
+    *
+    * @brief    Defines spatial index that is used to find neighbors of points, static k-d tree is used by default.
+    *
+    * @param[in]  p_index: spatial index that should be used by following processing.
+    *
+    */
+    void set_spatial_index(const container::spatial_index_t p_index);
+
+    container::spatial_index_t get_spatial_index(void) const;
+
+    /**
+    *
+    * @brief    Defines metric that is used to find neighbors of points, Euclidean metric is used by default.
+    * @details  Only VP-tree supports non-Euclidean metrics, therefore spatial index should be changed to
+    *            'spatial_index_t::VPTREE' before processing, otherwise exception 'std::invalid_argument' is thrown.
+    *            Distance matrix is processed without metric.
+    *
+    * @param[in]  p_metric: metric that satisfies the triangle inequality.
+    *
+    */
+    void set_metric(const utils::metric::distance_metric<point> & p_metric);
+
+    const utils::metric::distance_metric<point> & get_metric(void) const;
+
 private:
+    void process_graph(const container::neighbor_graph & p_graph);
+
+    void process_distance_matrix(const container::pairwise_distance_matrix<double> & p_matrix, cluster_data & p_result);
+
+    void process_objects(void);
+
     void initialize(void);
 
     void allocate_clusters(void);
@@ -173,15 +254,19 @@ private:
 
     void get_neighbors_from_points(const std::size_t p_index, neighbors_collection & p_neighbors);
 
+    void get_neighbors_from_graph(const std::size_t p_index, neighbors_collection & p_neighbors);
+
     void get_neighbors_from_distance_matrix(const std::size_t p_index, neighbors_collection & p_neighbors);
 
+    double get_core_distance(const std::size_t p_index, const neighbors_collection & p_neighbors) const;
+
     void update_order_seed(const optics_descriptor & p_object, const neighbors_collection & neighbors, std::list<optics_descriptor *> & order_seed);
 
     void calculate_ordering(void);
 
     void calculate_cluster_result(void);
 
-    void create_kdtree(void);
+    void calculate_core_distances(void);
 };
 
 
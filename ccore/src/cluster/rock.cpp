@@ -24,10 +24,15 @@
 #include <climits>
 #include <iostream>
 
+#include "parallel/execution_context.hpp"
+
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
 
 
+using namespace ccore::parallel;
 using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
 using namespace ccore::container;
 
 
@@ -56,6 +61,8 @@ rock::~rock(void) { }
 
 
 void rock::process(const dataset & p_data, cluster_data & p_result) {
+    statistics_collector collector(p_result.statistics(), p_result.is_statistics_enabled());
+
     create_adjacency_matrix(p_data);
 
     /* initialize first version of clusters */
@@ -63,10 +70,12 @@ void rock::process(const dataset & p_data, cluster_data & p_result) {
         m_clusters.push_back(cluster(1, index));
     }
 
-    while( (m_number_clusters < m_clusters.size()) && (merge_cluster()) ) { }
+    while( (m_number_clusters < m_clusters.size()) && !execution_context::is_cancellation_requested() && (merge_cluster()) ) {
+        statistics_collector::increment(counter_t::ITERATIONS);
+    }
 
     /* copy results to the output result (it much more optimal to store in list representation for ROCK algorithm) */
-    p_result = rock_data();
+    p_result.clusters().clear();
     p_result.clusters().insert(p_result.clusters().begin(), m_clusters.begin(), m_clusters.end());
 
     m_clusters.clear();         /* no need it anymore - clear to save memory */
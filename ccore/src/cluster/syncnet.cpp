@@ -73,6 +73,7 @@ void syncnet::create_connections(const double connectivity_radius, const bool en
     if (enable_conn_weight == true) {
         std::vector<double> instance(size(), 0);
         distance_conn_weights = new std::vector<std::vector<double> >(size(), instance);
+        distance_conn_weights_memory.reset(size() * (sizeof(std::vector<double>) + size() * sizeof(double)));
     }
     else {
         distance_conn_weights = nullptr;
@@ -25,6 +25,8 @@
 
 #include "nnet/sync.hpp"
 
+#include "utils/memory.hpp"
+
 
 using namespace ccore::nnet;
 
@@ -67,6 +69,7 @@ class syncnet: public sync_network {
 protected:
     std::vector<std::vector<double> >    * oscillator_locations;
     std::vector<std::vector<double> >    * distance_conn_weights;
+    utils::memory::memory_reservation     distance_conn_weights_memory;
     double                                connection_weight;
 
 public:
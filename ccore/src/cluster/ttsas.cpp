@@ -39,8 +39,13 @@ ttsas::ttsas(const double p_threshold1,
 
 
 void ttsas::process(const dataset & p_data, cluster_data & p_result) {
+    process(container::dense_dataset(p_data), p_result);
+}
+
+
+void ttsas::process(const container::dense_dataset & p_data, cluster_data & p_result) {
     m_result_ptr = (ttsas_data *) &p_result;
-    m_data_ptr = (dataset *) &p_data;
+    m_data_ptr = &p_data;
 
     m_amount = p_data.size();
     m_skipped_objects = std::vector<bool>(p_data.size(), true);
@@ -64,7 +69,7 @@ void ttsas::process_objects(const std::size_t p_changes) {
     }
 
     if (p_changes == 0.0) {
-        allocate_cluster(m_start, m_data_ptr->at(m_start));
+        allocate_cluster(m_start, m_data_ptr->row(m_start));
         m_start++;
     }
 
@@ -77,7 +82,7 @@ void ttsas::process_objects(const std::size_t p_changes) {
 
 
 void ttsas::process_skipped_object(const std::size_t p_index_point) {
-    const point & cur_point = m_data_ptr->at(p_index_point);
+    const container::point_view cur_point = m_data_ptr->row(p_index_point);
     const nearest_cluster nearest = find_nearest_cluster(cur_point);
 
     if (nearest.m_distance <= m_threshold) {
@@ -89,7 +94,7 @@ void ttsas::process_skipped_object(const std::size_t p_index_point) {
 }
 
 
-void ttsas::append_to_cluster(const std::size_t p_index_cluster, const std::size_t p_index_point, const point & p_point) {
+void ttsas::append_to_cluster(const std::size_t p_index_cluster, const std::size_t p_index_point, const container::point_view & p_point) {
     m_result_ptr->clusters()[p_index_cluster].push_back(p_index_point);
     update_representative(p_index_cluster, p_point);
 
@@ -98,9 +103,9 @@ void ttsas::append_to_cluster(const std::size_t p_index_cluster, const std::size
 }
 
 
-void ttsas::allocate_cluster(const std::size_t p_index_point, const point & p_point) {
+void ttsas::allocate_cluster(const std::size_t p_index_point, const container::point_view & p_point) {
     m_result_ptr->clusters().push_back({ p_index_point });
-    m_result_ptr->representatives().push_back(p_point);
+    m_result_ptr->representatives().emplace_back(p_point.begin(), p_point.end());
 
     m_amount--;
     m_skipped_objects[p_index_point] = false;
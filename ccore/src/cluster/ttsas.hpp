@@ -40,7 +40,7 @@ namespace clst {
 
 class ttsas : public bsas {
 private:
-    const dataset * m_data_ptr = nullptr;   /* temporary pointer to data - exists only during processing */
+    const container::dense_dataset * m_data_ptr = nullptr;   /* temporary pointer to data - exists only during processing */
 
     double          m_threshold2 = 0.0;
 
@@ -65,14 +65,24 @@ public:
     */
     virtual void process(const dataset & p_data, cluster_data & p_result) override;
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
 private:
     void process_objects(const std::size_t p_changes);
 
     void process_skipped_object(const std::size_t p_index_point);
 
-    void append_to_cluster(const std::size_t p_index_cluster, const std::size_t p_index_point, const point & p_point);
+    void append_to_cluster(const std::size_t p_index_cluster, const std::size_t p_index_point, const container::point_view & p_point);
 
-    void allocate_cluster(const std::size_t p_index_point, const point & p_point);
+    void allocate_cluster(const std::size_t p_index_point, const container::point_view & p_point);
 };
 
 
@@ -21,6 +21,7 @@
 
 
 #include <cmath>
+#include <functional>
 #include <future>
 #include <iostream>
 #include <limits>
@@ -32,13 +33,18 @@
 #include "cluster/kmeans_plus_plus.hpp"
 
 #include "parallel/parallel.hpp"
+#include "parallel/parallel_algorithm.hpp"
 
 #include "utils/math.hpp"
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
+#include "utils/trace.hpp"
 
 
 using namespace ccore::parallel;
 using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
+using namespace ccore::utils::trace;
 
 
 namespace ccore {
@@ -48,6 +54,8 @@ namespace clst {
 
 const double             xmeans::DEFAULT_SPLIT_DIFFERENCE                = 0.001;
 
+const std::size_t        xmeans::CRITERION_REDUCTION_GRAIN               = 1024;
+
 
 xmeans::xmeans(const dataset & p_centers, const std::size_t p_kmax, const double p_tolerance, const splitting_type p_criterion) :
     m_centers(p_centers),
@@ -63,19 +71,41 @@ xmeans::~xmeans(void) { }
 
 
 void xmeans::process(const dataset & data, cluster_data & output_result) {
-    m_ptr_data = &data;
+    const container::dense_dataset dense_data(data);
+    process(dense_data, output_result);
+}
+
+
+void xmeans::process(const container::dense_dataset & p_data, cluster_data & output_result) {
+    m_ptr_data = &p_data;
+
+    trace_scope trace("xmeans", "algorithm");
+
+    const bool statistics_enabled = output_result.is_statistics_enabled();
 
     output_result = xmeans_data();
+    output_result.enable_statistics(statistics_enabled);
     m_ptr_result = (xmeans_data *)&output_result;
 
+    statistics_collector collector(m_ptr_result->statistics(), statistics_enabled);
+
     m_ptr_result->centers() = m_centers;
 
     size_t current_number_clusters = m_ptr_result->centers().size();
     const index_sequence dummy;
 
     while (current_number_clusters <= m_maximum_clusters) {
-        improve_parameters(m_ptr_result->clusters(), m_ptr_result->centers(), dummy);
-        improve_structure();
+        {
+            trace_scope trace_parameters("improve_parameters", "algorithm");
+            improve_parameters(m_ptr_result->clusters(), m_ptr_result->centers(), dummy);
+        }
+
+        {
+            trace_scope trace_structure("improve_structure", "algorithm");
+            improve_structure();
+        }
+
+        statistics_collector::increment(counter_t::ITERATIONS);
 
         if (current_number_clusters == m_ptr_result->centers().size()) {
             break;
@@ -85,12 +115,14 @@ void xmeans::process(const dataset & data, cluster_data & output_result) {
     }
 
     improve_parameters(m_ptr_result->clusters(), m_ptr_result->centers(), dummy);
+
+    m_ptr_data = nullptr;
 }
 
 
 void xmeans::improve_parameters(cluster_sequence & improved_clusters, dataset & improved_centers, const index_sequence & available_indexes) {
     kmeans_data result;
-    kmeans(improved_centers, m_tolerance).process((*m_ptr_data), available_indexes, result);
+    kmeans(improved_centers, m_tolerance).process(*m_ptr_data, available_indexes, result);
 
     improved_centers = result.centers();
     improved_clusters = result.clusters();
@@ -132,13 +164,13 @@ void xmeans::improve_structure() {
 void xmeans::improve_region_structure(const cluster & p_cluster, const point & p_center, dataset & p_allocated_centers) {
     /* in case of cluster with one object */
     if (p_cluster.size() == 1) {
-        std::size_t index_center = p_cluster[0];
-        p_allocated_centers.push_back((*m_ptr_data)[index_center]);
+        const container::point_view center = m_ptr_data->row(p_cluster[0]);
+        p_allocated_centers.emplace_back(center.begin(), center.end());
 
         return;
     }
 
-    /* initialize initial center using k-means++ */
+    /* initialize initial center using k-means++ on objects of the parent cluster */
     dataset parent_child_centers;
     kmeans_plus_plus(2U, kmeans_plus_plus::FARTHEST_CENTER_CANDIDATE).initialize(*m_ptr_data, p_cluster, parent_child_centers);
 
@@ -202,12 +234,19 @@ double xmeans::bayesian_information_criterion(const cluster_sequence & analysed_
     std::size_t K = analysed_centers.size();
     std::size_t N = 0;
 
-    for (std::size_t index_cluster = 0; index_cluster < analysed_clusters.size(); index_cluster++) {
-        for (auto & index_object : analysed_clusters[index_cluster]) {
-            sigma += euclidean_distance_square( (*m_ptr_data)[index_object], analysed_centers[index_cluster] );
-        }
+    sigma = parallel_transform_reduce(std::size_t(0), analysed_clusters.size(), 0.0, std::plus<double>(),
+        [this, &analysed_clusters, &analysed_centers](const std::size_t p_index_cluster) {
+            const cluster & current_cluster = analysed_clusters[p_index_cluster];
+            const point & current_center = analysed_centers[p_index_cluster];
 
-        N += analysed_clusters[index_cluster].size();
+            return parallel_transform_reduce(std::size_t(0), current_cluster.size(), 0.0, std::plus<double>(),
+                [this, &current_cluster, &current_center](const std::size_t p_position) {
+                    return euclidean_distance_square(m_ptr_data->row(current_cluster[p_position]), current_center);
+                }, CRITERION_REDUCTION_GRAIN);
+        });
+
+    for (const auto & current_cluster : analysed_clusters) {
+        N += current_cluster.size();
     }
 
     if (N - K > 0) {
@@ -243,13 +282,17 @@ double xmeans::minimum_noiseless_description_length(const cluster_sequence & clu
             return std::numeric_limits<double>::max();
         }
 
-        double Ni = (double) clusters[index_cluster].size();
-        double Wi = 0.0;
-        for (auto & index_object : clusters[index_cluster]) {
-            /* euclidean_distance_square should be used in line with paper, but in this case results are
-             * very poor, therefore square root is used to improved. */
-            Wi += euclidean_distance((*m_ptr_data)[index_object], centers[index_cluster]);
-        }
+        const cluster & current_cluster = clusters[index_cluster];
+        const point & current_center = centers[index_cluster];
+
+        double Ni = (double) current_cluster.size();
+
+        /* euclidean_distance_square should be used in line with paper, but in this case results are
+         * very poor, therefore square root is used to improved. */
+        double Wi = parallel_transform_reduce(std::size_t(0), current_cluster.size(), 0.0, std::plus<double>(),
+            [this, &current_cluster, &current_center](const std::size_t p_position) {
+                return euclidean_distance(m_ptr_data->row(current_cluster[p_position]), current_center);
+            }, CRITERION_REDUCTION_GRAIN);
 
         sigma_sqrt += Wi;
         W += Wi / Ni;
@@ -47,12 +47,15 @@ public:
 private:
     const static double             DEFAULT_SPLIT_DIFFERENCE;
 
+    /* amount of points that are processed by one task during calculation of splitting criterion */
+    const static std::size_t        CRITERION_REDUCTION_GRAIN;
+
 private:
     dataset           m_centers;
 
     xmeans_data       * m_ptr_result        = nullptr;   /* temporary pointer to output result */
 
-    const dataset     * m_ptr_data          = nullptr;     /* used only during processing */
+    const container::dense_dataset  * m_ptr_data    = nullptr;     /* used only during processing */
 
     std::size_t       m_maximum_clusters;
 
@@ -93,6 +96,16 @@ public:
     */
     virtual void process(const dataset & data, cluster_data & output_result) override;
 
+    /**
+    *
+    * @brief    Performs cluster analysis of an input data that is stored in contiguous buffer.
+    *
+    * @param[in]  p_data: input data for cluster analysis.
+    * @param[out] p_result: clustering result of an input data.
+    *
+    */
+    virtual void process(const container::dense_dataset & p_data, cluster_data & p_result) override;
+
     /**
     *
     * @brief    Set custom trigger (that is defined by data size) for parallel processing,
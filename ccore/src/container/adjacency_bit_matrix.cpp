@@ -34,8 +34,12 @@ const size_t adjacency_bit_matrix::DEFAULT_NON_EXISTANCE_CONNECTION_VALUE = 0x00
 
 
 adjacency_bit_matrix::adjacency_bit_matrix(const size_t node_amount) { 
-    m_adjacency = adjacency_bit_matrix_container(node_amount, std::vector<size_t>(node_amount, 0));
+    const size_t element_bit_length = (sizeof(size_t) << 3);
+    const size_t amount_elements = (node_amount + element_bit_length - 1) / element_bit_length;
+
+    m_adjacency = adjacency_bit_matrix_container(node_amount, std::vector<size_t>(amount_elements, 0));
     m_size = node_amount;
+    m_memory.reset(node_amount * (sizeof(std::vector<size_t>) + amount_elements * sizeof(size_t)));
 }
 
 
@@ -79,6 +83,7 @@ void adjacency_bit_matrix::get_neighbors(const size_t node_index, std::vector<si
 void adjacency_bit_matrix::clear(void) {
     m_adjacency.clear();
     m_size = 0;
+    m_memory.reset(0);
 }
 
 
@@ -87,7 +92,7 @@ void adjacency_bit_matrix::update_connection(const size_t node_index1, const siz
     size_t index_element = node_index2 / element_byte_length;
     size_t bit_number = node_index2 % element_byte_length;
 
-    if ( (node_index1 > m_adjacency.size()) || (index_element > m_adjacency.size()) ) {
+    if ( (node_index1 >= m_adjacency.size()) || (node_index2 >= m_size) ) {
         std::string message("adjacency bit matrix size: " + std::to_string(m_adjacency.size()) + ", index1: " + std::to_string(node_index1) + ", index2: " + std::to_string(node_index2));
         throw std::out_of_range(message);
     }
@@ -106,6 +111,7 @@ adjacency_bit_matrix & adjacency_bit_matrix::operator=(const adjacency_bit_matri
     if (this != &another_matrix) {
         m_adjacency = another_matrix.m_adjacency;
         m_size = another_matrix.m_size;
+        m_memory = another_matrix.m_memory;
     }
 
     return *this;
@@ -116,6 +122,7 @@ adjacency_bit_matrix & adjacency_bit_matrix::operator=(adjacency_bit_matrix && a
     if (this != &another_matrix) {
         m_adjacency = std::move(another_matrix.m_adjacency);
         m_size = std::move(another_matrix.m_size);
+        m_memory = std::move(another_matrix.m_memory);
 
         another_matrix.m_size = 0;
     }
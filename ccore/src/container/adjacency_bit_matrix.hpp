@@ -22,6 +22,8 @@
 
 #include "container/adjacency.hpp"
 
+#include "utils/memory.hpp"
+
 
 namespace ccore {
 
@@ -46,8 +48,9 @@ private:
 
 
 protected:
-    adjacency_bit_matrix_container  m_adjacency;
-    size_t                          m_size;
+    adjacency_bit_matrix_container      m_adjacency;
+    size_t                              m_size;
+    utils::memory::memory_reservation   m_memory;
 
 public:
     /**
@@ -35,7 +35,10 @@ adjacency_matrix::adjacency_matrix(void) {
 }
 
 
-adjacency_matrix::adjacency_matrix(const size_t node_amount) : m_adjacency(node_amount, std::vector<double>(node_amount, DEFAULT_NON_EXISTANCE_CONNECTION_VALUE)) { }
+adjacency_matrix::adjacency_matrix(const size_t node_amount) :
+    m_adjacency(node_amount, std::vector<double>(node_amount, DEFAULT_NON_EXISTANCE_CONNECTION_VALUE)),
+    m_memory(node_amount * (sizeof(std::vector<double>) + node_amount * sizeof(double)))
+{ }
 
 
 adjacency_matrix::~adjacency_matrix(void) { }
@@ -83,12 +86,14 @@ double adjacency_matrix::get_connection_weight(const size_t node_index1, const s
 
 void adjacency_matrix::clear(void) {
     m_adjacency.clear();
+    m_memory.reset(0);
 }
 
 
 adjacency_matrix & adjacency_matrix::operator=(const adjacency_matrix & another_collection) {
     if (this != &another_collection) {
         m_adjacency = another_collection.m_adjacency;
+        m_memory = another_collection.m_memory;
     }
 
     return *this;
@@ -98,6 +103,7 @@ adjacency_matrix & adjacency_matrix::operator=(const adjacency_matrix & another_
 adjacency_matrix & adjacency_matrix::operator=(adjacency_matrix && another_collection) {
     if (this != &another_collection) {
         m_adjacency = std::move(another_collection.m_adjacency);
+        m_memory = std::move(another_collection.m_memory);
     }
 
     return *this;
@@ -23,6 +23,8 @@
 
 #include "container/adjacency.hpp"
 
+#include "utils/memory.hpp"
+
 
 namespace ccore {
 
@@ -47,7 +49,8 @@ private:
     typedef std::vector<std::vector<double>>    adjacency_matrix_container;
 
 protected:
-    adjacency_matrix_container  m_adjacency;
+    adjacency_matrix_container          m_adjacency;
+    utils::memory::memory_reservation   m_memory;
 
 public:
     /**
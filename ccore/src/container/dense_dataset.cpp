@@ -0,0 +1,143 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "container/dense_dataset.hpp"
+
+#include <stdexcept>
+#include <string>
+
+
+namespace ccore {
+
+namespace container {
+
+
+dense_dataset::dense_dataset(const std::size_t p_size, const std::size_t p_dimension) :
+    m_storage(p_size * p_dimension, 0.0),
+    m_memory(m_storage.size() * sizeof(double)),
+    m_buffer(m_storage.data()),
+    m_size(p_size),
+    m_dimension(p_dimension),
+    m_stride(p_dimension)
+{ }
+
+
+dense_dataset::dense_dataset(const dataset & p_data) :
+    m_size(p_data.size()),
+    m_dimension(p_data.empty() ? 0 : p_data[0].size()),
+    m_stride(m_dimension)
+{
+    m_storage.reserve(m_size * m_stride);
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        if (p_data[index].size() != m_dimension) {
+            throw std::invalid_argument("CCORE [dense_dataset]: point '" + std::to_string(index) + 
+                "' has dimension '" + std::to_string(p_data[index].size()) + "' that differs from '" + std::to_string(m_dimension) + "'.");
+        }
+
+        m_storage.insert(m_storage.end(), p_data[index].begin(), p_data[index].end());
+    }
+
+    m_memory.reset(m_storage.size() * sizeof(double));
+    m_buffer = m_storage.data();
+}
+
+
+dense_dataset::dense_dataset(double * p_buffer, const std::size_t p_size, const std::size_t p_dimension, const std::size_t p_stride) :
+    m_buffer(p_buffer),
+    m_view(true),
+    m_size(p_size),
+    m_dimension(p_dimension),
+    m_stride(p_stride)
+{
+    if (p_stride < p_dimension) {
+        throw std::invalid_argument("CCORE [dense_dataset]: stride '" + std::to_string(p_stride) + 
+            "' is less than dimension '" + std::to_string(p_dimension) + "'.");
+    }
+}
+
+
+dense_dataset::dense_dataset(const dense_dataset & p_other) :
+    m_storage(p_other.m_storage),
+    m_memory(p_other.m_memory),
+    m_buffer(p_other.m_view ? p_other.m_buffer : m_storage.data()),
+    m_view(p_other.m_view),
+    m_size(p_other.m_size),
+    m_dimension(p_other.m_dimension),
+    m_stride(p_other.m_stride)
+{ }
+
+
+dense_dataset::dense_dataset(dense_dataset && p_other) {
+    *this = std::move(p_other);
+}
+
+
+dense_dataset & dense_dataset::operator=(const dense_dataset & p_other) {
+    if (this != &p_other) {
+        m_storage   = p_other.m_storage;
+        m_memory    = p_other.m_memory;
+        m_buffer    = p_other.m_view ? p_other.m_buffer : m_storage.data();
+        m_view      = p_other.m_view;
+        m_size      = p_other.m_size;
+        m_dimension = p_other.m_dimension;
+        m_stride    = p_other.m_stride;
+    }
+
+    return *this;
+}
+
+
+dense_dataset & dense_dataset::operator=(dense_dataset && p_other) {
+    if (this != &p_other) {
+        m_storage   = std::move(p_other.m_storage);
+        m_memory    = std::move(p_other.m_memory);
+        m_buffer    = p_other.m_view ? p_other.m_buffer : m_storage.data();
+        m_view      = p_other.m_view;
+        m_size      = p_other.m_size;
+        m_dimension = p_other.m_dimension;
+        m_stride    = p_other.m_stride;
+
+        p_other.m_storage   = { };
+        p_other.m_buffer    = nullptr;
+        p_other.m_view      = false;
+        p_other.m_size      = 0;
+        p_other.m_dimension = 0;
+        p_other.m_stride    = 0;
+    }
+
+    return *this;
+}
+
+
+void dense_dataset::extract(dataset & p_data) const {
+    p_data.clear();
+    p_data.reserve(m_size);
+
+    for (std::size_t index = 0; index < m_size; index++) {
+        const point_view view = row(index);
+        p_data.emplace_back(view.begin(), view.end());
+    }
+}
+
+
+}
+
+}
@@ -0,0 +1,263 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+
+#include "definitions.hpp"
+
+#include "utils/memory.hpp"
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Non-owning view to coordinates of one point that are stored contiguously in memory.
+ * @details The view provides container-like interface (iterators, size, element access) and therefore
+ *           it can be used by distance metric functions in the same way as 'point'.
+ *
+ */
+class point_view {
+public:
+    using value_type        = double;
+    using const_iterator    = const double *;
+    using iterator          = const double *;
+
+private:
+    const double *  m_begin = nullptr;
+    std::size_t     m_size  = 0;
+
+public:
+    point_view(void) = default;
+
+    point_view(const double * p_begin, const std::size_t p_size) :
+        m_begin(p_begin), m_size(p_size)
+    { }
+
+    point_view(const point & p_point) :
+        m_begin(p_point.data()), m_size(p_point.size())
+    { }
+
+    point_view(const point_view & p_other) = default;
+
+    ~point_view(void) = default;
+
+public:
+    const double * data(void) const { return m_begin; }
+
+    const_iterator begin(void) const { return m_begin; }
+
+    const_iterator end(void) const { return m_begin + m_size; }
+
+    std::size_t size(void) const { return m_size; }
+
+    bool empty(void) const { return m_size == 0; }
+
+    const double & operator[](const std::size_t p_index) const { return m_begin[p_index]; }
+
+    point_view & operator=(const point_view & p_other) = default;
+};
+
+
+/**
+ *
+ * @brief   Dataset where coordinates of all points are stored in one contiguous row-major buffer.
+ * @details In contrast to 'dataset' where each point is allocated separately, rows of the dense dataset
+ *           are located one after another with fixed stride, therefore iteration over points does not
+ *           require additional pointer dereference and uses cache efficiently.
+ *          Dense dataset either owns its buffer or it is a view to external buffer (for example, to memory
+ *           that is provided by a caller through the C interface). The view does not copy coordinates and
+ *           the external buffer should live while the view is used.
+ *
+ */
+class dense_dataset {
+public:
+    using value_type        = point_view;
+
+private:
+    std::vector<double>     m_storage       = { };
+
+    utils::memory::memory_reservation   m_memory;     /* tracked size of the storage */
+
+    double                  * m_buffer      = nullptr;
+
+    bool                    m_view          = false;
+
+    std::size_t             m_size          = 0;
+
+    std::size_t             m_dimension     = 0;
+
+    std::size_t             m_stride        = 0;
+
+public:
+    /**
+    *
+    * @brief   Default constructor that creates empty dataset.
+    *
+    */
+    dense_dataset(void) = default;
+
+    /**
+    *
+    * @brief   Creates dataset with specified amount of points where each coordinate is equal to zero.
+    *
+    * @param[in] p_size: amount of points in the dataset.
+    * @param[in] p_dimension: dimension of each point.
+    *
+    */
+    dense_dataset(const std::size_t p_size, const std::size_t p_dimension);
+
+    /**
+    *
+    * @brief   Creates dense dataset by copying points from 'dataset'.
+    * @details All points in the input dataset should have the same dimension.
+    *
+    * @param[in] p_data: points that should be copied to contiguous buffer.
+    *
+    */
+    explicit dense_dataset(const dataset & p_data);
+
+    /**
+    *
+    * @brief   Creates view to external buffer where coordinates of points are stored row by row.
+    * @details Coordinates are not copied, the buffer should not be destroyed while the view is used.
+    *
+    * @param[in] p_buffer: pointer to the first coordinate of the first point.
+    * @param[in] p_size: amount of points in the buffer.
+    * @param[in] p_dimension: dimension of each point.
+    * @param[in] p_stride: distance in elements between beginnings of two consecutive points, it should not be
+    *             less than dimension.
+    *
+    */
+    dense_dataset(double * p_buffer, const std::size_t p_size, const std::size_t p_dimension, const std::size_t p_stride);
+
+    dense_dataset(const dense_dataset & p_other);
+
+    dense_dataset(dense_dataset && p_other);
+
+    ~dense_dataset(void) = default;
+
+public:
+    /**
+    *
+    * @brief   Returns amount of points in the dataset.
+    *
+    */
+    std::size_t size(void) const { return m_size; }
+
+    /**
+    *
+    * @brief   Returns dimension of points in the dataset.
+    *
+    */
+    std::size_t dimension(void) const { return m_dimension; }
+
+    /**
+    *
+    * @brief   Returns distance in elements between beginnings of two consecutive points.
+    *
+    */
+    std::size_t stride(void) const { return m_stride; }
+
+    /**
+    *
+    * @brief   Returns 'true' if dataset does not contain any point.
+    *
+    */
+    bool empty(void) const { return m_size == 0; }
+
+    /**
+    *
+    * @brief   Returns 'true' if dataset is a view to external buffer and does not own coordinates.
+    *
+    */
+    bool is_view(void) const { return m_view; }
+
+    /**
+    *
+    * @brief   Returns pointer to the beginning of the buffer where coordinates are stored.
+    *
+    */
+    double * data(void) { return m_buffer; }
+
+    /**
+    *
+    * @brief   Returns constant pointer to the beginning of the buffer where coordinates are stored.
+    *
+    */
+    const double * data(void) const { return m_buffer; }
+
+    /**
+    *
+    * @brief   Returns view to the specified point.
+    *
+    * @param[in] p_index: index of point in the dataset.
+    *
+    */
+    point_view row(const std::size_t p_index) const { return point_view(m_buffer + p_index * m_stride, m_dimension); }
+
+    /**
+    *
+    * @brief   Returns reference to the coordinate of the specified point.
+    *
+    * @param[in] p_index: index of point in the dataset.
+    * @param[in] p_dimension: index of coordinate.
+    *
+    */
+    double & at(const std::size_t p_index, const std::size_t p_dimension) { return m_buffer[p_index * m_stride + p_dimension]; }
+
+    /**
+    *
+    * @brief   Returns constant reference to the coordinate of the specified point.
+    *
+    * @param[in] p_index: index of point in the dataset.
+    * @param[in] p_dimension: index of coordinate.
+    *
+    */
+    const double & at(const std::size_t p_index, const std::size_t p_dimension) const { return m_buffer[p_index * m_stride + p_dimension]; }
+
+    /**
+    *
+    * @brief   Copies points of the dense dataset to 'dataset' container.
+    *
+    * @param[out] p_data: container where points should be stored.
+    *
+    */
+    void extract(dataset & p_data) const;
+
+public:
+    point_view operator[](const std::size_t p_index) const { return row(p_index); }
+
+    dense_dataset & operator=(const dense_dataset & p_other);
+
+    dense_dataset & operator=(dense_dataset && p_other);
+};
+
+
+}
+
+}
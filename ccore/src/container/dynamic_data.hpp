@@ -23,6 +23,9 @@
 
 #include <vector>
 
+#include "utils/memory.hpp"
+#include "utils/statistics.hpp"
+
 
 namespace ccore {
 
@@ -39,18 +42,27 @@ class dynamic_data : public std::vector<DynamicType> {
 public:
     std::size_t   m_oscillators = 0;
 
+private:
+    utils::statistics::performance_statistics   m_statistics;
+    bool          m_statistics_enabled = utils::statistics::performance_statistics::is_enabled_by_default();
+
+    utils::memory::memory_reservation   m_memory;
+
 public:
     dynamic_data(void) = default;
 
     dynamic_data(const std::size_t p_size) :
             std::vector<DynamicType>(p_size),
-            m_oscillators(0)
+            m_oscillators(0),
+            m_memory(p_size * sizeof(DynamicType))
     { }
 
     dynamic_data(const std::size_t p_size, const DynamicType & p_value) :
             std::vector<DynamicType>(p_size, p_value),
             m_oscillators(0)
-    { }
+    {
+        update_memory(p_value.size());
+    }
 
     dynamic_data(const dynamic_data & p_dynamic) = default;
 
@@ -62,28 +74,63 @@ public:
     void push_back(const DynamicType & p_value) {
         check_set_oscillators(p_value);
         std::vector<DynamicType>::push_back(p_value);
+        update_memory(m_oscillators);
     }
 
     void push_back(DynamicType && p_value) {
         check_set_oscillators(p_value);
         std::vector<DynamicType>::push_back(p_value);
+        update_memory(m_oscillators);
     }
 
     void resize(const std::size_t p_size, const std::size_t p_oscillators) {
         std::vector<DynamicType>::resize(p_size);
         m_oscillators = p_oscillators;
+        update_memory(m_oscillators);
     }
 
     void clear(void) {
         std::vector<DynamicType>::clear();
         m_oscillators = 0;
+        m_memory.reset(0);
     }
 
     std::size_t oscillators(void) const {
         return m_oscillators;
     }
 
+    /**
+     *
+     * @brief   Enables or disables collection of performance statistics by simulation of the network.
+     *
+     */
+    void enable_statistics(const bool p_enabled) {
+        m_statistics_enabled = p_enabled;
+    }
+
+    bool is_statistics_enabled(void) const {
+        return m_statistics_enabled;
+    }
+
+    /**
+     *
+     * @brief   Returns performance statistics of the last simulation that has been stored to the dynamic.
+     *
+     */
+    utils::statistics::performance_statistics & statistics(void) {
+        return m_statistics;
+    }
+
+    const utils::statistics::performance_statistics & statistics(void) const {
+        return m_statistics;
+    }
+
 private:
+    void update_memory(const std::size_t p_oscillators) {
+        /* each state stores value of each oscillator, values are approximated by double */
+        m_memory.reset(std::vector<DynamicType>::size() * (sizeof(DynamicType) + p_oscillators * sizeof(double)));
+    }
+
     void check_set_oscillators(const DynamicType & p_value) {
         if (std::vector<DynamicType>::empty()) {
             m_oscillators = p_value.size();
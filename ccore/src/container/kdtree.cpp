@@ -20,14 +20,23 @@
 
 #include "container/kdtree.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <iostream>
 #include <stack>
+#include <stdexcept>
+#include <string>
+
+#include "parallel/parallel.hpp"
 
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
 
 
+using namespace ccore::parallel;
 using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
 
 
 namespace ccore {
@@ -35,6 +44,156 @@ namespace ccore {
 namespace container {
 
 
+const std::size_t kdtree::PARALLEL_SUBTREE_SIZE = 8192;
+
+const std::size_t kdtree_searcher::INVALID_INDEX = std::numeric_limits<std::size_t>::max();
+
+const double kdtree_searcher::BOUND_RELATIVE_ERROR = 1e-10;
+
+
+kdtree::kdtree(const dataset & p_data, const std::vector<void *> & p_payloads) {
+    if (!p_payloads.empty() && (p_payloads.size() != p_data.size())) {
+        throw std::invalid_argument("CCORE [kdtree]: amount of payloads '" + std::to_string(p_payloads.size()) + 
+            "' differs from amount of points '" + std::to_string(p_data.size()) + "'.");
+    }
+
+    std::vector<kdnode::ptr> nodes(p_data.size());
+    parallel_for(std::size_t(0), p_data.size(), [&p_data, &p_payloads, &nodes](const std::size_t p_index) {
+        void * payload = p_payloads.empty() ? nullptr : p_payloads[p_index];
+        nodes[p_index] = std::make_shared<kdnode>(p_data[p_index], payload, nullptr, nullptr, nullptr, 0);
+    });
+
+    build(nodes);
+}
+
+
+kdtree::kdtree(const dense_dataset & p_data) {
+    std::vector<kdnode::ptr> nodes(p_data.size());
+    parallel_for(std::size_t(0), p_data.size(), [&p_data, &nodes](const std::size_t p_index) {
+        const point_view view = p_data.row(p_index);
+        nodes[p_index] = std::make_shared<kdnode>(point(view.begin(), view.end()), (void *) p_index, nullptr, nullptr, nullptr, 0);
+    });
+
+    build(nodes);
+}
+
+
+void kdtree::build(std::vector<kdnode::ptr> & p_nodes) {
+    m_size = p_nodes.size();
+    m_dimension = p_nodes.empty() ? 0 : p_nodes.front()->get_dimension();
+    m_root = create_subtree(p_nodes.begin(), p_nodes.end());
+}
+
+
+kdnode::ptr kdtree::create_subtree(const node_iterator p_begin, const node_iterator p_end) {
+    if (p_begin == p_end) {
+        return nullptr;
+    }
+
+    double spread = 0.0;
+    const std::size_t discriminator = find_split_dimension(p_begin, p_end, spread);
+    if (spread == 0.0) {
+        return create_chain(p_begin, p_end, discriminator);
+    }
+
+    const auto less = [discriminator](const kdnode::ptr & p_node1, const kdnode::ptr & p_node2) {
+        return p_node1->m_data[discriminator] < p_node2->m_data[discriminator];
+    };
+
+    const std::ptrdiff_t length = std::distance(p_begin, p_end);
+    const node_iterator middle = p_begin + length / 2;
+    std::nth_element(p_begin, middle, p_end, less);
+
+    /* nodes that are equal to the split node should be in the right subtree because insertion sends them there,
+       therefore either the first node that is equal to the median or the first node that is greater than the median
+       is used as a split node - which one gives more balanced subtrees */
+    const double median = (*middle)->m_data[discriminator];
+    node_iterator border = std::partition(p_begin, middle, [discriminator, median](const kdnode::ptr & p_node) {
+        return p_node->m_data[discriminator] < median;
+    });
+
+    const node_iterator upper_border = std::partition(middle, p_end, [discriminator, median](const kdnode::ptr & p_node) {
+        return p_node->m_data[discriminator] <= median;
+    });
+
+    const std::ptrdiff_t lower_left = std::distance(p_begin, border);
+    const std::ptrdiff_t upper_left = std::distance(p_begin, upper_border);
+
+    if ((upper_border != p_end) && (std::min(upper_left, length - upper_left) > std::min(lower_left, length - lower_left))) {
+        border = upper_border;
+        std::iter_swap(border, std::min_element(upper_border, p_end, less));
+    }
+    else {
+        std::iter_swap(border, middle);
+    }
+
+    kdnode::ptr node = *border;
+    node->set_discriminator(discriminator);
+
+    kdnode::ptr subtrees[2] = { nullptr, nullptr };
+    const auto create_child = [&subtrees, p_begin, p_end, border](const std::size_t p_child) {
+        subtrees[p_child] = (p_child == 0) ? create_subtree(p_begin, border) : create_subtree(border + 1, p_end);
+    };
+
+    if ((std::size_t) std::distance(p_begin, p_end) >= PARALLEL_SUBTREE_SIZE) {
+        parallel_for(std::size_t(0), std::size_t(2), create_child);
+    }
+    else {
+        create_child(0);
+        create_child(1);
+    }
+
+    for (const auto & child : subtrees) {
+        if (child != nullptr) {
+            child->set_parent(node);
+        }
+    }
+
+    node->set_left(subtrees[0]);
+    node->set_right(subtrees[1]);
+
+    return node;
+}
+
+
+kdnode::ptr kdtree::create_chain(const node_iterator p_begin, const node_iterator p_end, const std::size_t p_discriminator) {
+    for (node_iterator iter = p_begin; iter != p_end; iter++) {
+        (*iter)->set_discriminator(p_discriminator);
+
+        if (iter + 1 != p_end) {
+            (*iter)->set_right(*(iter + 1));
+            (*(iter + 1))->set_parent(*iter);
+        }
+    }
+
+    return *p_begin;
+}
+
+
+std::size_t kdtree::find_split_dimension(const node_iterator p_begin, const node_iterator p_end, double & p_spread) {
+    const std::size_t dimension = (*p_begin)->get_dimension();
+
+    std::vector<double> minimum((*p_begin)->m_data), maximum((*p_begin)->m_data);
+    for (node_iterator iter = p_begin + 1; iter != p_end; iter++) {
+        const std::vector<double> & coordinates = (*iter)->m_data;
+        for (std::size_t index = 0; index < dimension; index++) {
+            minimum[index] = std::min(minimum[index], coordinates[index]);
+            maximum[index] = std::max(maximum[index], coordinates[index]);
+        }
+    }
+
+    std::size_t split_dimension = 0;
+    for (std::size_t index = 1; index < dimension; index++) {
+        if (maximum[index] - minimum[index] > maximum[split_dimension] - minimum[split_dimension]) {
+            split_dimension = index;
+        }
+    }
+
+    p_spread = maximum[split_dimension] - minimum[split_dimension];
+    return split_dimension;
+}
+
+
 kdnode::ptr kdtree::insert(const std::vector<double> & point, void * payload) {
     kdnode::ptr inserted_kdnode;
 
@@ -332,7 +491,6 @@ kdtree_searcher::kdtree_searcher(const std::vector<double> & point, const kdnode
 
 
 void kdtree_searcher::initialize(const std::vector<double> & point, const kdnode::ptr node, const double radius_search) {
-    m_distance = radius_search;
     m_sqrt_distance = radius_search * radius_search;
 
     m_initial_node = node;
@@ -340,94 +498,160 @@ void kdtree_searcher::initialize(const std::vector<double> & point, const kdnode
 }
 
 
-void kdtree_searcher::recursive_nearest_nodes(const kdnode::ptr node) const {
-    double minimum = node->get_value() - m_distance;
-    double maximum = node->get_value() + m_distance;
+void kdtree_searcher::find_nearest_nodes(std::vector<double> & p_distances, std::vector<kdnode::ptr> & p_nearest_nodes) const {
+    p_distances.clear();
+    p_nearest_nodes.clear();
+
+    double square_bound = m_sqrt_distance;
+    traverse(square_bound, [&p_distances, &p_nearest_nodes](const kdnode::ptr & p_node, const double p_square_distance) {
+        p_nearest_nodes.push_back(p_node);
+        p_distances.push_back(p_square_distance);
+    });
+}
+
+
+void kdtree_searcher::find_k_nearest_nodes(const std::size_t p_k, std::vector<double> & p_distances, std::vector<kdnode::ptr> & p_nearest_nodes) const {
+    using candidate = std::pair<double, kdnode::ptr>;
 
-    if (node->get_right() != nullptr) {
-        if (m_search_point[node->get_discriminator()] >= minimum) {
-            recursive_nearest_nodes(node->get_right());
-        }
+    const auto closer = [](const candidate & p_first, const candidate & p_second) { return p_first.first < p_second.first; };
+    const auto farther = [](const candidate & p_first, const candidate & p_second) { return p_first.first > p_second.first; };
+
+    std::vector<candidate> best;        /* max-heap of found nodes, the farthest one is on the top */
+    std::vector<candidate> frontier;    /* min-heap of subtrees ordered by lower bound of distance to them */
+    std::size_t visited = 0;
+
+    if ( (p_k > 0) && (m_initial_node != nullptr) ) {
+        frontier.emplace_back(0.0, m_initial_node);
     }
 
-    if (node->get_left() != nullptr) {
-        if (m_search_point[node->get_discriminator()] < maximum) {
-            recursive_nearest_nodes(node->get_left());
+    while (!frontier.empty()) {
+        std::pop_heap(frontier.begin(), frontier.end(), farther);
+        const candidate current = std::move(frontier.back());
+        frontier.pop_back();
+
+        const double bound = (best.size() < p_k) ? m_sqrt_distance : best.front().first;
+        if (current.first > bound) {
+            break;
         }
-    }
 
-    m_proc(node);
-}
+        const kdnode::ptr & node = current.second;
+        visited++;
+
+        const double candidate_distance = euclidean_distance_square(m_search_point, node->get_data());
+        if (candidate_distance <= m_sqrt_distance) {
+            if (best.size() < p_k) {
+                best.emplace_back(candidate_distance, node);
+                std::push_heap(best.begin(), best.end(), closer);
+            }
+            else if (candidate_distance < best.front().first) {
+                std::pop_heap(best.begin(), best.end(), closer);
+                best.back() = candidate(candidate_distance, node);
+                std::push_heap(best.begin(), best.end(), closer);
+            }
+        }
 
+        /* left subtree contains coordinates that are strictly less than value of the node */
+        const double difference = m_search_point[node->get_discriminator()] - node->get_value();
+        const kdnode::ptr near_child = (difference >= 0.0) ? node->get_right() : node->get_left();
+        const kdnode::ptr far_child = (difference >= 0.0) ? node->get_left() : node->get_right();
 
-void kdtree_searcher::store_if_reachable(const kdnode::ptr node) const {
-    double candidate_distance = euclidean_distance_square(m_search_point, node->get_data());
-    if (candidate_distance <= m_sqrt_distance) {
-        m_nearest_nodes.push_back(node);
-        m_nodes_distance.push_back(candidate_distance);
+        const double current_bound = (best.size() < p_k) ? m_sqrt_distance : best.front().first;
+        const double far_distance = std::max(current.first, difference * difference);
+
+        if (near_child != nullptr) {
+            frontier.emplace_back(current.first, near_child);
+            std::push_heap(frontier.begin(), frontier.end(), farther);
+        }
+
+        if ( (far_child != nullptr) && (far_distance <= current_bound) ) {
+            frontier.emplace_back(far_distance, far_child);
+            std::push_heap(frontier.begin(), frontier.end(), farther);
+        }
     }
-}
 
+    std::sort_heap(best.begin(), best.end(), closer);
 
-void kdtree_searcher::store_best_if_reachable(const kdnode::ptr node) const {
-    double candidate_distance = euclidean_distance_square(m_search_point, node->get_data());
-    if (candidate_distance <= m_nodes_distance[0]) {
-        m_nearest_nodes[0] = node;
-        m_nodes_distance[0] = candidate_distance;
+    p_distances.clear();
+    p_nearest_nodes.clear();
+    for (auto & found : best) {
+        p_distances.push_back(found.first);
+        p_nearest_nodes.push_back(std::move(found.second));
     }
+
+    count_visited(visited);
 }
 
 
-void kdtree_searcher::store_user_nodes_if_reachable(const kdnode::ptr node) const {
-    double candidate_distance = euclidean_distance_square(m_search_point, node->get_data());
-    if (candidate_distance <= m_sqrt_distance) {
-        m_user_rule(node, candidate_distance);
+void kdtree_searcher::find_k_nearest_neighbors(const dense_dataset & p_data,
+                                               const std::size_t p_k,
+                                               std::vector<std::size_t> & p_indexes,
+                                               std::vector<double> & p_distances,
+                                               const double p_radius)
+{
+    if ( (p_k == 0) || p_data.empty() ) {
+        p_indexes.assign(p_data.size() * p_k, INVALID_INDEX);
+        p_distances.assign(p_data.size() * p_k, std::numeric_limits<double>::max());
+        return;
     }
+
+    find_k_nearest_neighbors(kdtree_static(p_data), p_data, p_k, p_indexes, p_distances, p_radius);
 }
 
 
-void kdtree_searcher::find_nearest_nodes(std::vector<double> & p_distances, std::vector<kdnode::ptr> & p_nearest_nodes) const {
-    m_proc = std::bind(&kdtree_searcher::store_if_reachable, this, std::placeholders::_1);
-    recursive_nearest_nodes(m_initial_node);
+void kdtree_searcher::find_k_nearest_neighbors(const kdtree_static & p_tree,
+                                               const dense_dataset & p_data,
+                                               const std::size_t p_k,
+                                               std::vector<std::size_t> & p_indexes,
+                                               std::vector<double> & p_distances,
+                                               const double p_radius)
+{
+    p_indexes.assign(p_data.size() * p_k, INVALID_INDEX);
+    p_distances.assign(p_data.size() * p_k, std::numeric_limits<double>::max());
 
-    p_distances = std::move(m_nodes_distance);
-    p_nearest_nodes = std::move(m_nearest_nodes);
+    if ( (p_k == 0) || p_data.empty() ) {
+        return;
+    }
 
-    clear();
-}
+    parallel_for(std::size_t(0), p_data.size(), [&p_tree, &p_data, p_k, p_radius, &p_indexes, &p_distances](const std::size_t p_index) {
+        std::vector<std::size_t> indexes;
+        std::vector<double> distances;
 
+        /* the point itself is found as well, therefore one more point is requested */
+        p_tree.find_k_nearest(p_data.row(p_index), p_k + 1, p_radius, indexes, distances);
 
-void kdtree_searcher::find_nearest(const rule_store & p_additional_condition) const {
-    m_proc = std::bind(&kdtree_searcher::store_user_nodes_if_reachable, this, std::placeholders::_1);
-    m_user_rule = p_additional_condition;
-    recursive_nearest_nodes(m_initial_node);
+        std::size_t position = p_index * p_k;
+        const std::size_t position_end = position + p_k;
 
-    clear();
+        for (std::size_t i = 0; (i < indexes.size()) && (position < position_end); i++) {
+            const std::size_t index_neighbor = indexes[i];
+            if (index_neighbor != p_index) {
+                p_indexes[position] = index_neighbor;
+                p_distances[position] = std::sqrt(distances[i]);
+                position++;
+            }
+        }
+    });
 }
 
 
 kdnode::ptr kdtree_searcher::find_nearest_node() const {
-    m_nearest_nodes     = { nullptr };
-    m_nodes_distance    = { std::numeric_limits<double>::max() };
-
-    m_proc = std::bind(&kdtree_searcher::store_best_if_reachable, this, std::placeholders::_1);
-    recursive_nearest_nodes(m_initial_node);
+    kdnode::ptr nearest_node = nullptr;
 
-    kdnode::ptr node = m_nearest_nodes.front();
+    /* the bound is decreased to distance of the best node to skip cells that are farther */
+    double square_bound = m_sqrt_distance;
+    traverse(square_bound, [&nearest_node, &square_bound](const kdnode::ptr & p_node, const double p_square_distance) {
+        nearest_node = p_node;
+        square_bound = p_square_distance;
+    });
 
-    clear();
-
-    return node;
+    return nearest_node;
 }
 
 
-void kdtree_searcher::clear(void) const {
-    m_nodes_distance    = { };
-    m_nearest_nodes     = { };
-    m_nearest_points    = { };
-
-    m_user_rule = nullptr;
-    m_proc      = nullptr;
+void kdtree_searcher::count_visited(const std::size_t p_visited) {
+    /* distance is calculated for each visited node */
+    statistics_collector::increment(counter_t::KDTREE_NODES_VISITED, p_visited);
+    statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, p_visited);
 }
 
 
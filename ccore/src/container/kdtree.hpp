@@ -23,10 +23,18 @@
 
 #include "kdnode.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <vector>
 
+#include "container/dense_dataset.hpp"
+#include "container/kdtree_static.hpp"
+
+#include "utils/metric.hpp"
+
 #include "definitions.hpp"
 
 
@@ -44,6 +52,11 @@ class kdtree {
 private:
     using search_node_rule = std::function< bool(const kdnode::ptr &) >;
 
+    using node_iterator = std::vector<kdnode::ptr>::iterator;
+
+private:
+    const static std::size_t PARALLEL_SUBTREE_SIZE;
+
 private:
     kdnode::ptr     m_root          = nullptr;
 
@@ -88,9 +101,71 @@ private:
     */
     kdnode::ptr find_node_by_rule(const std::vector<double> & p_point, const kdnode::ptr & p_cur_node, const search_node_rule & p_rule) const;
 
+    /**
+    *
+    * @brief   Builds balanced tree from nodes that are not linked yet.
+    *
+    * @param[in] p_nodes: nodes of the tree, their order is changed.
+    *
+    */
+    void build(std::vector<kdnode::ptr> & p_nodes);
+
+    /**
+    *
+    * @brief   Recursive creation of balanced subtree from nodes in range [p_begin; p_end).
+    * @details Nodes are split by median of the dimension with the largest spread, nodes whose coordinate is
+    *           equal to the median are placed to the right subtree in line with insertion rule. Subtrees of big
+    *           ranges are created in parallel.
+    *
+    * @return  Root of the subtree or 'nullptr' if the range is empty.
+    *
+    */
+    static kdnode::ptr create_subtree(const node_iterator p_begin, const node_iterator p_end);
+
+    /**
+    *
+    * @brief   Links identical nodes in range [p_begin; p_end) into chain of right children.
+    *
+    * @return  Root of the chain.
+    *
+    */
+    static kdnode::ptr create_chain(const node_iterator p_begin, const node_iterator p_end, const std::size_t p_discriminator);
+
+    /**
+    *
+    * @brief   Returns dimension where coordinates of nodes in range [p_begin; p_end) have the largest spread.
+    *
+    * @param[in] p_begin: the first node of the range.
+    * @param[in] p_end: node after the last node of the range.
+    * @param[out] p_spread: spread of coordinates in the returned dimension.
+    *
+    */
+    static std::size_t find_split_dimension(const node_iterator p_begin, const node_iterator p_end, double & p_spread);
+
 public:
     kdtree(void) = default;
 
+    /**
+    *
+    * @brief   Creates balanced tree from the whole dataset.
+    * @details Construction complexity is O(n * log(n)) and depth of the tree is O(log(n)) regardless of order of
+    *           points, that is not guaranteed when points are inserted one by one.
+    *
+    * @param[in] p_data: points that are stored by the tree.
+    * @param[in] p_payloads: payloads of points, they should correspond to points or be empty (payloads are nullptr).
+    *
+    */
+    kdtree(const dataset & p_data, const std::vector<void *> & p_payloads = { });
+
+    /**
+    *
+    * @brief   Creates balanced tree from the whole dataset where payload of each node is index of its point.
+    *
+    * @param[in] p_data: points that are stored by the tree.
+    *
+    */
+    explicit kdtree(const dense_dataset & p_data);
+
     kdtree(const kdtree & p_other) = default;
 
     kdtree(kdtree && p_other) = default;
@@ -223,18 +298,12 @@ class kdtree_searcher {
 public:
     using rule_store = std::function<void(const kdnode::ptr, const double)>;
 
-private:
-    using proc_store = std::function<void(const kdnode::ptr)>;
-
-private:
-    mutable std::vector<double>        m_nodes_distance     = { };
-    mutable std::vector<kdnode::ptr>   m_nearest_nodes      = { };
-    mutable dataset                    m_nearest_points     = { };
+public:
+    const static std::size_t INVALID_INDEX;
 
-    mutable rule_store                 m_user_rule          = nullptr;
-    mutable proc_store                 m_proc               = nullptr;
+    const static double BOUND_RELATIVE_ERROR;
 
-    double                  m_distance            = -1;
+private:
     double                  m_sqrt_distance       = -1;
     kdnode::ptr             m_initial_node        = nullptr;
     std::vector<double>     m_search_point        = { };
@@ -292,10 +361,67 @@ public:
     *
     * @brief   Search the nearest nodes and store information about found node using user-defined way.
     *
-    * @param[in]  p_store_rule: defines how to store KD-node.
+    * @param[in]  p_store_rule: defines how to store KD-node, callable object with signature
+    *              'void(const kdnode::ptr & p_node, const double p_square_distance)', for example, 'rule_store'.
     *
     */
-    void find_nearest(const rule_store & p_store_rule) const;
+    template <typename TypeRule>
+    void find_nearest(const TypeRule & p_store_rule) const;
+
+    /**
+    *
+    * @brief   Search k nearest nodes in specified location for specified point in the request.
+    * @details Best-first traversal is used: subtrees are visited in ascending order of the lower bound of distance
+    *           to them and the search stops when the lower bound exceeds distance to the k-th found node.
+    *
+    * @param[in]  p_k: amount of nodes that should be found.
+    * @param[out] p_distances: square distances from the point to found nodes in ascending order.
+    * @param[out] p_nearest_nodes: found nodes, less than k nodes are returned if radius of the request
+    *              contains less than k nodes.
+    *
+    */
+    void find_k_nearest_nodes(const std::size_t p_k, std::vector<double> & p_distances, std::vector<kdnode::ptr> & p_nearest_nodes) const;
+
+    /**
+    *
+    * @brief   Search k nearest neighbors for each point of the dataset, the point itself is not its neighbor.
+    * @details Neighbors of point 'i' are stored in positions [i * k; (i + 1) * k) in ascending order of distance.
+    *           If there are less than k neighbors in the radius then remaining positions contain 'INVALID_INDEX'
+    *           and maximum distance. Points are processed in parallel using static k-d tree that is built for the
+    *           dataset.
+    *
+    * @param[in]  p_data: points for which neighbors are searched.
+    * @param[in]  p_k: amount of neighbors of each point.
+    * @param[out] p_indexes: indexes of neighbors.
+    * @param[out] p_distances: euclidean distances to neighbors.
+    * @param[in]  p_radius: maximum distance to neighbors.
+    *
+    */
+    static void find_k_nearest_neighbors(const dense_dataset & p_data,
+                                         const std::size_t p_k,
+                                         std::vector<std::size_t> & p_indexes,
+                                         std::vector<double> & p_distances,
+                                         const double p_radius = std::numeric_limits<double>::max());
+
+    /**
+    *
+    * @brief   Search k nearest neighbors for each point of the dataset using already built static k-d tree.
+    * @details Output layout is the same as in case of the overload that builds the tree.
+    *
+    * @param[in]  p_tree: static k-d tree that is built for the dataset.
+    * @param[in]  p_data: points for which neighbors are searched.
+    * @param[in]  p_k: amount of neighbors of each point.
+    * @param[out] p_indexes: indexes of neighbors.
+    * @param[out] p_distances: euclidean distances to neighbors.
+    * @param[in]  p_radius: maximum distance to neighbors.
+    *
+    */
+    static void find_k_nearest_neighbors(const kdtree_static & p_tree,
+                                         const dense_dataset & p_data,
+                                         const std::size_t p_k,
+                                         std::vector<std::size_t> & p_indexes,
+                                         std::vector<double> & p_distances,
+                                         const double p_radius = std::numeric_limits<double>::max());
 
 private:
     /**
@@ -311,47 +437,106 @@ private:
 
     /**
     *
-    * @brief   Clear internal temporary structures.
-    *
-    */
-    void clear(void) const;
-
-    /**
-    *
-    * @brief   Recursive method for searching nodes that satisfy the request.
+    * @brief   Visits nodes whose square distance to the point is not greater than the bound.
+    * @details Tree is traversed using explicit stack, offsets from the point to the cell (hyper-rectangle) of
+    *           a subtree are updated incrementally for each axis, therefore sum of their squares is a lower bound of
+    *           square distance to nodes of the subtree and the subtree is skipped if the bound is exceeded.
     *
-    * @param[in] node: initial node in tree from which searching should performed.
+    * @param[in,out] p_square_bound: square of the search radius, the visitor may decrease it.
+    * @param[in]     p_visitor: callable object with signature 'void(const kdnode::ptr & p_node, const double p_square_distance)'.
     *
     */
-    void recursive_nearest_nodes(const kdnode::ptr node) const;
+    template <typename TypeVisitor>
+    void traverse(double & p_square_bound, const TypeVisitor & p_visitor) const;
 
     /**
     *
-    * @brief   Append to storage reachable node and distance to it.
-    *
-    * @param[in] node: node that should be added to best collection if it is reachable.
+    * @brief   Updates statistics counters using amount of nodes that are visited by a search.
     *
     */
-    void store_if_reachable(const kdnode::ptr node) const;
+    static void count_visited(const std::size_t p_visited);
+};
 
-    /**
-    *
-    * @brief   Store only one node in collection if it the best node.
-    *
-    * @param[in] node: node that should be added to best collection if it is reachable.
-    *
-    */
-    void store_best_if_reachable(const kdnode::ptr node) const;
 
-    /**
-    *
-    * @brief   Store nodes using user-defined rule.
-    *
-    * @param[in] node: node that should be added to best collection if it is reachable.
-    *
-    */
-    void store_user_nodes_if_reachable(const kdnode::ptr node) const;
-};
+template <typename TypeRule>
+void kdtree_searcher::find_nearest(const TypeRule & p_store_rule) const {
+    double square_bound = m_sqrt_distance;
+    traverse(square_bound, p_store_rule);
+}
+
+
+template <typename TypeVisitor>
+void kdtree_searcher::traverse(double & p_square_bound, const TypeVisitor & p_visitor) const {
+    if (m_initial_node == nullptr) {
+        return;
+    }
+
+    struct entry {
+        kdnode::ptr     m_node;
+        std::size_t     m_level;            /* offsets of the cell are stored at this level */
+        std::size_t     m_axis;             /* axis whose offset differs from the parent cell */
+        double          m_offset;
+        double          m_lower_bound;      /* square distance to the cell */
+    };
+
+    const std::size_t dimension = m_search_point.size();
+    const double tolerance = 1.0 - BOUND_RELATIVE_ERROR;
+
+    std::vector<double> offsets;
+    std::vector<entry> stack = { { m_initial_node, 0, 0, 0.0, 0.0 } };
+    std::size_t visited = 0;
+
+    while (!stack.empty()) {
+        const entry current = std::move(stack.back());
+        stack.pop_back();
+
+        if (current.m_lower_bound * tolerance > p_square_bound) {
+            continue;   /* the bound is decreased by the visitor */
+        }
+
+        visited++;
+
+        /* cell of the node differs from the cell of its parent by one axis */
+        const std::size_t level_begin = current.m_level * dimension;
+        if (offsets.size() < level_begin + dimension) {
+            offsets.resize(level_begin + dimension, 0.0);
+        }
+
+        if (current.m_level > 0) {
+            std::copy(offsets.begin() + level_begin - dimension, offsets.begin() + level_begin, offsets.begin() + level_begin);
+        }
+
+        offsets[level_begin + current.m_axis] = current.m_offset;
+
+        const kdnode::ptr & node = current.m_node;
+
+        const double candidate_distance = utils::metric::euclidean_distance_square(m_search_point, node->get_data());
+        if (candidate_distance <= p_square_bound) {
+            p_visitor(node, candidate_distance);
+        }
+
+        /* left subtree contains coordinates that are strictly less than value of the node */
+        const std::size_t axis = node->get_discriminator();
+        const double difference = m_search_point[axis] - node->get_value();
+        const double parent_offset = offsets[level_begin + axis];
+
+        kdnode::ptr near_child = (difference >= 0.0) ? node->get_right() : node->get_left();
+        kdnode::ptr far_child = (difference >= 0.0) ? node->get_left() : node->get_right();
+
+        if (far_child != nullptr) {
+            const double far_bound = current.m_lower_bound - parent_offset * parent_offset + difference * difference;
+            if (far_bound * tolerance <= p_square_bound) {
+                stack.push_back({ std::move(far_child), current.m_level + 1, axis, difference, far_bound });
+            }
+        }
+
+        if (near_child != nullptr) {
+            stack.push_back({ std::move(near_child), current.m_level + 1, axis, parent_offset, current.m_lower_bound });
+        }
+    }
+
+    count_visited(visited);
+}
 
 
 }
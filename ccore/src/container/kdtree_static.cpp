@@ -0,0 +1,160 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "container/kdtree_static.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+
+namespace ccore {
+
+namespace container {
+
+
+const std::size_t kdtree_static::DEFAULT_LEAF_SIZE  = 32;
+
+const std::size_t kdtree_static::INVALID_INDEX      = std::numeric_limits<std::size_t>::max();
+
+const double kdtree_static::BOUND_RELATIVE_ERROR    = 1e-10;
+
+
+kdtree_static::kdtree_static(const dense_dataset & p_data, const std::size_t p_leaf_size) :
+    m_indexes(p_data.size()),
+    m_dimension(p_data.dimension()),
+    m_leaf_size(std::max(p_leaf_size, std::size_t(1)))
+{
+    if (p_data.empty()) {
+        return;
+    }
+
+    std::iota(m_indexes.begin(), m_indexes.end(), 0);
+
+    m_nodes.reserve(2 * (p_data.size() / m_leaf_size + 1));
+    create_subtree(p_data, 0, p_data.size());
+    m_nodes.shrink_to_fit();
+
+    m_points.resize(p_data.size() * m_dimension);
+    for (std::size_t position = 0; position < m_indexes.size(); position++) {
+        const point_view view = p_data.row(m_indexes[position]);
+        std::copy(view.begin(), view.end(), m_points.begin() + position * m_dimension);
+    }
+
+    m_memory.reset(m_nodes.size() * sizeof(node) + m_points.size() * sizeof(double) + m_indexes.size() * sizeof(std::size_t));
+}
+
+
+std::size_t kdtree_static::create_subtree(const dense_dataset & p_data, const std::size_t p_begin, const std::size_t p_end) {
+    const std::size_t index_node = m_nodes.size();
+    m_nodes.emplace_back();
+    m_nodes[index_node].m_begin = p_begin;
+    m_nodes[index_node].m_end = p_end;
+
+    if (p_end - p_begin <= m_leaf_size) {
+        return index_node;
+    }
+
+    /* split by median of the dimension with the largest spread */
+    std::vector<double> minimum(m_dimension, std::numeric_limits<double>::max());
+    std::vector<double> maximum(m_dimension, -std::numeric_limits<double>::max());
+    for (std::size_t position = p_begin; position < p_end; position++) {
+        const point_view view = p_data.row(m_indexes[position]);
+        for (std::size_t index_dimension = 0; index_dimension < m_dimension; index_dimension++) {
+            minimum[index_dimension] = std::min(minimum[index_dimension], view[index_dimension]);
+            maximum[index_dimension] = std::max(maximum[index_dimension], view[index_dimension]);
+        }
+    }
+
+    std::size_t discriminator = 0;
+    for (std::size_t index_dimension = 1; index_dimension < m_dimension; index_dimension++) {
+        if (maximum[index_dimension] - minimum[index_dimension] > maximum[discriminator] - minimum[discriminator]) {
+            discriminator = index_dimension;
+        }
+    }
+
+    if (maximum[discriminator] == minimum[discriminator]) {
+        return index_node;      /* all points are identical - they are stored by one leaf */
+    }
+
+    const auto begin = m_indexes.begin() + p_begin;
+    const auto middle = m_indexes.begin() + (p_begin + p_end) / 2;
+    const auto end = m_indexes.begin() + p_end;
+
+    std::nth_element(begin, middle, end, [&p_data, discriminator](const std::size_t p_index1, const std::size_t p_index2) {
+        return p_data.at(p_index1, discriminator) < p_data.at(p_index2, discriminator);
+    });
+
+    const double split = p_data.at(*middle, discriminator);
+    const std::size_t left = create_subtree(p_data, p_begin, (p_begin + p_end) / 2);
+    const std::size_t right = create_subtree(p_data, (p_begin + p_end) / 2, p_end);
+
+    node & current = m_nodes[index_node];   /* reference is obtained after creation of children that could reallocate nodes */
+    current.m_discriminator = discriminator;
+    current.m_split = split;
+    current.m_left = left;
+    current.m_right = right;
+
+    return index_node;
+}
+
+
+std::size_t kdtree_static::size(void) const {
+    return m_indexes.size();
+}
+
+
+bool kdtree_static::empty(void) const {
+    return m_indexes.empty();
+}
+
+
+std::size_t kdtree_static::get_dimension(void) const {
+    return m_dimension;
+}
+
+
+std::size_t kdtree_static::get_leaf_size(void) const {
+    return m_leaf_size;
+}
+
+
+std::size_t kdtree_static::get_amount_nodes(void) const {
+    return m_nodes.size();
+}
+
+
+std::size_t kdtree_static::get_depth(void) const {
+    return m_nodes.empty() ? 0 : get_depth(0);
+}
+
+
+std::size_t kdtree_static::get_depth(const std::size_t p_node) const {
+    const node & current = m_nodes[p_node];
+    if (current.m_left == INVALID_INDEX) {
+        return 1;
+    }
+
+    return 1 + std::max(get_depth(current.m_left), get_depth(current.m_right));
+}
+
+
+}
+
+}
@@ -0,0 +1,323 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "container/dense_dataset.hpp"
+
+#include "utils/memory.hpp"
+#include "utils/statistics.hpp"
+
+#include "definitions.hpp"
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Static k-d tree that is stored in contiguous arrays.
+ * @details Nodes are stored in one array and refer to children by indexes, leaves contain buckets of points whose
+ *           coordinates are stored contiguously in leaf order. The tree does not support insertion and removal,
+ *           but it requires less memory than 'kdtree' and radius queries do not chase pointers.
+ *
+ * @see kdtree
+ *
+ */
+class kdtree_static {
+public:
+    const static std::size_t DEFAULT_LEAF_SIZE;
+
+    const static std::size_t INVALID_INDEX;
+
+    const static double BOUND_RELATIVE_ERROR;
+
+private:
+    struct node {
+        std::size_t     m_discriminator = 0;
+        double          m_split         = 0.0;
+        std::size_t     m_left          = INVALID_INDEX;    /* leaf if there is no left child */
+        std::size_t     m_right         = INVALID_INDEX;
+        std::size_t     m_begin         = 0;                /* points of the subtree [m_begin; m_end) in leaf order */
+        std::size_t     m_end           = 0;
+    };
+
+private:
+    std::vector<node>           m_nodes         = { };
+    std::vector<double>         m_points        = { };
+    std::vector<std::size_t>    m_indexes       = { };      /* original indexes of points in leaf order */
+
+    std::size_t                 m_dimension     = 0;
+    std::size_t                 m_leaf_size     = 0;
+
+    utils::memory::memory_reservation   m_memory;
+
+public:
+    kdtree_static(void) = default;
+
+    /**
+     *
+     * @brief   Creates tree from the whole dataset.
+     *
+     * @param[in] p_data: points that are stored by the tree.
+     * @param[in] p_leaf_size: maximum amount of points in a leaf.
+     *
+     */
+    explicit kdtree_static(const dense_dataset & p_data, const std::size_t p_leaf_size = DEFAULT_LEAF_SIZE);
+
+    kdtree_static(const kdtree_static & p_other) = default;
+
+    kdtree_static(kdtree_static && p_other) = default;
+
+    ~kdtree_static(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Calls action for each point that is located within radius from the specified point.
+     * @details Subtree is skipped if square distance from the point to its cell exceeds the radius, the distance is
+     *           updated incrementally using offsets of the cell for each axis.
+     *
+     * @param[in] p_point: point for which neighbors are searched, it should provide 'operator[]'.
+     * @param[in] p_radius: radius of the search.
+     * @param[in] p_action: action with signature 'void(const std::size_t p_index, const double p_square_distance)'
+     *             where index is index of the found point in the original dataset.
+     *
+     */
+    template <typename TypePoint, typename TypeAction>
+    void find_nearest(const TypePoint & p_point, const double p_radius, const TypeAction & p_action) const;
+
+    /**
+     *
+     * @brief   Returns indexes of points that are located within radius from the specified point and square
+     *           distances to them.
+     *
+     */
+    template <typename TypePoint>
+    void find_nearest(const TypePoint & p_point, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_square_distances) const;
+
+    /**
+     *
+     * @brief   Returns indexes of k nearest points to the specified point and square distances to them.
+     * @details The bound of the search is decreased to distance to the k-th found point, therefore farther cells are
+     *           skipped. Points with equal distances are ordered by their indexes.
+     *
+     * @param[in]  p_point: point for which neighbors are searched, it should provide 'operator[]'.
+     * @param[in]  p_k: amount of points that should be found.
+     * @param[in]  p_radius: maximum distance to found points, less than k points are returned if the radius
+     *              contains less than k points.
+     * @param[out] p_indexes: indexes of found points in ascending order of distance.
+     * @param[out] p_square_distances: square distances to found points.
+     *
+     */
+    template <typename TypePoint>
+    void find_k_nearest(const TypePoint & p_point, const std::size_t p_k, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_square_distances) const;
+
+    std::size_t size(void) const;
+
+    bool empty(void) const;
+
+    std::size_t get_dimension(void) const;
+
+    std::size_t get_leaf_size(void) const;
+
+    /**
+     *
+     * @brief   Returns amount of nodes of the tree (internal nodes and leaves).
+     *
+     */
+    std::size_t get_amount_nodes(void) const;
+
+    /**
+     *
+     * @brief   Returns length of the longest path from the root to a leaf, tree with one leaf has depth 1.
+     *
+     */
+    std::size_t get_depth(void) const;
+
+public:
+    kdtree_static & operator=(const kdtree_static & p_other) = default;
+
+    kdtree_static & operator=(kdtree_static && p_other) = default;
+
+private:
+    std::size_t create_subtree(const dense_dataset & p_data, const std::size_t p_begin, const std::size_t p_end);
+
+    /**
+     *
+     * @brief   Calls action for each point whose square distance to the specified point is not greater than the bound,
+     *           the action may decrease the bound to skip farther cells.
+     *
+     */
+    template <typename TypePoint, typename TypeAction>
+    void traverse(const TypePoint & p_point, double & p_square_bound, const TypeAction & p_action) const;
+
+    std::size_t get_depth(const std::size_t p_node) const;
+};
+
+
+template <typename TypePoint, typename TypeAction>
+void kdtree_static::find_nearest(const TypePoint & p_point, const double p_radius, const TypeAction & p_action) const {
+    double square_radius = p_radius * p_radius;
+    traverse(p_point, square_radius, p_action);
+}
+
+
+template <typename TypePoint>
+void kdtree_static::find_nearest(const TypePoint & p_point, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_square_distances) const {
+    p_indexes.clear();
+    p_square_distances.clear();
+
+    find_nearest(p_point, p_radius, [&p_indexes, &p_square_distances](const std::size_t p_index, const double p_square_distance) {
+        p_indexes.push_back(p_index);
+        p_square_distances.push_back(p_square_distance);
+    });
+}
+
+
+template <typename TypePoint>
+void kdtree_static::find_k_nearest(const TypePoint & p_point, const std::size_t p_k, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_square_distances) const {
+    using candidate = std::pair<double, std::size_t>;
+
+    std::vector<candidate> best;    /* max-heap of found points, the farthest one is on the top */
+    best.reserve(p_k);
+
+    if (p_k > 0) {
+        double square_bound = p_radius * p_radius;
+        traverse(p_point, square_bound, [p_k, &best, &square_bound](const std::size_t p_index, const double p_square_distance) {
+            const candidate found(p_square_distance, p_index);
+            if (best.size() < p_k) {
+                best.push_back(found);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (found < best.front()) {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = found;
+                std::push_heap(best.begin(), best.end());
+            }
+
+            if (best.size() == p_k) {
+                square_bound = best.front().first;
+            }
+        });
+    }
+
+    std::sort_heap(best.begin(), best.end());
+
+    p_indexes.clear();
+    p_square_distances.clear();
+    for (const auto & found : best) {
+        p_indexes.push_back(found.second);
+        p_square_distances.push_back(found.first);
+    }
+}
+
+
+template <typename TypePoint, typename TypeAction>
+void kdtree_static::traverse(const TypePoint & p_point, double & p_square_bound, const TypeAction & p_action) const {
+    if (m_nodes.empty()) {
+        return;
+    }
+
+    struct entry {
+        std::size_t     m_node;
+        std::size_t     m_level;            /* offsets of the cell are stored at this level */
+        std::size_t     m_axis;             /* axis whose offset differs from the parent cell */
+        double          m_offset;
+        double          m_lower_bound;      /* square distance to the cell */
+    };
+
+    std::size_t visited = 0;
+
+    std::vector<double> offsets;
+    std::vector<entry> stack = { { 0, 0, 0, 0.0, 0.0 } };
+    while (!stack.empty()) {
+        const entry state = stack.back();
+        const node & current = m_nodes[state.m_node];
+        stack.pop_back();
+
+        if (state.m_lower_bound > p_square_bound * (1.0 + BOUND_RELATIVE_ERROR)) {
+            continue;       /* the bound has been decreased after the cell was pushed */
+        }
+
+        visited++;
+
+        if (current.m_left == INVALID_INDEX) {
+            const double * coordinates = m_points.data() + current.m_begin * m_dimension;
+            for (std::size_t position = current.m_begin; position < current.m_end; position++, coordinates += m_dimension) {
+                double square_distance = 0.0;
+                for (std::size_t index_dimension = 0; index_dimension < m_dimension; index_dimension++) {
+                    const double difference = coordinates[index_dimension] - p_point[index_dimension];
+                    square_distance += difference * difference;
+                }
+
+                if (square_distance <= p_square_bound) {
+                    p_action(m_indexes[position], square_distance);
+                }
+            }
+
+            continue;
+        }
+
+        /* cell of the node differs from the cell of its parent by one axis */
+        const std::size_t level_begin = state.m_level * m_dimension;
+        if (offsets.size() < level_begin + m_dimension) {
+            offsets.resize(level_begin + m_dimension, 0.0);
+        }
+
+        if (state.m_level > 0) {
+            std::copy(offsets.begin() + level_begin - m_dimension, offsets.begin() + level_begin, offsets.begin() + level_begin);
+        }
+
+        offsets[level_begin + state.m_axis] = state.m_offset;
+
+        /* points that are equal to the split value can be located in both subtrees */
+        const std::size_t axis = current.m_discriminator;
+        const double difference = p_point[axis] - current.m_split;
+        const double parent_offset = offsets[level_begin + axis];
+        const double far_bound = state.m_lower_bound - parent_offset * parent_offset + difference * difference;
+
+        const std::size_t near_child = (difference >= 0.0) ? current.m_right : current.m_left;
+        const std::size_t far_child = (difference >= 0.0) ? current.m_left : current.m_right;
+
+        if (far_bound <= p_square_bound * (1.0 + BOUND_RELATIVE_ERROR)) {
+            stack.push_back({ far_child, state.m_level + 1, axis, difference, far_bound });
+        }
+
+        stack.push_back({ near_child, state.m_level + 1, axis, parent_offset, state.m_lower_bound });
+    }
+
+    utils::statistics::statistics_collector::increment(utils::statistics::counter_t::KDTREE_NODES_VISITED, visited);
+}
+
+
+}
+
+}
@@ -0,0 +1,175 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "container/neighbor_graph.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "parallel/parallel.hpp"
+#include "parallel/parallel_algorithm.hpp"
+
+#include "utils/statistics.hpp"
+
+
+using namespace ccore::parallel;
+using namespace ccore::utils::statistics;
+
+
+namespace ccore {
+
+namespace container {
+
+
+neighbor_searcher::neighbor_searcher(const dense_dataset & p_data,
+                                     const spatial_index_t p_index,
+                                     const utils::metric::distance_metric<point> & p_metric) :
+    m_data_ptr(&p_data),
+    m_index(p_index)
+{
+    if ((p_index != spatial_index_t::VPTREE) && (p_metric.get_type() != utils::metric::metric_type::EUCLIDEAN)) {
+        throw std::invalid_argument("CCORE [neighbor_searcher]: k-d tree supports only Euclidean metric, VP-tree should be used for other metrics.");
+    }
+
+    switch(p_index) {
+    case spatial_index_t::VPTREE:
+        m_vptree = vptree(p_data, p_metric);
+        break;
+
+    case spatial_index_t::KDTREE_STATIC:
+        m_kdtree_static = kdtree_static(p_data);
+        break;
+
+    case spatial_index_t::KDTREE:
+        m_kdtree = kdtree(p_data);
+        m_kdtree_root = m_kdtree.get_root();
+        break;
+
+    default:
+        throw std::invalid_argument("CCORE [neighbor_searcher]: unsupported spatial index '" + std::to_string((unsigned) p_index) + "'.");
+    }
+}
+
+
+std::size_t neighbor_searcher::size(void) const {
+    return m_data_ptr->size();
+}
+
+
+neighbor_graph::neighbor_graph(const dense_dataset & p_data,
+                               const double p_radius,
+                               const bool p_store_distances,
+                               const spatial_index_t p_index,
+                               const utils::metric::distance_metric<point> & p_metric) :
+    m_radius(p_radius),
+    m_has_distances(p_store_distances)
+{
+    phase_timer timer(phase_t::NEIGHBOR_SEARCH);
+
+    const neighbor_searcher searcher(p_data, p_index, p_metric);
+    create(searcher);
+}
+
+
+void neighbor_graph::create(const neighbor_searcher & p_searcher) {
+    const std::size_t size = p_searcher.size();
+    statistics_collector::increment(counter_t::NEIGHBOR_QUERIES, 2 * size);
+
+    m_offsets.assign(size + 1, 0);
+    parallel_for(std::size_t(0), size, [this, &p_searcher](const std::size_t p_index) {
+        std::size_t amount_neighbors = 0;
+        p_searcher.find_neighbors(p_index, m_radius, [&amount_neighbors](const std::size_t, const double) {
+            amount_neighbors++;
+        });
+
+        m_offsets[p_index + 1] = amount_neighbors;
+    });
+
+    parallel_inclusive_scan(m_offsets.begin() + 1, m_offsets.end(), m_offsets.begin() + 1);
+
+    m_indexes.resize(m_offsets.back());
+    if (m_has_distances) {
+        m_distances.resize(m_offsets.back());
+    }
+
+    parallel_for(std::size_t(0), size, [this, &p_searcher](const std::size_t p_index) {
+        std::size_t position = m_offsets[p_index];
+        p_searcher.find_neighbors(p_index, m_radius, [this, &position](const std::size_t p_neighbor, const double p_distance) {
+            m_indexes[position] = p_neighbor;
+            if (m_has_distances) {
+                m_distances[position] = p_distance;
+            }
+
+            position++;
+        });
+    });
+
+    m_memory.reset(m_offsets.size() * sizeof(std::size_t) + m_indexes.size() * sizeof(std::size_t) + m_distances.size() * sizeof(double));
+}
+
+
+std::size_t neighbor_graph::size(void) const {
+    return m_offsets.size() - 1;
+}
+
+
+bool neighbor_graph::empty(void) const {
+    return size() == 0;
+}
+
+
+std::size_t neighbor_graph::get_amount_edges(void) const {
+    return m_indexes.size();
+}
+
+
+std::size_t neighbor_graph::get_amount_neighbors(const std::size_t p_index) const {
+    return m_offsets[p_index + 1] - m_offsets[p_index];
+}
+
+
+double neighbor_graph::get_radius(void) const {
+    return m_radius;
+}
+
+
+bool neighbor_graph::has_distances(void) const {
+    return m_has_distances;
+}
+
+
+const std::vector<std::size_t> & neighbor_graph::get_offsets(void) const {
+    return m_offsets;
+}
+
+
+const std::vector<std::size_t> & neighbor_graph::get_indexes(void) const {
+    return m_indexes;
+}
+
+
+const std::vector<double> & neighbor_graph::get_distances(void) const {
+    return m_distances;
+}
+
+
+}
+
+}
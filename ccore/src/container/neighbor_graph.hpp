@@ -0,0 +1,246 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "container/dense_dataset.hpp"
+#include "container/kdtree.hpp"
+#include "container/kdtree_static.hpp"
+#include "container/spatial_index.hpp"
+#include "container/vptree.hpp"
+
+#include "utils/memory.hpp"
+#include "utils/metric.hpp"
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Searches neighbors of points of a dataset within radius using the selected spatial index.
+ * @details Only the selected index is built. Queries do not change the searcher, therefore they can be performed
+ *           in parallel. The dataset should exist while the searcher is used.
+ *
+ */
+class neighbor_searcher {
+private:
+    const dense_dataset *   m_data_ptr      = nullptr;
+
+    spatial_index_t         m_index         = spatial_index_t::KDTREE_STATIC;
+
+    kdtree_static           m_kdtree_static;
+
+    kdtree                  m_kdtree;
+
+    kdnode::ptr             m_kdtree_root   = nullptr;
+
+    vptree                  m_vptree;
+
+public:
+    /**
+     *
+     * @brief   Builds spatial index for points of the dataset.
+     *
+     * @param[in] p_data: points whose neighbors are searched.
+     * @param[in] p_index: spatial index that is used to find neighbors.
+     * @param[in] p_metric: metric that defines neighborhood, k-d trees support only Euclidean metric and other
+     *             metrics require 'spatial_index_t::VPTREE'.
+     *
+     * @throw std::invalid_argument if the metric is not supported by the spatial index.
+     *
+     */
+    neighbor_searcher(const dense_dataset & p_data,
+                      const spatial_index_t p_index = spatial_index_t::KDTREE_STATIC,
+                      const utils::metric::distance_metric<point> & p_metric = utils::metric::distance_metric_factory<point>::euclidean());
+
+    neighbor_searcher(const neighbor_searcher & p_other) = delete;
+
+    neighbor_searcher(neighbor_searcher && p_other) = default;
+
+    ~neighbor_searcher(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Calls action for each point that is located within radius from the specified point of the dataset,
+     *           the point itself is not its neighbor.
+     *
+     * @param[in] p_index: index of the point whose neighbors are searched.
+     * @param[in] p_radius: radius of the search.
+     * @param[in] p_action: action with signature 'void(const std::size_t p_neighbor, const double p_distance)'
+     *             where distance is in terms of the metric.
+     *
+     */
+    template <typename TypeAction>
+    void find_neighbors(const std::size_t p_index, const double p_radius, const TypeAction & p_action) const;
+
+    std::size_t size(void) const;
+
+public:
+    neighbor_searcher & operator=(const neighbor_searcher & p_other) = delete;
+
+    neighbor_searcher & operator=(neighbor_searcher && p_other) = default;
+};
+
+
+template <typename TypeAction>
+void neighbor_searcher::find_neighbors(const std::size_t p_index, const double p_radius, const TypeAction & p_action) const {
+    const point_view view = m_data_ptr->row(p_index);
+
+    switch(m_index) {
+    case spatial_index_t::VPTREE:
+        m_vptree.find_nearest(view, p_radius, [p_index, &p_action](const std::size_t p_neighbor, const double p_distance) {
+            if (p_neighbor != p_index) {
+                p_action(p_neighbor, p_distance);
+            }
+        });
+
+        break;
+
+    case spatial_index_t::KDTREE_STATIC:
+        m_kdtree_static.find_nearest(view, p_radius, [p_index, &p_action](const std::size_t p_neighbor, const double p_square_distance) {
+            if (p_neighbor != p_index) {
+                p_action(p_neighbor, std::sqrt(p_square_distance));
+            }
+        });
+
+        break;
+
+    default:
+        kdtree_searcher(std::vector<double>(view.begin(), view.end()), m_kdtree_root, p_radius).find_nearest(
+            [p_index, &p_action](const kdnode::ptr & p_node, const double p_square_distance) {
+                const std::size_t index_neighbor = (std::size_t) p_node->get_payload();
+                if (index_neighbor != p_index) {
+                    p_action(index_neighbor, std::sqrt(p_square_distance));
+                }
+            });
+
+        break;
+    }
+}
+
+
+/**
+ *
+ * @brief   Radius neighborhood graph of points that is stored in compressed sparse row (CSR) format.
+ * @details Neighbors of point 'i' are located in positions [offset(i); offset(i + 1)) of the index array and of the
+ *           optional distance array, the point itself is not its neighbor. Radius queries of all points are
+ *           performed in parallel when the graph is created, therefore algorithms that visit neighbors of each
+ *           point (DBSCAN, OPTICS) do not search them during processing and the graph can be reused by them
+ *           with different amount of neighbors. The graph requires memory for all edges, therefore the algorithms
+ *           use it only if it is passed to them explicitly.
+ *
+ */
+class neighbor_graph {
+private:
+    std::vector<std::size_t>    m_offsets       = { 0 };
+    std::vector<std::size_t>    m_indexes       = { };
+    std::vector<double>         m_distances     = { };      /* distances in terms of the metric, empty if they are not stored */
+
+    double                      m_radius        = 0.0;
+    bool                        m_has_distances = false;
+
+    utils::memory::memory_reservation   m_memory;
+
+public:
+    neighbor_graph(void) = default;
+
+    /**
+     *
+     * @brief   Creates graph where each point is connected with points that are located within radius.
+     * @details Each point is queried twice: the first pass counts neighbors to allocate arrays once and the second
+     *           pass stores them.
+     *
+     * @param[in] p_data: points of the graph.
+     * @param[in] p_radius: connectivity radius.
+     * @param[in] p_store_distances: if 'true' then distances to neighbors are stored by the graph.
+     * @param[in] p_index: spatial index that is used to find neighbors.
+     * @param[in] p_metric: metric that defines neighborhood, k-d trees support only Euclidean metric and other
+     *             metrics require 'spatial_index_t::VPTREE'.
+     *
+     */
+    neighbor_graph(const dense_dataset & p_data,
+                   const double p_radius,
+                   const bool p_store_distances = false,
+                   const spatial_index_t p_index = spatial_index_t::KDTREE_STATIC,
+                   const utils::metric::distance_metric<point> & p_metric = utils::metric::distance_metric_factory<point>::euclidean());
+
+    neighbor_graph(const neighbor_graph & p_other) = default;
+
+    neighbor_graph(neighbor_graph && p_other) = default;
+
+    ~neighbor_graph(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Returns amount of points (vertices) of the graph.
+     *
+     */
+    std::size_t size(void) const;
+
+    bool empty(void) const;
+
+    /**
+     *
+     * @brief   Returns total amount of stored neighbors (directed edges).
+     *
+     */
+    std::size_t get_amount_edges(void) const;
+
+    std::size_t get_amount_neighbors(const std::size_t p_index) const;
+
+    double get_radius(void) const;
+
+    bool has_distances(void) const;
+
+    /**
+     *
+     * @brief   Returns offsets of neighbors of points, the array contains 'size() + 1' elements.
+     *
+     */
+    const std::vector<std::size_t> & get_offsets(void) const;
+
+    const std::vector<std::size_t> & get_indexes(void) const;
+
+    const std::vector<double> & get_distances(void) const;
+
+public:
+    neighbor_graph & operator=(const neighbor_graph & p_other) = default;
+
+    neighbor_graph & operator=(neighbor_graph && p_other) = default;
+
+private:
+    void create(const neighbor_searcher & p_searcher);
+};
+
+
+}
+
+}
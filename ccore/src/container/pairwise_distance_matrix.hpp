@@ -0,0 +1,460 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "container/dense_dataset.hpp"
+
+#include "parallel/parallel.hpp"
+
+#include "utils/metric.hpp"
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Defines how pairwise distances are stored in memory.
+ *
+ */
+enum class distance_matrix_layout {
+    CONDENSED,      /* upper triangle without diagonal row by row: n * (n - 1) / 2 values */
+    SQUARE          /* full symmetric matrix row by row: n * n values */
+};
+
+
+/**
+ *
+ * @brief   Symmetric matrix of pairwise distances between objects that is stored in one contiguous buffer.
+ * @details The matrix is built by tiles in parallel using 'create' and it can store distances in single
+ *           precision to halve memory consumption. Condensed layout is used by default because the
+ *           matrix is symmetric and its diagonal consists of zeros.
+ *          Square matrix that is already stored by a caller can be wrapped by read-only view, in this case
+ *           distances are not copied and only pointers to rows are stored.
+ *
+ */
+template <typename TypeValue = double>
+class pairwise_distance_matrix {
+public:
+    using value_type = TypeValue;
+
+private:
+    std::vector<TypeValue>  m_data;
+    std::vector<const TypeValue *>  m_rows;     /* rows of external square matrix in case of view */
+    std::size_t             m_size      = 0;
+    distance_matrix_layout  m_layout    = distance_matrix_layout::CONDENSED;
+    bool                    m_view      = false;
+
+public:
+    /**
+     *
+     * @brief   Default constructor of empty distance matrix.
+     *
+     */
+    pairwise_distance_matrix(void) = default;
+
+    /**
+     *
+     * @brief   Constructor of distance matrix for specified amount of objects where all distances are zero.
+     *
+     * @param[in] p_size: amount of objects.
+     * @param[in] p_layout: layout of distances in memory.
+     *
+     */
+    pairwise_distance_matrix(const std::size_t p_size, const distance_matrix_layout p_layout = distance_matrix_layout::CONDENSED) :
+        m_data(get_storage_size(p_size, p_layout), TypeValue(0)),
+        m_size(p_size),
+        m_layout(p_layout)
+    { }
+
+    /**
+     *
+     * @brief   Creates read-only view to square distance matrix whose rows are stored by external containers.
+     * @details Distances are not copied, the rows should not be destroyed while the view is used.
+     *
+     * @param[in] p_rows: rows of square distance matrix.
+     *
+     */
+    explicit pairwise_distance_matrix(const std::vector<std::vector<TypeValue>> & p_rows) :
+        m_rows(p_rows.size()),
+        m_size(p_rows.size()),
+        m_layout(distance_matrix_layout::SQUARE),
+        m_view(true)
+    {
+        for (std::size_t index = 0; index < m_size; index++) {
+            if (p_rows[index].size() != m_size) {
+                throw std::invalid_argument("CCORE [pairwise_distance_matrix]: row '" + std::to_string(index) + "' has size '" +
+                    std::to_string(p_rows[index].size()) + "' that differs from amount of rows '" + std::to_string(m_size) + "'.");
+            }
+
+            m_rows[index] = p_rows[index].data();
+        }
+    }
+
+    /**
+     *
+     * @brief   Creates read-only view to square distance matrix that is stored row by row in external buffer.
+     * @details Distances are not copied, the buffer should not be destroyed while the view is used.
+     *
+     * @param[in] p_buffer: pointer to the first distance of the first row.
+     * @param[in] p_size: amount of objects (rows of the matrix).
+     * @param[in] p_stride: distance in elements between beginnings of two consecutive rows.
+     *
+     */
+    pairwise_distance_matrix(const TypeValue * p_buffer, const std::size_t p_size, const std::size_t p_stride) :
+        m_rows(p_size),
+        m_size(p_size),
+        m_layout(distance_matrix_layout::SQUARE),
+        m_view(true)
+    {
+        if (p_stride < p_size) {
+            throw std::invalid_argument("CCORE [pairwise_distance_matrix]: stride '" + std::to_string(p_stride) +
+                "' is less than amount of rows '" + std::to_string(p_size) + "'.");
+        }
+
+        for (std::size_t index = 0; index < m_size; index++) {
+            m_rows[index] = p_buffer + index * p_stride;
+        }
+    }
+
+    /**
+     *
+     * @brief   Creates read-only view to square distance matrix that is stored by dense dataset.
+     * @details Distances are not copied, the dataset should not be destroyed while the view is used.
+     *
+     * @param[in] p_matrix: square distance matrix where each point is a row of the matrix.
+     *
+     */
+    explicit pairwise_distance_matrix(const dense_dataset & p_matrix) :
+        pairwise_distance_matrix(p_matrix.data(), p_matrix.size(), p_matrix.stride())
+    {
+        if (p_matrix.dimension() != p_matrix.size()) {
+            throw std::invalid_argument("CCORE [pairwise_distance_matrix]: distance matrix with size '" + std::to_string(p_matrix.size()) +
+                "' has rows with size '" + std::to_string(p_matrix.dimension()) + "'.");
+        }
+    }
+
+    pairwise_distance_matrix(const pairwise_distance_matrix & p_other) = default;
+
+    pairwise_distance_matrix(pairwise_distance_matrix && p_other) = default;
+
+    ~pairwise_distance_matrix(void) = default;
+
+public:
+    pairwise_distance_matrix & operator=(const pairwise_distance_matrix & p_other) = default;
+
+    pairwise_distance_matrix & operator=(pairwise_distance_matrix && p_other) = default;
+
+public:
+    /**
+     *
+     * @brief   Returns amount of objects (rows of the square matrix).
+     *
+     */
+    std::size_t size(void) const { return m_size; }
+
+    /**
+     *
+     * @brief   Returns true if matrix does not contain objects.
+     *
+     */
+    bool empty(void) const { return m_size == 0; }
+
+    /**
+     *
+     * @brief   Returns layout of distances in memory.
+     *
+     */
+    distance_matrix_layout layout(void) const { return m_layout; }
+
+    /**
+     *
+     * @brief   Returns true if matrix is a read-only view to distances that are stored by a caller.
+     *
+     */
+    bool is_view(void) const { return m_view; }
+
+    /**
+     *
+     * @brief   Returns amount of values that are stored in the buffer, view does not own a buffer.
+     *
+     */
+    std::size_t storage_size(void) const { return m_data.size(); }
+
+    /**
+     *
+     * @brief   Returns pointer to the buffer with distances.
+     *
+     */
+    const TypeValue * data(void) const { return m_data.data(); }
+
+    /**
+     *
+     * @brief   Returns pointer to the buffer with distances.
+     *
+     */
+    TypeValue * data(void) { return m_data.data(); }
+
+    /**
+     *
+     * @brief   Returns distance between two objects without bounds checking.
+     *
+     * @param[in] p_index1: index of the first object.
+     * @param[in] p_index2: index of the second object.
+     *
+     */
+    TypeValue operator()(const std::size_t p_index1, const std::size_t p_index2) const {
+        if (m_layout == distance_matrix_layout::SQUARE) {
+            return get_row(p_index1)[p_index2];
+        }
+
+        if (p_index1 == p_index2) {
+            return TypeValue(0);
+        }
+
+        return (p_index1 < p_index2) ? m_data[get_condensed_index(p_index1, p_index2, m_size)] :
+                                       m_data[get_condensed_index(p_index2, p_index1, m_size)];
+    }
+
+    /**
+     *
+     * @brief   Returns distance between two objects.
+     * @throw   std::out_of_range if one of the indexes is out of range.
+     *
+     * @param[in] p_index1: index of the first object.
+     * @param[in] p_index2: index of the second object.
+     *
+     */
+    TypeValue at(const std::size_t p_index1, const std::size_t p_index2) const {
+        if ((p_index1 >= m_size) || (p_index2 >= m_size)) {
+            throw std::out_of_range("Index (" + std::to_string(p_index1) + ", " + std::to_string(p_index2) +
+                ") is out of range of distance matrix with size '" + std::to_string(m_size) + "'.");
+        }
+
+        return (*this)(p_index1, p_index2);
+    }
+
+    /**
+     *
+     * @brief   Assigns distance between two different objects (both symmetric values in case of square layout).
+     * @details Distances of a view cannot be changed.
+     *
+     * @param[in] p_index1: index of the first object.
+     * @param[in] p_index2: index of the second object.
+     * @param[in] p_distance: distance between objects.
+     *
+     */
+    void set(const std::size_t p_index1, const std::size_t p_index2, const TypeValue p_distance) {
+        if (m_layout == distance_matrix_layout::SQUARE) {
+            m_data[p_index1 * m_size + p_index2] = p_distance;
+            m_data[p_index2 * m_size + p_index1] = p_distance;
+        }
+        else if (p_index1 < p_index2) {
+            m_data[get_condensed_index(p_index1, p_index2, m_size)] = p_distance;
+        }
+        else if (p_index1 > p_index2) {
+            m_data[get_condensed_index(p_index2, p_index1, m_size)] = p_distance;
+        }
+    }
+
+    /**
+     *
+     * @brief   Calls action for each distance from the specified object to other objects.
+     * @details Values are visited using sequential access to the buffer where it is possible, it is more
+     *           efficient than access by pair of indexes.
+     *
+     * @param[in] p_index: index of the object whose distances are visited.
+     * @param[in] p_action: action with signature 'void(const std::size_t p_neighbor, const TypeValue p_distance)'.
+     *
+     */
+    template <typename TypeAction>
+    void for_each_distance(const std::size_t p_index, TypeAction && p_action) const {
+        if (m_layout == distance_matrix_layout::SQUARE) {
+            const TypeValue * row = get_row(p_index);
+            for (std::size_t index_neighbor = 0; index_neighbor < m_size; index_neighbor++) {
+                if (index_neighbor != p_index) {
+                    p_action(index_neighbor, row[index_neighbor]);
+                }
+            }
+
+            return;
+        }
+
+        /* column of the upper triangle: step between rows is decreased by one on each row */
+        std::size_t position = p_index - 1;
+        for (std::size_t index_neighbor = 0; index_neighbor < p_index; index_neighbor++) {
+            p_action(index_neighbor, m_data[position]);
+            position += m_size - index_neighbor - 2;
+        }
+
+        /* row of the upper triangle is contiguous */
+        if (p_index + 1 < m_size) {
+            const TypeValue * row = m_data.data() + get_condensed_index(p_index, p_index + 1, m_size);
+            for (std::size_t index_neighbor = p_index + 1; index_neighbor < m_size; index_neighbor++) {
+                p_action(index_neighbor, *row);
+                row++;
+            }
+        }
+    }
+
+public:
+    /**
+     *
+     * @brief   Returns position of distance between objects 'i' and 'j' (i < j) in condensed buffer.
+     *
+     * @param[in] p_index1: index of the first object 'i'.
+     * @param[in] p_index2: index of the second object 'j', it should be greater than 'i'.
+     * @param[in] p_size: amount of objects.
+     *
+     */
+    static std::size_t get_condensed_index(const std::size_t p_index1, const std::size_t p_index2, const std::size_t p_size) {
+        return p_index1 * p_size - p_index1 * (p_index1 + 1) / 2 + (p_index2 - p_index1 - 1);
+    }
+
+    /**
+     *
+     * @brief   Returns amount of values that are required to store distances between specified amount of objects.
+     *
+     * @param[in] p_size: amount of objects.
+     * @param[in] p_layout: layout of distances in memory.
+     *
+     */
+    static std::size_t get_storage_size(const std::size_t p_size, const distance_matrix_layout p_layout) {
+        if (p_layout == distance_matrix_layout::SQUARE) {
+            return p_size * p_size;
+        }
+
+        return (p_size > 1) ? p_size * (p_size - 1) / 2 : 0;
+    }
+
+    /**
+     *
+     * @brief   Calculates distance matrix for points using specified metric.
+     * @details Built-in metrics are replaced by corresponding compile-time policy, therefore distance
+     *           calculation is not performed via indirect call.
+     *
+     * @param[in] p_data: points whose pairwise distances should be calculated.
+     * @param[in] p_metric: distance metric.
+     * @param[in] p_layout: layout of distances in memory.
+     *
+     * @return  Distance matrix of points.
+     *
+     */
+    static pairwise_distance_matrix create(const dense_dataset & p_data,
+                                           const utils::metric::distance_metric<point> & p_metric = utils::metric::distance_metric_factory<point>::euclidean(),
+                                           const distance_matrix_layout p_layout = distance_matrix_layout::CONDENSED)
+    {
+        pairwise_distance_matrix result(p_data.size(), p_layout);
+        utils::metric::visit_metric(p_metric, [&p_data, &result](const auto & p_policy) {
+            result.fill(p_data, p_policy);
+        });
+
+        return result;
+    }
+
+    /**
+     *
+     * @brief   Calculates distance matrix for points using specified callable metric.
+     *
+     * @param[in] p_data: points whose pairwise distances should be calculated.
+     * @param[in] p_metric: callable object with signature 'double(const point_view &, const point_view &)'.
+     * @param[in] p_layout: layout of distances in memory.
+     *
+     * @return  Distance matrix of points.
+     *
+     */
+    template <typename TypeMetric>
+    static pairwise_distance_matrix create(const dense_dataset & p_data,
+                                           const TypeMetric & p_metric,
+                                           const distance_matrix_layout p_layout = distance_matrix_layout::CONDENSED)
+    {
+        pairwise_distance_matrix result(p_data.size(), p_layout);
+        result.fill(p_data, p_metric);
+        return result;
+    }
+
+private:
+    const TypeValue * get_row(const std::size_t p_index) const {
+        return m_view ? m_rows[p_index] : m_data.data() + p_index * m_size;
+    }
+
+    /**
+     *
+     * @brief   Calculates distances tile by tile in parallel.
+     * @details Only tiles of the upper triangle are processed, all of them are distributed between threads
+     *           as a flat list, so the work is balanced in spite of triangular shape. Points of both tiles
+     *           are reused from cache while the tile is processed.
+     *
+     */
+    template <typename TypeMetric>
+    void fill(const dense_dataset & p_data, const TypeMetric & p_metric) {
+        if (m_size < 2) {
+            return;
+        }
+
+        /* points of two tiles should occupy about half of L1 cache during tile processing */
+        const std::size_t tile_cache_bytes = 16384;
+        const std::size_t tile_minimum_size = 16;
+        const std::size_t tile_maximum_size = 256;
+
+        const std::size_t dimension = std::max(p_data.dimension(), std::size_t(1));
+        const std::size_t tile_size = std::min(tile_maximum_size, std::max(tile_minimum_size, tile_cache_bytes / (2 * dimension * sizeof(double))));
+        const std::size_t amount_tiles = (m_size + tile_size - 1) / tile_size;
+
+        std::vector<std::pair<std::size_t, std::size_t>> tiles;
+        tiles.reserve(amount_tiles * (amount_tiles + 1) / 2);
+        for (std::size_t tile_row = 0; tile_row < amount_tiles; tile_row++) {
+            for (std::size_t tile_column = tile_row; tile_column < amount_tiles; tile_column++) {
+                tiles.emplace_back(tile_row, tile_column);
+            }
+        }
+
+        parallel::parallel_for(std::size_t(0), tiles.size(), [this, &p_data, &p_metric, &tiles, tile_size](const std::size_t p_tile) {
+            const std::size_t row_begin = tiles[p_tile].first * tile_size;
+            const std::size_t row_end = std::min(row_begin + tile_size, m_size);
+
+            const std::size_t column_begin = tiles[p_tile].second * tile_size;
+            const std::size_t column_end = std::min(column_begin + tile_size, m_size);
+
+            for (std::size_t i = row_begin; i < row_end; i++) {
+                const point_view point1 = p_data.row(i);
+                for (std::size_t j = std::max(column_begin, i + 1); j < column_end; j++) {
+                    set(i, j, static_cast<TypeValue>(p_metric(point1, p_data.row(j))));
+                }
+            }
+        });
+    }
+};
+
+
+}
+
+}
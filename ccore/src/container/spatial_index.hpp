@@ -0,0 +1,44 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Spatial index that is used by density-based algorithms to find neighbors of objects.
+ *
+ */
+enum class spatial_index_t {
+    KDTREE,             /* k-d tree of linked nodes, it supports insertion and removal of points */
+    KDTREE_STATIC,      /* static k-d tree in contiguous arrays with buckets of points in leaves */
+    VPTREE              /* vantage-point tree, it supports any metric that satisfies the triangle inequality */
+};
+
+
+}
+
+}
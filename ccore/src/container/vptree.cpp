@@ -0,0 +1,196 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "container/vptree.hpp"
+
+#include <numeric>
+#include <stdexcept>
+
+
+namespace ccore {
+
+namespace container {
+
+
+const std::size_t vptree::DEFAULT_LEAF_SIZE     = 16;
+
+const std::size_t vptree::INVALID_INDEX         = std::numeric_limits<std::size_t>::max();
+
+const double vptree::BOUND_RELATIVE_ERROR       = 1e-10;
+
+
+vptree::vptree(const dense_dataset & p_data, const utils::metric::distance_metric<point> & p_metric, const std::size_t p_leaf_size) :
+    m_indexes(p_data.size()),
+    m_dimension(p_data.dimension()),
+    m_leaf_size(std::max(p_leaf_size, std::size_t(1))),
+    m_metric(p_metric)
+{
+    using namespace utils::metric;
+
+    const metric_type type = m_metric.get_type();
+    if (!m_metric || (type == metric_type::EUCLIDEAN_SQUARE) || (type == metric_type::COSINE) ||
+        ((type == metric_type::MINKOWSKI) && (m_metric.get_degree() < 1.0)))
+    {
+        throw std::invalid_argument("CCORE [vptree]: metric should satisfy the triangle inequality.");
+    }
+
+    if (p_data.empty()) {
+        return;
+    }
+
+    std::iota(m_indexes.begin(), m_indexes.end(), 0);
+
+    m_nodes.reserve(2 * (p_data.size() / m_leaf_size + 1));
+    create_subtree(p_data, 0, p_data.size());
+    m_nodes.shrink_to_fit();
+
+    m_points.resize(p_data.size() * m_dimension);
+    for (std::size_t position = 0; position < m_indexes.size(); position++) {
+        const point_view view = p_data.row(m_indexes[position]);
+        std::copy(view.begin(), view.end(), m_points.begin() + position * m_dimension);
+    }
+
+    m_memory.reset(m_nodes.size() * sizeof(node) + m_points.size() * sizeof(double) + m_indexes.size() * sizeof(std::size_t));
+}
+
+
+std::size_t vptree::create_subtree(const dense_dataset & p_data, const std::size_t p_begin, const std::size_t p_end) {
+    const std::size_t index_node = m_nodes.size();
+    m_nodes.emplace_back();
+    m_nodes[index_node].m_begin = p_begin;
+    m_nodes[index_node].m_end = p_end;
+
+    if (p_end - p_begin <= m_leaf_size) {
+        return index_node;
+    }
+
+    /* the farthest point from an arbitrary one is close to the boundary and it is used as vantage point */
+    const point_view first = p_data.row(m_indexes[p_begin]);
+    std::size_t vantage = p_begin;
+    double farthest_distance = 0.0;
+    for (std::size_t position = p_begin + 1; position < p_end; position++) {
+        const double distance = m_metric(first, p_data.row(m_indexes[position]));
+        if (distance > farthest_distance) {
+            farthest_distance = distance;
+            vantage = position;
+        }
+    }
+
+    std::swap(m_indexes[p_begin], m_indexes[vantage]);
+
+    /* rest of points are divided by median of distances to the vantage point */
+    const point_view vantage_point = p_data.row(m_indexes[p_begin]);
+    std::vector<std::pair<double, std::size_t>> distances;
+    distances.reserve(p_end - p_begin - 1);
+    for (std::size_t position = p_begin + 1; position < p_end; position++) {
+        distances.emplace_back(m_metric(vantage_point, p_data.row(m_indexes[position])), m_indexes[position]);
+    }
+
+    utils::statistics::statistics_collector::increment(utils::statistics::counter_t::DISTANCE_CALCULATIONS, 2 * distances.size());
+
+    const std::size_t amount_inner = (distances.size() + 1) / 2;
+    std::nth_element(distances.begin(), distances.begin() + amount_inner - 1, distances.end());
+
+    for (std::size_t position = 0; position < distances.size(); position++) {
+        m_indexes[p_begin + 1 + position] = distances[position].second;
+    }
+
+    const std::size_t middle = p_begin + 1 + amount_inner;
+    const auto inner_range = std::minmax_element(distances.begin(), distances.begin() + amount_inner);
+
+    const std::size_t inner = create_subtree(p_data, p_begin + 1, middle);
+    m_nodes[inner].m_lower = inner_range.first->first;
+    m_nodes[inner].m_upper = inner_range.second->first;
+
+    const std::size_t outer = create_subtree(p_data, middle, p_end);
+    if (middle < p_end) {
+        const auto outer_range = std::minmax_element(distances.begin() + amount_inner, distances.end());
+        m_nodes[outer].m_lower = outer_range.first->first;
+        m_nodes[outer].m_upper = outer_range.second->first;
+    }
+
+    node & current = m_nodes[index_node];   /* reference is obtained after creation of children that could reallocate nodes */
+    current.m_inner = inner;
+    current.m_outer = outer;
+
+    return index_node;
+}
+
+
+point_view vptree::get_point(const std::size_t p_position) const {
+    return point_view(m_points.data() + p_position * m_dimension, m_dimension);
+}
+
+
+double vptree::get_lower_bound(const node & p_child, const double p_distance) const {
+    /* triangle inequality: d(q, x) >= |d(q, v) - d(v, x)|, tolerance compensates rounding errors of distances */
+    const double bound = std::max(p_child.m_lower - p_distance, p_distance - p_child.m_upper);
+    return bound - BOUND_RELATIVE_ERROR * (p_distance + std::abs(p_child.m_upper));
+}
+
+
+std::size_t vptree::size(void) const {
+    return m_indexes.size();
+}
+
+
+bool vptree::empty(void) const {
+    return m_indexes.empty();
+}
+
+
+std::size_t vptree::get_dimension(void) const {
+    return m_dimension;
+}
+
+
+std::size_t vptree::get_leaf_size(void) const {
+    return m_leaf_size;
+}
+
+
+const utils::metric::distance_metric<point> & vptree::get_metric(void) const {
+    return m_metric;
+}
+
+
+std::size_t vptree::get_amount_nodes(void) const {
+    return m_nodes.size();
+}
+
+
+std::size_t vptree::get_depth(void) const {
+    return m_nodes.empty() ? 0 : get_depth(0);
+}
+
+
+std::size_t vptree::get_depth(const std::size_t p_node) const {
+    const node & current = m_nodes[p_node];
+    if (current.m_inner == INVALID_INDEX) {
+        return 1;
+    }
+
+    return 1 + std::max(get_depth(current.m_inner), get_depth(current.m_outer));
+}
+
+
+}
+
+}
@@ -0,0 +1,317 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "container/dense_dataset.hpp"
+
+#include "utils/memory.hpp"
+#include "utils/metric.hpp"
+#include "utils/statistics.hpp"
+
+#include "definitions.hpp"
+
+
+namespace ccore {
+
+namespace container {
+
+
+/**
+ *
+ * @brief   Static vantage-point tree (VP-tree) that is stored in contiguous arrays.
+ * @details Each internal node has a vantage point and divides rest of its points into inner and outer subtrees by
+ *           median of distances to the vantage point. Range of distances from the vantage point is stored for each
+ *           child, therefore subtrees are pruned using only the triangle inequality and the tree can be used with
+ *           any metric (Manhattan, Chebyshev, Minkowski, user-defined) instead of k-d tree that requires Euclidean
+ *           distance. Leaves contain buckets of points whose coordinates are stored contiguously in tree order.
+ *
+ * @see kdtree_static
+ *
+ */
+class vptree {
+public:
+    const static std::size_t DEFAULT_LEAF_SIZE;
+
+    const static std::size_t INVALID_INDEX;
+
+    const static double BOUND_RELATIVE_ERROR;
+
+private:
+    struct node {
+        std::size_t     m_inner     = INVALID_INDEX;    /* leaf if there is no inner child */
+        std::size_t     m_outer     = INVALID_INDEX;
+        std::size_t     m_begin     = 0;                /* points of the subtree [m_begin; m_end), vantage point is the first */
+        std::size_t     m_end       = 0;
+        double          m_lower     = std::numeric_limits<double>::max();       /* range of distances from the vantage point of the parent */
+        double          m_upper     = -std::numeric_limits<double>::max();
+    };
+
+private:
+    std::vector<node>           m_nodes         = { };
+    std::vector<double>         m_points        = { };
+    std::vector<std::size_t>    m_indexes       = { };      /* original indexes of points in tree order */
+
+    std::size_t                 m_dimension     = 0;
+    std::size_t                 m_leaf_size     = 0;
+
+    utils::metric::distance_metric<point>   m_metric;
+
+    utils::memory::memory_reservation       m_memory;
+
+public:
+    vptree(void) = default;
+
+    /**
+     *
+     * @brief   Creates tree from the whole dataset.
+     *
+     * @param[in] p_data: points that are stored by the tree.
+     * @param[in] p_metric: metric that is used to build the tree and to search neighbors, it should satisfy the
+     *             triangle inequality (square Euclidean, cosine and Minkowski with degree less than 1 are rejected).
+     * @param[in] p_leaf_size: maximum amount of points in a leaf.
+     *
+     */
+    vptree(const dense_dataset & p_data,
+           const utils::metric::distance_metric<point> & p_metric,
+           const std::size_t p_leaf_size = DEFAULT_LEAF_SIZE);
+
+    vptree(const vptree & p_other) = default;
+
+    vptree(vptree && p_other) = default;
+
+    ~vptree(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Calls action for each point that is located within radius from the specified point.
+     *
+     * @param[in] p_point: point for which neighbors are searched, it should provide 'data()' and 'size()'
+     *             (for example, 'point' or 'point_view').
+     * @param[in] p_radius: radius of the search.
+     * @param[in] p_action: action with signature 'void(const std::size_t p_index, const double p_distance)'
+     *             where index is index of the found point in the original dataset.
+     *
+     */
+    template <typename TypePoint, typename TypeAction>
+    void find_nearest(const TypePoint & p_point, const double p_radius, const TypeAction & p_action) const;
+
+    /**
+     *
+     * @brief   Returns indexes of points that are located within radius from the specified point and distances
+     *           to them.
+     *
+     */
+    template <typename TypePoint>
+    void find_nearest(const TypePoint & p_point, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_distances) const;
+
+    /**
+     *
+     * @brief   Finds k nearest points to the specified point, the point itself is returned if it is stored by the tree.
+     * @details Subtrees are visited in order of lower bounds of distances to them.
+     *
+     * @param[in]  p_point: point for which neighbors are searched.
+     * @param[in]  p_amount: amount of neighbors that should be found.
+     * @param[out] p_indexes: indexes of found points in the original dataset sorted by distance.
+     * @param[out] p_distances: distances to found points in ascending order.
+     *
+     */
+    template <typename TypePoint>
+    void find_k_nearest(const TypePoint & p_point, const std::size_t p_amount, std::vector<std::size_t> & p_indexes, std::vector<double> & p_distances) const;
+
+    std::size_t size(void) const;
+
+    bool empty(void) const;
+
+    std::size_t get_dimension(void) const;
+
+    std::size_t get_leaf_size(void) const;
+
+    const utils::metric::distance_metric<point> & get_metric(void) const;
+
+    /**
+     *
+     * @brief   Returns amount of nodes of the tree (internal nodes and leaves).
+     *
+     */
+    std::size_t get_amount_nodes(void) const;
+
+    /**
+     *
+     * @brief   Returns length of the longest path from the root to a leaf, tree with one leaf has depth 1.
+     *
+     */
+    std::size_t get_depth(void) const;
+
+public:
+    vptree & operator=(const vptree & p_other) = default;
+
+    vptree & operator=(vptree && p_other) = default;
+
+private:
+    std::size_t create_subtree(const dense_dataset & p_data, const std::size_t p_begin, const std::size_t p_end);
+
+    std::size_t get_depth(const std::size_t p_node) const;
+
+    point_view get_point(const std::size_t p_position) const;
+
+    /* lower bound of distance from a point to points of the child, distance to the vantage point of the parent is used */
+    double get_lower_bound(const node & p_child, const double p_distance) const;
+};
+
+
+template <typename TypePoint, typename TypeAction>
+void vptree::find_nearest(const TypePoint & p_point, const double p_radius, const TypeAction & p_action) const {
+    if (m_nodes.empty()) {
+        return;
+    }
+
+    std::size_t calculations = 0;
+
+    std::vector<std::size_t> stack = { 0 };
+    while (!stack.empty()) {
+        const node & current = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (current.m_inner == INVALID_INDEX) {
+            for (std::size_t position = current.m_begin; position < current.m_end; position++) {
+                const double distance = m_metric(p_point, get_point(position));
+                if (distance <= p_radius) {
+                    p_action(m_indexes[position], distance);
+                }
+            }
+
+            calculations += current.m_end - current.m_begin;
+            continue;
+        }
+
+        const double distance = m_metric(p_point, get_point(current.m_begin));
+        calculations++;
+
+        if (distance <= p_radius) {
+            p_action(m_indexes[current.m_begin], distance);
+        }
+
+        for (const std::size_t child : { current.m_outer, current.m_inner }) {
+            if (get_lower_bound(m_nodes[child], distance) <= p_radius) {
+                stack.push_back(child);
+            }
+        }
+    }
+
+    utils::statistics::statistics_collector::increment(utils::statistics::counter_t::DISTANCE_CALCULATIONS, calculations);
+}
+
+
+template <typename TypePoint>
+void vptree::find_nearest(const TypePoint & p_point, const double p_radius, std::vector<std::size_t> & p_indexes, std::vector<double> & p_distances) const {
+    p_indexes.clear();
+    p_distances.clear();
+
+    find_nearest(p_point, p_radius, [&p_indexes, &p_distances](const std::size_t p_index, const double p_distance) {
+        p_indexes.push_back(p_index);
+        p_distances.push_back(p_distance);
+    });
+}
+
+
+template <typename TypePoint>
+void vptree::find_k_nearest(const TypePoint & p_point, const std::size_t p_amount, std::vector<std::size_t> & p_indexes, std::vector<double> & p_distances) const {
+    p_indexes.clear();
+    p_distances.clear();
+
+    if (m_nodes.empty() || (p_amount == 0)) {
+        return;
+    }
+
+    using candidate = std::pair<double, std::size_t>;     /* distance to node or point and its index */
+
+    std::size_t calculations = 0;
+
+    std::priority_queue<candidate> nearest;     /* the farthest found point is on the top */
+    const auto consider = [&nearest, p_amount](const double p_distance, const std::size_t p_index) {
+        if (nearest.size() < p_amount) {
+            nearest.emplace(p_distance, p_index);
+        }
+        else if (p_distance < nearest.top().first) {
+            nearest.pop();
+            nearest.emplace(p_distance, p_index);
+        }
+    };
+
+    std::priority_queue<candidate, std::vector<candidate>, std::greater<candidate>> queue;     /* the closest node is on the top */
+    queue.emplace(0.0, 0);
+
+    while (!queue.empty()) {
+        const candidate state = queue.top();
+        queue.pop();
+
+        if ((nearest.size() == p_amount) && (state.first > nearest.top().first)) {
+            break;      /* other nodes are not closer than the found points */
+        }
+
+        const node & current = m_nodes[state.second];
+        if (current.m_inner == INVALID_INDEX) {
+            for (std::size_t position = current.m_begin; position < current.m_end; position++) {
+                consider(m_metric(p_point, get_point(position)), m_indexes[position]);
+            }
+
+            calculations += current.m_end - current.m_begin;
+            continue;
+        }
+
+        const double distance = m_metric(p_point, get_point(current.m_begin));
+        consider(distance, m_indexes[current.m_begin]);
+        calculations++;
+
+        for (const std::size_t child : { current.m_inner, current.m_outer }) {
+            const double lower_bound = std::max(state.first, get_lower_bound(m_nodes[child], distance));
+            if ((nearest.size() < p_amount) || (lower_bound <= nearest.top().first)) {
+                queue.emplace(lower_bound, child);
+            }
+        }
+    }
+
+    p_indexes.resize(nearest.size());
+    p_distances.resize(nearest.size());
+    for (std::size_t position = nearest.size(); position > 0; position--) {
+        p_distances[position - 1] = nearest.top().first;
+        p_indexes[position - 1] = nearest.top().second;
+        nearest.pop();
+    }
+
+    utils::statistics::statistics_collector::increment(utils::statistics::counter_t::DISTANCE_CALCULATIONS, calculations);
+}
+
+
+}
+
+}
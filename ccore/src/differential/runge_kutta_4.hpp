@@ -27,6 +27,8 @@
 
 #include <functional>
 
+#include "utils/trace.hpp"
+
 
 namespace ccore {
 
@@ -43,6 +45,8 @@ void runge_kutta_4(const equation<state_type, extra_type> & func,
                    const differ_extra<extra_type> &         argv,           /* additional arguments that are used in the equation */
                    differ_result<state_type> &              outputs) {
 
+    utils::trace::trace_scope trace("runge_kutta_4", "ode");
+
     const double step = (time_end - time_start) / (double) steps;
 
     if (flag_collect) {
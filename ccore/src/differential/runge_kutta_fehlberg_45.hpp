@@ -29,6 +29,8 @@
 #include "equation.hpp"
 #include "solve_type.hpp"
 
+#include "utils/trace.hpp"
+
 
 namespace ccore {
 
@@ -46,6 +48,8 @@ void runge_kutta_fehlberg_45(
                    const differ_extra<extra_type> &         argv,
                    differ_result<state_type> &              outputs) {
 
+    utils::trace::trace_scope trace("runge_kutta_fehlberg_45", "ode");
+
     if (flag_collect) {
         outputs.clear();
     }
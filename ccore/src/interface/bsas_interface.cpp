@@ -42,7 +42,7 @@ pyclustering_package * bsas_algorithm(const pyclustering_package * const p_sampl
 
     ccore::clst::bsas algorithm(p_amount, p_threshold, *metric);
 
-    dataset input_dataset;
+    ccore::container::dense_dataset input_dataset;
     p_sample->extract(input_dataset);
 
     ccore::clst::bsas_data output_result;
@@ -53,7 +53,7 @@ pyclustering_package * bsas_algorithm(const pyclustering_package * const p_sampl
     package->data = new pyclustering_package * [BSAS_PACKAGE_SIZE];
 
     ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_CLUSTERS] = create_package(&output_result.clusters());
-    ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_REPRESENTATIVES] = create_package(&output_result.representatives());
+    ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_REPRESENTATIVES] = create_matrix_package(&output_result.representatives());
 
     return package;
 }
\ No newline at end of file
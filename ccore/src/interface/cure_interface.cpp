@@ -60,6 +60,6 @@ pyclustering_package * cure_get_representors(void * pointer_cure_data) {
 pyclustering_package * cure_get_means(void * pointer_cure_data) {
     ccore::clst::cure_data & output_result = (ccore::clst::cure_data &) *((ccore::clst::cure_data *)pointer_cure_data);
 
-    pyclustering_package * package = create_package(&output_result.means());
+    pyclustering_package * package = create_matrix_package(&output_result.means());
     return package;
 }
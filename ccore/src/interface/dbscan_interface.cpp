@@ -28,14 +28,22 @@ pyclustering_package * dbscan_algorithm(const pyclustering_package * const sampl
                                         const size_t minumum_neighbors,
                                         const size_t p_data_type)
 {
-    dataset input_dataset;
-    sample->extract(input_dataset);
-
     ccore::clst::dbscan solver(radius, minumum_neighbors);
 
     ccore::clst::dbscan_data output_result;
 
-    solver.process(input_dataset, (ccore::clst::dbscan_data_t) p_data_type, output_result);
+    if ((ccore::clst::dbscan_data_t) p_data_type == ccore::clst::dbscan_data_t::DISTANCE_MATRIX) {
+        ccore::container::pairwise_distance_matrix<double> input_matrix;
+        sample->extract(input_matrix);
+
+        solver.process(input_matrix, output_result);
+    }
+    else {
+        ccore::container::dense_dataset input_dataset;
+        sample->extract(input_dataset);
+
+        solver.process(input_dataset, (ccore::clst::dbscan_data_t) p_data_type, output_result);
+    }
 
     pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
     package->size = output_result.size() + 1;   /* the last for noise */
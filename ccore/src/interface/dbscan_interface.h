@@ -32,7 +32,8 @@
  *          from input data.
  * @details Caller should destroy returned result by 'free_pyclustering_package'.
  *
- * @param[in] p_sample: input data for clustering (points or distance matrix).
+ * @param[in] p_sample: input data for clustering (points or distance matrix), distance matrix is square matrix
+ *             or condensed upper triangle without diagonal (package of values).
  * @param[in] p_radius: connectivity radius between points, points may be connected if distance
  *             between them less then the radius.
  * @param[in] p_minumum_neighbors: minimum number of shared neighbors that is required for
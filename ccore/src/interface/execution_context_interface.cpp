@@ -0,0 +1,159 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "interface/execution_context_interface.h"
+
+#include "parallel/execution_context.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+using namespace ccore::parallel;
+
+
+namespace {
+
+
+using active_scope = std::pair<const void *, std::unique_ptr<execution_context_scope>>;
+
+
+/* activated contexts of each thread form stack, each scope restores previous context when it is removed from top */
+thread_local std::vector<active_scope> ACTIVE_SCOPES = { };
+
+
+}
+
+
+void ccore_set_thread_count(const std::size_t p_thread_count) {
+    execution_context context = execution_context::get_default();
+    context.set_thread_count(p_thread_count);
+    context.set_serial(false);
+
+    execution_context::set_default(context);
+}
+
+
+std::size_t ccore_get_thread_count(void) {
+    return execution_context::get_default().get_thread_count();
+}
+
+
+bool ccore_set_thread_affinity(const pyclustering_package * const p_cpus) {
+    if (!p_cpus) {
+        return false;
+    }
+
+    std::vector<std::size_t> cpus;
+    p_cpus->extract(cpus);
+
+    execution_context context = execution_context::get_default();
+    context.set_affinity(cpus);
+
+    try {
+        execution_context::set_default(context);
+    }
+    catch (const std::invalid_argument &) {
+        return false;
+    }
+
+    return true;
+}
+
+
+void * execution_context_create(const std::size_t p_thread_count, const bool p_serial) {
+    return new execution_context(p_thread_count, p_serial);
+}
+
+
+void execution_context_destroy(const void * p_context) {
+    if (!p_context) {
+        return;
+    }
+
+    auto owner = std::find_if(ACTIVE_SCOPES.begin(), ACTIVE_SCOPES.end(), [p_context](const active_scope & p_scope) {
+        return p_scope.first == p_context;
+    });
+
+    /* scopes above the context refer to it as to previous one, therefore they are removed too */
+    const std::size_t depth = std::distance(ACTIVE_SCOPES.begin(), owner);
+    while (ACTIVE_SCOPES.size() > depth) {
+        ACTIVE_SCOPES.pop_back();
+    }
+
+    delete (const execution_context *) p_context;
+}
+
+
+void execution_context_activate(const void * p_context) {
+    std::unique_ptr<execution_context_scope> scope(new execution_context_scope((const execution_context *) p_context));
+    ACTIVE_SCOPES.emplace_back(p_context, std::move(scope));
+}
+
+
+bool execution_context_deactivate(const void * p_context) {
+    if (ACTIVE_SCOPES.empty() || (ACTIVE_SCOPES.back().first != p_context)) {
+        return false;
+    }
+
+    ACTIVE_SCOPES.pop_back();
+    return true;
+}
+
+
+void execution_context_set_cancellation_token(void * p_context, const void * p_token) {
+    ((execution_context *) p_context)->set_cancellation_token(*((const cancellation_token *) p_token));
+}
+
+
+void * cancellation_token_create(void) {
+    return new cancellation_token();
+}
+
+
+void cancellation_token_destroy(const void * p_token) {
+    delete (const cancellation_token *) p_token;
+}
+
+
+void cancellation_token_cancel(void * p_token) {
+    ((cancellation_token *) p_token)->cancel();
+}
+
+
+bool cancellation_token_set_timeout(void * p_token, const double p_seconds) {
+    try {
+        ((cancellation_token *) p_token)->set_timeout(p_seconds);
+    }
+    catch (const std::invalid_argument &) {
+        return false;
+    }
+
+    return true;
+}
+
+
+bool cancellation_token_is_cancelled(const void * p_token) {
+    return ((const cancellation_token *) p_token)->is_cancelled();
+}
@@ -0,0 +1,178 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+
+#include "interface/pyclustering_package.hpp"
+
+#include "definitions.hpp"
+
+
+/**
+ *
+ * @brief   Sets amount of threads that are used by algorithms of the library by default.
+ * @details Worker threads are recreated if the amount is changed, therefore the function should not be called
+ *           while algorithms are running.
+ *
+ * @param[in] p_thread_count: amount of threads including caller, 0 means amount of hardware threads, 1 means that
+ *             algorithms are executed serially.
+ *
+ */
+extern "C" DECLARATION void ccore_set_thread_count(const std::size_t p_thread_count);
+
+
+/**
+ *
+ * @brief   Returns amount of threads that are used by algorithms of the library by default.
+ *
+ */
+extern "C" DECLARATION std::size_t ccore_get_thread_count(void);
+
+
+/**
+ *
+ * @brief   Binds worker threads of the library to specified CPUs (by 'sched_setaffinity' on Linux).
+ *
+ * @param[in] p_cpus: package with indexes of CPUs, empty package means that threads are not bound.
+ *
+ * @return  Returns 'true' if affinity is changed, 'false' if package is not specified or some of CPUs are not supported
+ *           by the system.
+ *
+ */
+extern "C" DECLARATION bool ccore_set_thread_affinity(const pyclustering_package * const p_cpus);
+
+
+/**
+ *
+ * @brief   Creates execution context that can be activated for calls of algorithms from the current thread.
+ *
+ * @param[in] p_thread_count: maximum amount of threads including caller, 0 means amount of hardware threads.
+ * @param[in] p_serial: if 'true' then algorithms are executed serially by the caller.
+ *
+ * @return  Returns pointer to execution context, it should be destroyed by 'execution_context_destroy'.
+ *
+ */
+extern "C" DECLARATION void * execution_context_create(const std::size_t p_thread_count, const bool p_serial);
+
+
+/**
+ *
+ * @brief   Destroys execution context.
+ * @details If the context is active in the current thread then it is deactivated together with contexts that have
+ *           been activated after it. The context should not be active in other threads.
+ *
+ * @param[in] p_context: pointer to execution context.
+ *
+ */
+extern "C" DECLARATION void execution_context_destroy(const void * p_context);
+
+
+/**
+ *
+ * @brief   Activates execution context for all following calls of algorithms from the current thread.
+ * @details Activated contexts are nested, the context is active until it is deactivated by
+ *           'execution_context_deactivate', after that previously active context is restored.
+ *
+ * @param[in] p_context: pointer to execution context, nullptr activates the default context.
+ *
+ */
+extern "C" DECLARATION void execution_context_activate(const void * p_context);
+
+
+/**
+ *
+ * @brief   Deactivates execution context that has been activated last in the current thread and restores previous one.
+ *
+ * @param[in] p_context: pointer to execution context that has been activated last, nullptr for the default context.
+ *
+ * @return  Returns 'false' if the context is not the last activated context of the current thread, in this case
+ *           nothing is changed.
+ *
+ */
+extern "C" DECLARATION bool execution_context_deactivate(const void * p_context);
+
+
+/**
+ *
+ * @brief   Attaches cancellation token to execution context, calls of agglomerative, ROCK, CURE and HSyncNet algorithms
+ *           that are executed in the context are stopped when the token is cancelled and return partial results.
+ *
+ * @param[in] p_context: pointer to execution context.
+ * @param[in] p_token: pointer to cancellation token, the context shares state of the token.
+ *
+ */
+extern "C" DECLARATION void execution_context_set_cancellation_token(void * p_context, const void * p_token);
+
+
+/**
+ *
+ * @brief   Creates cancellation token that is not cancelled and does not have deadline.
+ *
+ * @return  Returns pointer to cancellation token, it should be destroyed by 'cancellation_token_destroy'.
+ *
+ */
+extern "C" DECLARATION void * cancellation_token_create(void);
+
+
+/**
+ *
+ * @brief   Destroys cancellation token, contexts that use the token keep its state.
+ *
+ * @param[in] p_token: pointer to cancellation token.
+ *
+ */
+extern "C" DECLARATION void cancellation_token_destroy(const void * p_token);
+
+
+/**
+ *
+ * @brief   Requests cancellation of calls that use the token, it can be called from any thread.
+ *
+ * @param[in] p_token: pointer to cancellation token.
+ *
+ */
+extern "C" DECLARATION void cancellation_token_cancel(void * p_token);
+
+
+/**
+ *
+ * @brief   Sets deadline of the token in seconds from the current time, the token is cancelled after the deadline.
+ * @details Timeout that exceeds range of the clock (including infinity) removes deadline.
+ *
+ * @param[in] p_token: pointer to cancellation token.
+ * @param[in] p_seconds: timeout in seconds.
+ *
+ * @return  Returns 'false' if the timeout is negative or NaN, in this case deadline is not changed.
+ *
+ */
+extern "C" DECLARATION bool cancellation_token_set_timeout(void * p_token, const double p_seconds);
+
+
+/**
+ *
+ * @brief   Returns 'true' if cancellation has been requested or deadline of the token has expired.
+ *
+ * @param[in] p_token: pointer to cancellation token.
+ *
+ */
+extern "C" DECLARATION bool cancellation_token_is_cancelled(const void * p_token);
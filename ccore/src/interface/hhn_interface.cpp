@@ -92,7 +92,7 @@ pyclustering_package * hhn_dynamic_get_peripheral_evolution(const void * p_outpu
     hhn_dynamic * dynamic = (hhn_dynamic *) p_output_dynamic;
     hhn_dynamic::evolution_dynamic & evolution = dynamic->get_peripheral_dynamic((hhn_dynamic::collect) p_collection_index);
 
-    pyclustering_package * package = create_package(&evolution);
+    pyclustering_package * package = create_matrix_package(&evolution);
     return package;
 }
 
@@ -101,7 +101,7 @@ pyclustering_package * hhn_dynamic_get_central_evolution(const void * p_output_d
     hhn_dynamic * dynamic = (hhn_dynamic *) p_output_dynamic;
     hhn_dynamic::evolution_dynamic & evolution = dynamic->get_central_dynamic((hhn_dynamic::collect) p_collection_index);
 
-    pyclustering_package * package = create_package(&evolution);
+    pyclustering_package * package = create_matrix_package(&evolution);
     return package;
 }
 
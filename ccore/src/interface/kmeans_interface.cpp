@@ -34,7 +34,8 @@ pyclustering_package * kmeans_algorithm(const pyclustering_package * const p_sam
                                         const bool p_observe,
                                         const void * const p_metric)
 {
-    dataset data, centers;
+    ccore::container::dense_dataset data;
+    dataset centers;
 
     p_sample->extract(data);
     p_initial_centers->extract(centers);
@@ -52,7 +53,7 @@ pyclustering_package * kmeans_algorithm(const pyclustering_package * const p_sam
 
     pyclustering_package * package = create_package_container(KMEANS_PACKAGE_SIZE);
     ((pyclustering_package **) package->data)[KMEANS_PACKAGE_INDEX_CLUSTERS] = create_package(&output_result.clusters());
-    ((pyclustering_package **) package->data)[KMEANS_PACKAGE_INDEX_CENTERS] = create_package(&output_result.centers());
+    ((pyclustering_package **) package->data)[KMEANS_PACKAGE_INDEX_CENTERS] = create_matrix_package(&output_result.centers());
     ((pyclustering_package **) package->data)[KMEANS_PACKAGE_INDEX_EVOLUTION_CLUSTERS] = create_package(&output_result.evolution_clusters());
     ((pyclustering_package **) package->data)[KMEANS_PACKAGE_INDEX_EVOLUTION_CENTERS] = create_package(&output_result.evolution_centers());
 
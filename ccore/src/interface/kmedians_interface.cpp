@@ -28,7 +28,8 @@ pyclustering_package * kmedians_algorithm(const pyclustering_package * const p_s
                                           const double p_tolerance, 
                                           const void * const p_metric)
 {
-    dataset data, medians;
+    ccore::container::dense_dataset data;
+    dataset medians;
 
     p_sample->extract(data);
     p_initial_medians->extract(medians);
@@ -46,7 +47,7 @@ pyclustering_package * kmedians_algorithm(const pyclustering_package * const p_s
 
     pyclustering_package * package = create_package_container(KMEDIANS_PACKAGE_SIZE);
     ((pyclustering_package **) package->data)[KMEDIANS_PACKAGE_INDEX_CLUSTERS] = create_package(&output_result.clusters());
-    ((pyclustering_package **) package->data)[KMEDIANS_PACKAGE_INDEX_MEDIANS] = create_package(&output_result.medians());
+    ((pyclustering_package **) package->data)[KMEDIANS_PACKAGE_INDEX_MEDIANS] = create_matrix_package(&output_result.medians());
 
     return package;
 }
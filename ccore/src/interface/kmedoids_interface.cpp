@@ -45,11 +45,20 @@ pyclustering_package * kmedoids_algorithm(const pyclustering_package * const p_s
 
     ccore::clst::kmedoids algorithm(medoids, p_tolerance, *metric);
 
-    dataset input_dataset;
-    p_sample->extract(input_dataset);
-
     ccore::clst::kmedoids_data output_result;
-    algorithm.process(input_dataset, (ccore::clst::kmedoids_data_t) p_type, output_result);
+
+    if ((ccore::clst::kmedoids_data_t) p_type == ccore::clst::kmedoids_data_t::DISTANCE_MATRIX) {
+        ccore::container::pairwise_distance_matrix<double> input_matrix;
+        p_sample->extract(input_matrix);
+
+        algorithm.process(input_matrix, output_result);
+    }
+    else {
+        ccore::container::dense_dataset input_dataset;
+        p_sample->extract(input_dataset);
+
+        algorithm.process(input_dataset, (ccore::clst::kmedoids_data_t) p_type, output_result);
+    }
 
     pyclustering_package * package = create_package_container(KMEDOIDS_PACKAGE_SIZE);
     ((pyclustering_package **) package->data)[KMEDOIDS_PACKAGE_INDEX_CLUSTERS] = create_package(&output_result.clusters());
@@ -44,7 +44,8 @@ enum kmedoids_package_indexer {
  * @brief   Clustering algorithm K-Medoids returns allocated clusters.
  * @details Caller should destroy returned result that is in 'pyclustering_package'.
  *
- * @param[in] p_sample: input data for clustering.
+ * @param[in] p_sample: input data for clustering (points or distance matrix), distance matrix is square matrix
+ *             or condensed upper triangle without diagonal (package of values).
  * @param[in] p_medoids: initial medoids of clusters.
  * @param[in] p_tolerance: stop condition - when changes of medians are less then tolerance value.
  * @param[in] p_metric: pointer to distance metric 'distance_metric' that is used for distance calculation between two points.
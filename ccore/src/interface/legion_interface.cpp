@@ -20,6 +20,8 @@
 
 #include "interface/legion_interface.h"
 
+#include <algorithm>
+
 #include "nnet/legion.hpp"
 
 
@@ -67,12 +69,12 @@ void legion_dynamic_destroy(const void * pointer) {
 pyclustering_package * legion_dynamic_get_output(const void * pointer) {
     legion_dynamic & dynamic = *((legion_dynamic *) pointer);
 
-    pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
-    package->size = dynamic.size();
-    package->data = new pyclustering_package * [package->size];
+    const std::size_t amount_oscillators = dynamic.size() > 0 ? dynamic[0].m_output.size() : 0;
+    pyclustering_package * package = create_matrix_package<double>(dynamic.size(), amount_oscillators);
 
-    for (unsigned int i = 0; i < package->size; i++) {
-        ((pyclustering_package **) package->data)[i] = create_package(&dynamic[i].m_output);
+    double * output = (double *) package->data;
+    for (std::size_t i = 0; i < dynamic.size(); i++) {
+        output = std::copy(dynamic[i].m_output.begin(), dynamic[i].m_output.end(), output);
     }
 
     return package;
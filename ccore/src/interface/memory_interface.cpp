@@ -0,0 +1,54 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "interface/memory_interface.h"
+
+#include "utils/memory.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+
+using namespace ccore::utils::memory;
+
+
+std::size_t memory_get_current(void) {
+    return memory_usage::get_current();
+}
+
+
+std::size_t memory_get_peak(void) {
+    return memory_usage::get_peak();
+}
+
+
+std::size_t memory_estimate(const char * p_algorithm, const pyclustering_package * const p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    std::vector<double> parameters;
+    if (p_parameters != nullptr) {
+        p_parameters->extract(parameters);
+    }
+
+    try {
+        return estimate_memory(p_algorithm, parameters, p_size, p_dimension);
+    }
+    catch (std::invalid_argument &) {
+        return 0;
+    }
+}
@@ -0,0 +1,63 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+
+#include "interface/pyclustering_package.hpp"
+
+#include "definitions.hpp"
+
+
+/**
+ *
+ * @brief   Returns amount of bytes that is used by tracked containers of the library (adjacency matrices, datasets,
+ *           matrices of networks and output dynamics) at the moment.
+ *
+ */
+extern "C" DECLARATION std::size_t memory_get_current(void);
+
+
+/**
+ *
+ * @brief   Returns maximum amount of bytes that has been used by tracked containers of the library.
+ *
+ */
+extern "C" DECLARATION std::size_t memory_get_peak(void);
+
+
+/**
+ *
+ * @brief   Estimates amount of memory in bytes that is required by an algorithm to process data.
+ * @details It is used to reject tasks that do not fit into available memory before they are started.
+ *
+ * @param[in] p_algorithm: name of the algorithm, for example, "rock" or "syncnet".
+ * @param[in] p_parameters: parameters of the algorithm that affect required memory (package of doubles) or 'nullptr',
+ *             see 'ccore::utils::memory::estimate_memory' for parameters of each algorithm.
+ * @param[in] p_size: amount of points in input data or amount of oscillators in a network.
+ * @param[in] p_dimension: dimension of input data.
+ *
+ * @return  Estimated amount of bytes or 0 if the algorithm is not supported.
+ *
+ */
+extern "C" DECLARATION std::size_t memory_estimate(const char * p_algorithm, const pyclustering_package * const p_parameters, const std::size_t p_size, const std::size_t p_dimension);
@@ -21,8 +21,16 @@
 
 #include "interface/metric_interface.h"
 
+#include "container/dense_dataset.hpp"
+
+#include "parallel/parallel.hpp"
+
 #include "utils/metric.hpp"
 
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
 
 using namespace ccore::utils::metric;
 
@@ -54,6 +62,10 @@ void * metric_create(const std::size_t p_type,
         }
 
         case MINKOWSKI: {
+            if (!p_arguments || (p_arguments->size == 0)) {
+                return nullptr;
+            }
+
             std::vector<double> arguments;
             p_arguments->extract(arguments);
 
@@ -61,6 +73,77 @@ void * metric_create(const std::size_t p_type,
             return new distance_metric<point>(std::move(metric));
         }
 
+        case COSINE: {
+            distance_metric<point> metric = distance_metric_factory<point>::cosine();
+            return new distance_metric<point>(std::move(metric));
+        }
+
+        case CANBERRA: {
+            distance_metric<point> metric = distance_metric_factory<point>::canberra();
+            return new distance_metric<point>(std::move(metric));
+        }
+
+        case WEIGHTED_EUCLIDEAN: {
+            if (!p_arguments) {
+                return nullptr;
+            }
+
+            std::vector<double> weights;
+            p_arguments->extract(weights);
+
+            try {
+                distance_metric<point> metric = distance_metric_factory<point>::weighted_euclidean(weights);
+                return new distance_metric<point>(std::move(metric));
+            }
+            catch (const std::invalid_argument &) {
+                return nullptr;
+            }
+        }
+
+        case GOWER: {
+            if (!p_arguments) {
+                return nullptr;
+            }
+
+            std::vector<double> ranges;
+            p_arguments->extract(ranges);
+
+            try {
+                distance_metric<point> metric = distance_metric_factory<point>::gower(ranges);
+                return new distance_metric<point>(std::move(metric));
+            }
+            catch (const std::invalid_argument &) {
+                return nullptr;
+            }
+        }
+
+        case MAHALANOBIS: {
+            if (!p_arguments) {
+                return nullptr;
+            }
+
+            std::vector<double> arguments;
+            p_arguments->extract(arguments);
+
+            const std::size_t dimension = (std::size_t) std::round(std::sqrt((double) arguments.size()));
+            if (dimension * dimension != arguments.size()) {
+                return nullptr;
+            }
+
+            std::vector<std::vector<double>> inverse_covariance(dimension);
+            for (std::size_t row = 0; row < dimension; row++) {
+                inverse_covariance[row].assign(arguments.begin() + row * dimension, arguments.begin() + (row + 1) * dimension);
+            }
+
+            try {
+                distance_metric<point> metric = distance_metric_factory<point>::mahalanobis(inverse_covariance);
+                return new distance_metric<point>(std::move(metric));
+            }
+            catch (const std::invalid_argument &) {
+                return nullptr;
+            }
+        }
+
         case USER_DEFINED: {
             auto functor_wrapper = [p_solver](const point & p1, const point & p2) {
                 pyclustering_package * point1 = create_package(&p1);
@@ -98,5 +181,88 @@ double metric_calculate(const void * p_pointer_metric,
     p_point2->extract(point2);
 
     distance_metric<point> & metric = *((distance_metric<point> *) p_pointer_metric);
+    if ((metric.get_dimension() > 0) && ((point1.size() != metric.get_dimension()) || (point2.size() != metric.get_dimension()))) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
     return metric(point1, point2);
 }
+
+
+pyclustering_package * metric_calculate_batch(const void * p_pointer_metric,
+                                              const pyclustering_package * const p_point,
+                                              const pyclustering_package * const p_points)
+{
+    point object;
+    p_point->extract(object);
+
+    ccore::container::dense_dataset points;
+    p_points->extract(points);
+
+    if (!points.empty() && (points.dimension() != object.size())) {
+        return nullptr;
+    }
+
+    const distance_metric<point> & metric = *((const distance_metric<point> *) p_pointer_metric);
+    if ((metric.get_dimension() > 0) && (object.size() != metric.get_dimension())) {
+        return nullptr;
+    }
+
+    pyclustering_package * package = create_package<double>(points.size());
+    double * distances = (double *) package->data;
+
+    visit_metric(metric, [&object, &points, distances](const auto & p_metric) {
+        for (std::size_t index = 0; index < points.size(); index++) {
+            distances[index] = p_metric(object, points.row(index));
+        }
+    });
+
+    return package;
+}
+
+
+pyclustering_package * metric_calculate_pairwise(const void * p_pointer_metric,
+                                                 const pyclustering_package * const p_block1,
+                                                 const pyclustering_package * const p_block2)
+{
+    ccore::container::dense_dataset block1, block2;
+    p_block1->extract(block1);
+    p_block2->extract(block2);
+
+    if (!block1.empty() && !block2.empty() && (block1.dimension() != block2.dimension())) {
+        return nullptr;
+    }
+
+    const distance_metric<point> & metric = *((const distance_metric<point> *) p_pointer_metric);
+    if (metric.get_dimension() > 0) {
+        if ((!block1.empty() && (block1.dimension() != metric.get_dimension())) || (!block2.empty() && (block2.dimension() != metric.get_dimension()))) {
+            return nullptr;
+        }
+    }
+
+    pyclustering_package * package = create_matrix_package<double>(block1.size(), block2.size());
+    double * distances = (double *) package->data;
+
+    visit_metric(metric, [&metric, &block1, &block2, distances](const auto & p_metric) {
+        const auto calculate_row = [&p_metric, &block1, &block2, distances](const std::size_t p_row) {
+            const ccore::container::point_view object = block1.row(p_row);
+            double * row_distances = distances + p_row * block2.size();
+
+            for (std::size_t index = 0; index < block2.size(); index++) {
+                row_distances[index] = p_metric(object, block2.row(index));
+            }
+        };
+
+        /* user-defined metric may call back to the caller that is not ready for concurrent calls */
+        if (metric.get_type() == metric_type::USER_DEFINED) {
+            for (std::size_t index = 0; index < block1.size(); index++) {
+                calculate_row(index);
+            }
+        }
+        else {
+            ccore::parallel::parallel_for(std::size_t(0), block1.size(), calculate_row);
+        }
+    });
+
+    return package;
+}
@@ -33,6 +33,11 @@ enum metric_t {
     MANHATTAN,
     CHEBYSHEV,
     MINKOWSKI,
+    COSINE,
+    MAHALANOBIS,
+    WEIGHTED_EUCLIDEAN,
+    CANBERRA,
+    GOWER,
     USER_DEFINED = 1000
 };
 
@@ -42,11 +47,15 @@ enum metric_t {
  * @brief   Create distance metric for calculation distance between two points.
  *
  * @param[in] p_type: metric type that is require to create.
- * @param[in] p_arguments: additional arguments, for example, degree in case of minkowski distance.
+ * @param[in] p_arguments: additional arguments, for example, degree in case of minkowski distance, weights
+ *             in case of weighted euclidean distance, range of each feature in case of gower distance,
+ *             flattened inverse covariance matrix (row by row) in case of mahalanobis distance.
  * @param[in] p_solver: pointer to user-defined function that should be used for calculation, used only
  *             in case of 'USER_DEFINED' metric type.
  *
- * @return  Returns pointer to metric object, returned object should be destroyed by 'metric_destroy'.
+ * @return  Returns pointer to metric object, returned object should be destroyed by 'metric_destroy',
+ *           nullptr if arguments are incorrect (for example, they are empty or inverse covariance matrix is
+ *           not positive-definite).
  *
  */
 extern "C" DECLARATION void * metric_create(const std::size_t p_type,
@@ -72,10 +81,48 @@ extern "C" DECLARATION void metric_destroy(const void * p_pointer_metric);
  * @param[in] p_point1: pointer to package with the first point.
  * @param[in] p_point2: pointer to package with the second point.
  *
- * @return  Distance metric between two points.
+ * @return  Distance metric between two points, NaN if dimension of points does not correspond to arguments
+ *           of the metric (weights, ranges of features or inverse covariance matrix).
  *
  */
 extern "C" DECLARATION double metric_calculate(const void * p_pointer_metric,
                                                const pyclustering_package * const p_point1,
                                                const pyclustering_package * const p_point2);
 
+
+/**
+ *
+ * @brief   Calculate metric between one point and each point of a collection.
+ *
+ * @param[in] p_pointer_metric: pointer to distance metric object.
+ * @param[in] p_point: pointer to package with the point.
+ * @param[in] p_points: pointer to package with points (list of points or matrix).
+ *
+ * @return  Returns package with distance to each point of the collection, nullptr if dimensions are
+ *           not equal or do not correspond to arguments of the metric, returned package should be destroyed
+ *           by 'free_pyclustering_package'.
+ *
+ */
+extern "C" DECLARATION pyclustering_package * metric_calculate_batch(const void * p_pointer_metric,
+                                                                     const pyclustering_package * const p_point,
+                                                                     const pyclustering_package * const p_points);
+
+
+/**
+ *
+ * @brief   Calculate metric between each point of the first block and each point of the second block.
+ *
+ * @param[in] p_pointer_metric: pointer to distance metric object.
+ * @param[in] p_block1: pointer to package with points of the first block (list of points or matrix).
+ * @param[in] p_block2: pointer to package with points of the second block (list of points or matrix).
+ *
+ * @return  Returns matrix package where element [i][j] is distance between the i-th point of the first
+ *           block and the j-th point of the second block, nullptr if dimensions are not equal or do not
+ *           correspond to arguments of the metric, returned package should be destroyed by
+ *           'free_pyclustering_package'.
+ *
+ */
+extern "C" DECLARATION pyclustering_package * metric_calculate_pairwise(const void * p_pointer_metric,
+                                                                        const pyclustering_package * const p_block1,
+                                                                        const pyclustering_package * const p_block2);
+
@@ -20,6 +20,8 @@
 
 #include "interface/pcnn_interface.h"
 
+#include <algorithm>
+
 
 using namespace ccore::nnet;
 
@@ -86,12 +88,12 @@ pyclustering_package * pcnn_dynamic_allocate_time_signal(const void * pointer) {
 pyclustering_package * pcnn_dynamic_get_output(const void * pointer) {
     pcnn_dynamic & dynamic = *((pcnn_dynamic *) pointer);
 
-    pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
-    package->size = dynamic.size();
-    package->data = new pyclustering_package * [package->size];
+    const std::size_t amount_oscillators = dynamic.size() > 0 ? dynamic[0].m_output.size() : 0;
+    pyclustering_package * package = create_matrix_package<double>(dynamic.size(), amount_oscillators);
 
-    for (unsigned int i = 0; i < package->size; i++) {
-        ((pyclustering_package **) package->data)[i] = create_package(&dynamic[i].m_output);
+    double * output = (double *) package->data;
+    for (std::size_t i = 0; i < dynamic.size(); i++) {
+        output = std::copy(dynamic[i].m_output.begin(), dynamic[i].m_output.end(), output);
     }
 
     return package;
@@ -20,6 +20,8 @@
 
 #include "interface/pyclustering_package.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <type_traits>
 
 
@@ -32,7 +34,9 @@ pyclustering_package::pyclustering_package(const pyclustering_data_t package_typ
 
 pyclustering_package::~pyclustering_package(void) {
     if (type != (unsigned int) pyclustering_data_t::PYCLUSTERING_TYPE_LIST) {
-        switch(type) {
+        const unsigned int data_type = (type == (unsigned int) pyclustering_data_t::PYCLUSTERING_TYPE_MATRIX) ? element_type : type;
+
+        switch(data_type) {
             case pyclustering_data_t::PYCLUSTERING_TYPE_INT:
                 delete [] (int *) data;
                 break;
@@ -82,3 +86,86 @@ pyclustering_package * create_package_container(const std::size_t p_size) {
 
     return package;
 }
+
+
+void pyclustering_package::extract(ccore::container::dense_dataset & container) const {
+    if (type == PYCLUSTERING_TYPE_MATRIX) {
+        if (element_type == PYCLUSTERING_TYPE_DOUBLE) {
+            container = ccore::container::dense_dataset((double *) data, size, columns, stride);
+            return;
+        }
+
+        container = ccore::container::dense_dataset(size, columns);
+        for (std::size_t i = 0; i < size; i++) {
+            for (std::size_t j = 0; j < columns; j++) {
+                container.at(i, j) = get_value<double>(data, element_type, i * stride + j);
+            }
+        }
+
+        return;
+    }
+
+    if (type != PYCLUSTERING_TYPE_LIST) {
+        throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: argument is not 'PYCLUSTERING_TYPE_LIST' or 'PYCLUSTERING_TYPE_MATRIX').");
+    }
+
+    const std::size_t dimension = (size == 0) ? 0 : at<pyclustering_package *>(0)->size;
+
+    container = ccore::container::dense_dataset(size, dimension);
+    for (std::size_t i = 0; i < size; i++) {
+        const pyclustering_package * row = at<pyclustering_package *>(i);
+        if (row->size != dimension) {
+            throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: row '" + std::to_string(i) + 
+                "' has size '" + std::to_string(row->size) + "' that is different from '" + std::to_string(dimension) + "'.");
+        }
+
+        for (std::size_t j = 0; j < dimension; j++) {
+            container.at(i, j) = get_value<double>(row->data, row->type, j);
+        }
+    }
+}
+
+
+void pyclustering_package::extract(ccore::container::pairwise_distance_matrix<double> & container) const {
+    using namespace ccore::container;
+
+    if ( (type == PYCLUSTERING_TYPE_MATRIX) && (element_type == PYCLUSTERING_TYPE_DOUBLE) ) {
+        if (columns != size) {
+            throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: distance matrix with size '" + 
+                std::to_string(size) + "' has rows with size '" + std::to_string(columns) + "'.");
+        }
+
+        container = pairwise_distance_matrix<double>((const double *) data, size, stride);
+        return;
+    }
+
+    if ( (type == PYCLUSTERING_TYPE_MATRIX) || (type == PYCLUSTERING_TYPE_LIST) ) {
+        dense_dataset rows;
+        extract(rows);
+
+        if (rows.dimension() != rows.size()) {
+            throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: distance matrix with size '" + 
+                std::to_string(rows.size()) + "' has rows with size '" + std::to_string(rows.dimension()) + "'.");
+        }
+
+        container = pairwise_distance_matrix<double>(rows.size(), distance_matrix_layout::SQUARE);
+        for (std::size_t i = 0; i < rows.size(); i++) {
+            const point_view row = rows.row(i);
+            std::copy(row.begin(), row.end(), container.data() + i * rows.size());
+        }
+
+        return;
+    }
+
+    /* condensed matrix contains n * (n - 1) / 2 values */
+    const std::size_t amount_objects = (size == 0) ? 0 : (std::size_t) std::llround((1.0 + std::sqrt(1.0 + 8.0 * (double) size)) / 2.0);
+    if (pairwise_distance_matrix<double>::get_storage_size(amount_objects, distance_matrix_layout::CONDENSED) != size) {
+        throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: amount of values '" + 
+            std::to_string(size) + "' does not correspond to condensed distance matrix.");
+    }
+
+    container = pairwise_distance_matrix<double>(amount_objects, distance_matrix_layout::CONDENSED);
+    for (std::size_t i = 0; i < size; i++) {
+        container.data()[i] = get_value<double>(data, type, i);
+    }
+}
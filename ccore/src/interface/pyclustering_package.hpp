@@ -21,6 +21,7 @@
 #pragma once
 
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <sstream>
@@ -28,6 +29,9 @@
 #include <type_traits>
 #include <vector>
 
+#include "container/dense_dataset.hpp"
+#include "container/pairwise_distance_matrix.hpp"
+
 #include "definitions.hpp"
 
 
@@ -41,14 +45,27 @@ enum pyclustering_data_t {
     PYCLUSTERING_TYPE_LIST              = 6,
     PYCLUSTERING_TYPE_SIZE_T            = 7,
     PYCLUSTERING_TYPE_UNDEFINED         = 8,
+    PYCLUSTERING_TYPE_MATRIX            = 9,
 };
 
 
+/**
+ *
+ * @brief   Package that is used to transfer data through the C interface.
+ * @details Package with type 'PYCLUSTERING_TYPE_MATRIX' stores two-dimensional data in one contiguous
+ *           row-major buffer: 'size' is amount of rows, 'columns' is amount of elements in each row,
+ *           'stride' is distance in elements between beginnings of two consecutive rows and 'element_type'
+ *           is type of elements. These fields are not used by packages of other types.
+ *
+ */
 struct pyclustering_package {
 public:
-    std::size_t     size      = 0;
-    unsigned int    type      = (unsigned int) PYCLUSTERING_TYPE_UNDEFINED;
-    void            * data    = nullptr;
+    std::size_t     size            = 0;
+    unsigned int    type            = (unsigned int) PYCLUSTERING_TYPE_UNDEFINED;
+    void            * data          = nullptr;
+    std::size_t     columns         = 0;
+    std::size_t     stride          = 0;
+    unsigned int    element_type    = (unsigned int) PYCLUSTERING_TYPE_UNDEFINED;
 
 public:
     pyclustering_package(void) = default;
@@ -73,6 +90,14 @@ public:
             throw std::out_of_range("pyclustering_package::at() [" + std::to_string(__LINE__) + "]: index '" + std::to_string(index_row) + "' out of range (size: '" + std::to_string(size) + "').");
         }
 
+        if (type == PYCLUSTERING_TYPE_MATRIX) {
+            if (columns <= index_column) {
+                throw std::out_of_range("pyclustering_package::at() [" + std::to_string(__LINE__) + "]: index '" + std::to_string(index_column) + "' out of range (columns: '" + std::to_string(columns) + "').");
+            }
+
+            return ((TypeValue *) data)[index_row * stride + index_column];
+        }
+
         pyclustering_package * package = at<pyclustering_package *>(index_row);
         return ((TypeValue *) package->data)[index_column];
     }
@@ -86,6 +111,19 @@ public:
 
     template <class TypeValue>
     void extract(std::vector<std::vector<TypeValue>> & container) const {
+        if (type == PYCLUSTERING_TYPE_MATRIX) {
+            for (std::size_t i = 0; i < size; i++) {
+                std::vector<TypeValue> subcontainer(columns);
+                for (std::size_t j = 0; j < columns; j++) {
+                    subcontainer[j] = get_value<TypeValue>(data, element_type, i * stride + j);
+                }
+
+                container.push_back(std::move(subcontainer));
+            }
+
+            return;
+        }
+
         if (type != PYCLUSTERING_TYPE_LIST) {
             throw std::invalid_argument("pyclustering_package::extract() [" + std::to_string(__LINE__) + "]: argument is not 'PYCLUSTERING_TYPE_LIST').");
         }
@@ -97,6 +135,31 @@ public:
         }
     }
 
+    /**
+    *
+    * @brief   Extracts two-dimensional data from the package to dense dataset.
+    * @details If the package is a matrix of doubles then the dataset becomes a view to the package buffer
+    *           without copying, therefore the package should live while the dataset is used. In other
+    *           cases coordinates are copied to one contiguous buffer that is owned by the dataset.
+    *
+    * @param[out] container: dataset where data from the package is placed.
+    *
+    */
+    void extract(ccore::container::dense_dataset & container) const;
+
+    /**
+    *
+    * @brief   Extracts pairwise distances from the package to distance matrix.
+    * @details If the package is a square matrix of doubles then the distance matrix becomes a view to the package
+    *           buffer without copying, therefore the package should live while the matrix is used. Rows of other
+    *           packages are copied to square matrix. Package of values (not rows) is considered as condensed
+    *           upper triangle without diagonal and it is copied to condensed matrix.
+    *
+    * @param[out] container: distance matrix where distances from the package are placed.
+    *
+    */
+    void extract(ccore::container::pairwise_distance_matrix<double> & container) const;
+
 private:
     template <class TypeValue>
     void extract(std::vector<TypeValue> & container, const pyclustering_package * const package) const {
@@ -104,6 +167,32 @@ private:
             container.push_back(package->at<TypeValue>(i));
         }
     }
+
+    template <class TypeValue>
+    static TypeValue get_value(const void * const p_data, const unsigned int p_type, const std::size_t p_index) {
+        switch(p_type) {
+            case PYCLUSTERING_TYPE_INT:
+                return (TypeValue) ((const int *) p_data)[p_index];
+
+            case PYCLUSTERING_TYPE_UNSIGNED_INT:
+                return (TypeValue) ((const unsigned int *) p_data)[p_index];
+
+            case PYCLUSTERING_TYPE_FLOAT:
+                return (TypeValue) ((const float *) p_data)[p_index];
+
+            case PYCLUSTERING_TYPE_DOUBLE:
+                return (TypeValue) ((const double *) p_data)[p_index];
+
+            case PYCLUSTERING_TYPE_LONG:
+                return (TypeValue) ((const long *) p_data)[p_index];
+
+            case PYCLUSTERING_TYPE_SIZE_T:
+                return (TypeValue) ((const std::size_t *) p_data)[p_index];
+
+            default:
+                throw std::invalid_argument("pyclustering_package::get_value() [" + std::to_string(__LINE__) + "]: unsupported element type '" + std::to_string(p_type) + "'.");
+        }
+    }
 };
 
 
@@ -152,6 +241,31 @@ pyclustering_package * create_package(const std::size_t p_size) {
 }
 
 
+/**
+ *
+ * @brief   Creates matrix package where all rows are stored in one contiguous allocation.
+ *
+ * @param[in] p_rows: amount of rows in the matrix.
+ * @param[in] p_columns: amount of elements in each row.
+ *
+ * @return  Matrix package or 'nullptr' if type of elements is not supported by packages.
+ *
+ */
+template <class TypeValue>
+pyclustering_package * create_matrix_package(const std::size_t p_rows, const std::size_t p_columns) {
+    pyclustering_package * package = create_package<TypeValue>(p_rows * p_columns);
+    if (package) {
+        package->type = (unsigned int) pyclustering_data_t::PYCLUSTERING_TYPE_MATRIX;
+        package->element_type = (unsigned int) get_package_type<TypeValue>();
+        package->size = p_rows;
+        package->columns = p_columns;
+        package->stride = p_columns;
+    }
+
+    return package;
+}
+
+
 template <class TypeContainer>
 pyclustering_package * create_package(const TypeContainer * const data) {
     using contaner_data_t = typename TypeContainer::value_type;
@@ -183,6 +297,41 @@ pyclustering_package * create_package(const std::vector< std::vector<TypeObject>
 }
 
 
+/**
+ *
+ * @brief   Creates matrix package from two-dimensional data where all rows have the same length.
+ * @details Rows are copied to one contiguous allocation instead of package per row. The function
+ *           is intended for numeric data like centers or output dynamics, clusters should be packed
+ *           by 'create_package' because their sizes are not related to each other.
+ *
+ * @param[in] data: two-dimensional data that should be packed.
+ *
+ * @return  Matrix package, or list package if rows have different length or data is empty.
+ *
+ */
+template <class TypeObject>
+pyclustering_package * create_matrix_package(const std::vector< std::vector<TypeObject> > * const data) {
+    const std::size_t columns = data->empty() ? 0 : data->front().size();
+    const bool rectangular = (columns > 0) && std::all_of(data->begin(), data->end(), [columns](const std::vector<TypeObject> & row) {
+        return row.size() == columns;
+    });
+
+    if (!rectangular) {
+        return create_package(data);
+    }
+
+    pyclustering_package * package = create_matrix_package<TypeObject>(data->size(), columns);
+    if (package) {
+        TypeObject * buffer = (TypeObject *) package->data;
+        for (const auto & row : *data) {
+            buffer = std::copy(row.begin(), row.end(), buffer);
+        }
+    }
+
+    return package;
+}
+
+
 template <class TypeObject>
 pyclustering_package * create_package(const std::vector< std::vector<TypeObject> * > * const data) {
    pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
@@ -82,7 +82,7 @@ size_t som_get_size(const void * pointer) {
 
 pyclustering_package * som_get_weights(const void * pointer) {
     const dataset & weights = ((som *) pointer)->get_weights();
-    pyclustering_package * package = create_package(&weights);
+    pyclustering_package * package = create_matrix_package(&weights);
 
     return package;
 }
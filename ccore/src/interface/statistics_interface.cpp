@@ -0,0 +1,62 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "interface/statistics_interface.h"
+
+#include "utils/statistics.hpp"
+
+#include <vector>
+
+
+using namespace ccore::utils::statistics;
+
+
+void statistics_enable(const bool p_enabled) {
+    performance_statistics::set_enabled_by_default(p_enabled);
+}
+
+
+bool statistics_is_enabled(void) {
+    return performance_statistics::is_enabled_by_default();
+}
+
+
+pyclustering_package * statistics_get_last(void) {
+    const performance_statistics & statistics = performance_statistics::get_last();
+
+    std::vector<std::size_t> counters(performance_statistics::AMOUNT_COUNTERS);
+    for (std::size_t index = 0; index < counters.size(); index++) {
+        counters[index] = static_cast<std::size_t>(statistics.get_counter(static_cast<counter_t>(index)));
+    }
+
+    std::vector<double> phases(performance_statistics::AMOUNT_PHASES);
+    for (std::size_t index = 0; index < phases.size(); index++) {
+        phases[index] = statistics.get_phase_time(static_cast<phase_t>(index));
+    }
+
+    std::vector<std::size_t> memory = { statistics.get_peak_memory(), statistics.get_current_memory() };
+
+    pyclustering_package * package = create_package_container(STATISTICS_PACKAGE_SIZE);
+    ((pyclustering_package **) package->data)[STATISTICS_PACKAGE_INDEX_COUNTERS] = create_package(&counters);
+    ((pyclustering_package **) package->data)[STATISTICS_PACKAGE_INDEX_PHASES] = create_package(&phases);
+    ((pyclustering_package **) package->data)[STATISTICS_PACKAGE_INDEX_MEMORY] = create_package(&memory);
+
+    return package;
+}
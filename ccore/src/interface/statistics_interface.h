@@ -0,0 +1,70 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include "interface/pyclustering_package.hpp"
+
+#include "definitions.hpp"
+
+
+/**
+ *
+ * @brief   Statistics is returned by pyclustering_package that consist sub-packages and this enumerator provides
+ *           named indexes for sub-packages.
+ * @details Sub-package of counters contains values in order of 'ccore::utils::statistics::counter_t', sub-package of
+ *           phases contains execution time in seconds in order of 'ccore::utils::statistics::phase_t', sub-package of
+ *           memory contains peak and current amount of bytes of tracked containers.
+ *
+ */
+enum statistics_package_indexer {
+    STATISTICS_PACKAGE_INDEX_COUNTERS = 0,
+    STATISTICS_PACKAGE_INDEX_PHASES,
+    STATISTICS_PACKAGE_INDEX_MEMORY,
+    STATISTICS_PACKAGE_SIZE
+};
+
+
+/**
+ *
+ * @brief   Enables or disables collection of performance statistics by all following calls of algorithms.
+ *
+ * @param[in] p_enabled: if 'true' then algorithms collect counters and execution time of their phases.
+ *
+ */
+extern "C" DECLARATION void statistics_enable(const bool p_enabled);
+
+
+/**
+ *
+ * @brief   Returns 'true' if algorithms collect performance statistics.
+ *
+ */
+extern "C" DECLARATION bool statistics_is_enabled(void);
+
+
+/**
+ *
+ * @brief   Returns performance statistics of the last call of an algorithm from the current thread.
+ * @details Caller should destroy returned result by 'free_pyclustering_package'.
+ *
+ */
+extern "C" DECLARATION pyclustering_package * statistics_get_last(void);
@@ -21,6 +21,8 @@
 
 #include "interface/sync_interface.h"
 
+#include <algorithm>
+
 #include "nnet/sync.hpp"
 
 
@@ -77,20 +79,13 @@ double sync_local_order(const void * pointer_network) {
 pyclustering_package * sync_connectivity_matrix(const void * pointer_network) {
     std::shared_ptr<adjacency_collection> connections = ((sync_network *) pointer_network)->connections();
 
-    pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
-    package->size = ((sync_network *) pointer_network)->size();
-    package->data = new pyclustering_package * [package->size];
-
-    for (std::size_t i = 0; i < package->size; i++) {
-        pyclustering_package * subpackage = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_DOUBLE);
-        subpackage->size = ((sync_network *) pointer_network)->size();
-        subpackage->data = (void *) new double[subpackage->size];
+    const std::size_t size_network = ((sync_network *) pointer_network)->size();
+    pyclustering_package * package = create_matrix_package<double>(size_network, size_network);
 
-        for (std::size_t j = 0; j < subpackage->size; j++) {
-            ((double *) subpackage->data)[j] = connections->has_connection(i, j);
+    for (std::size_t i = 0; i < size_network; i++) {
+        for (std::size_t j = 0; j < size_network; j++) {
+            ((double *) package->data)[i * size_network + j] = connections->has_connection(i, j);
         }
-
-        ((pyclustering_package **) package->data)[i] = subpackage;
     }
 
     return package;
@@ -121,7 +116,7 @@ pyclustering_package * sync_dynamic_allocate_correlation_matrix(const void * poi
     sync_corr_matrix matrix;
     ((sync_dynamic *) pointer_dynamic)->allocate_correlation_matrix(iteration, matrix);
 
-    pyclustering_package * package = create_package(&matrix);
+    pyclustering_package * package = create_matrix_package(&matrix);
     return package;
 }
 
@@ -144,12 +139,12 @@ pyclustering_package * sync_dynamic_get_time(const void * pointer) {
 pyclustering_package * sync_dynamic_get_output(const void * pointer) {
     sync_dynamic & dynamic = *((sync_dynamic *) pointer);
 
-    pyclustering_package * package = new pyclustering_package(pyclustering_data_t::PYCLUSTERING_TYPE_LIST);
-    package->size = dynamic.size();
-    package->data = new pyclustering_package * [package->size];
+    const std::size_t amount_oscillators = dynamic.size() > 0 ? dynamic[0].m_phase.size() : 0;
+    pyclustering_package * package = create_matrix_package<double>(dynamic.size(), amount_oscillators);
 
-    for (unsigned int i = 0; i < package->size; i++) {
-        ((pyclustering_package **) package->data)[i] = create_package(&dynamic[i].m_phase);
+    double * output = (double *) package->data;
+    for (std::size_t i = 0; i < dynamic.size(); i++) {
+        output = std::copy(dynamic[i].m_phase.begin(), dynamic[i].m_phase.end(), output);
     }
 
     return package;
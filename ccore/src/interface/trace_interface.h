@@ -0,0 +1,45 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include "definitions.hpp"
+
+
+/**
+ *
+ * @brief   Starts recording of trace events (algorithm phases, parallel chunks, pool tasks and ODE integration).
+ * @details Tracing can be also enabled by environment variable 'CCORE_TRACE_FILE' before the library is loaded.
+ *
+ * @param[in] p_path: path to the file where events are written in Chrome trace-event format by 'trace_stop'.
+ *
+ */
+extern "C" DECLARATION void trace_start(const char * p_path);
+
+
+/**
+ *
+ * @brief   Stops recording of trace events and writes them to the file that has been specified by 'trace_start'.
+ *
+ * @return  Returns 'false' if tracing has not been started or the file cannot be written.
+ *
+ */
+extern "C" DECLARATION bool trace_stop(void);
@@ -43,7 +43,7 @@ pyclustering_package * ttsas_algorithm(const pyclustering_package * const p_samp
 
     ccore::clst::ttsas algorithm(p_threshold1, p_threshold2, *metric);
 
-    dataset input_dataset;
+    ccore::container::dense_dataset input_dataset;
     p_sample->extract(input_dataset);
 
     ccore::clst::ttsas_data output_result;
@@ -54,7 +54,7 @@ pyclustering_package * ttsas_algorithm(const pyclustering_package * const p_samp
     package->data = new pyclustering_package * [BSAS_PACKAGE_SIZE];
 
     ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_CLUSTERS] = create_package(&output_result.clusters());
-    ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_REPRESENTATIVES] = create_package(&output_result.representatives());
+    ((pyclustering_package **) package->data)[BSAS_PACKAGE_INDEX_REPRESENTATIVES] = create_matrix_package(&output_result.representatives());
 
     return package;
 }
\ No newline at end of file
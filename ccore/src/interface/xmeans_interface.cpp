@@ -24,7 +24,9 @@
 
 
 pyclustering_package * xmeans_algorithm(const pyclustering_package * const p_sample, const pyclustering_package * const p_centers, const std::size_t p_kmax, const double p_tolerance, const unsigned int p_criterion) {
-    dataset data, centers;
+    ccore::container::dense_dataset data;
+    dataset centers;
+
     p_sample->extract(data);
     p_centers->extract(centers);
 
@@ -38,7 +40,7 @@ pyclustering_package * xmeans_algorithm(const pyclustering_package * const p_sam
     package->data = new pyclustering_package * [2];
 
     ((pyclustering_package **) package->data)[0] = create_package(&output_result.clusters());
-    ((pyclustering_package **) package->data)[1] = create_package(&output_result.centers());
+    ((pyclustering_package **) package->data)[1] = create_matrix_package(&output_result.centers());
 
     return package;
 }
@@ -29,11 +29,14 @@
 
 #include "utils/math.hpp"
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
+#include "utils/trace.hpp"
 
 
 using namespace std::placeholders;
 
 using namespace ccore::utils::math;
+using namespace ccore::utils::statistics;
 
 
 namespace ccore {
@@ -71,6 +74,8 @@ void legion_network::simulate(const unsigned int steps,
 
     output_dynamic.clear();
 
+    statistics_collector collector(output_dynamic.statistics(), output_dynamic.is_statistics_enabled());
+
     m_stimulus = (legion_stimulus *) &stimulus;
     create_dynamic_connections(stimulus);
 
@@ -81,6 +86,7 @@ void legion_network::simulate(const unsigned int steps,
 
     for (double cur_time = step; cur_time < time; cur_time += step) {
         calculate_states(stimulus, solver, cur_time, step, int_step);
+        statistics_collector::increment(counter_t::SIMULATION_STEPS);
 
         store_dynamic(cur_time, collect_dynamic, output_dynamic);	/* store initial state */
     }
@@ -133,6 +139,8 @@ void legion_network::store_dynamic(const double time, const bool collect_dynamic
 }
 
 void legion_network::calculate_states(const legion_stimulus & stimulus, const solve_type solver, const double t, const double step, const double int_step) {
+    utils::trace::trace_scope trace("legion step", "simulation");
+
     std::vector< differ_result<double> > next_states(size());
     std::vector<void *> argv(1, nullptr);
 
@@ -304,6 +312,7 @@ void legion_network::inhibitor_state(const double t, const differ_state<double>
 void legion_network::initialize(const size_t num_osc, const connection_t connection_type, const size_t height, const size_t width, const legion_parameters & params) {
     m_oscillators = std::vector<legion_oscillator>(num_osc, legion_oscillator());
     m_dynamic_connections = std::vector<std::vector<double> >(num_osc, std::vector<double>(num_osc, 0.0)),
+    m_dynamic_connections_memory.reset(num_osc * (sizeof(std::vector<double>) + num_osc * sizeof(double)));
     m_stimulus = nullptr;
     m_generator = std::default_random_engine(m_device());
     m_generator.seed(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()));
@@ -35,6 +35,8 @@
 
 #include "nnet/network.hpp"
 
+#include "utils/memory.hpp"
+
 
 using namespace ccore::container;
 using namespace ccore::differential;
@@ -139,6 +141,8 @@ private:
 
     std::vector<std::vector<double> > m_dynamic_connections;
 
+    utils::memory::memory_reservation m_dynamic_connections_memory;
+
     legion_stimulus * m_stimulus;   /* just keep it during simulation for convinience (pointer to external object, legion is not owner) */
 
     std::random_device                      m_device;
@@ -27,6 +27,11 @@
 #include "container/adjacency_connector.hpp"
 #include "container/adjacency_matrix.hpp"
 
+#include "utils/statistics.hpp"
+
+
+using namespace ccore::utils::statistics;
+
 
 namespace ccore {
 
@@ -55,7 +60,11 @@ pcnn::~pcnn() { }
 void pcnn::simulate(const std::size_t steps, const pcnn_stimulus & stimulus, pcnn_dynamic & output_dynamic) {
     output_dynamic.resize(steps, size());
 
+    statistics_collector collector(output_dynamic.statistics(), output_dynamic.is_statistics_enabled());
+    phase_timer timer(phase_t::SIMULATION);
+
     for (std::size_t i = 0; i < steps; i++) {
+        statistics_collector::increment(counter_t::SIMULATION_STEPS);
         calculate_states(stimulus);
         store_dynamic(i, output_dynamic);
     }
@@ -57,6 +57,7 @@ som::som(const size_t num_rows, const size_t num_cols, const som_conn_type type_
     m_awards(m_size, 0),
     m_location(m_size),
     m_sqrt_distances(m_size, std::vector<double>(m_size, 0)),
+    m_sqrt_distances_memory(m_size * (sizeof(std::vector<double>) + m_size * sizeof(double))),
     m_capture_objects(m_size),
     m_params(parameters) 
 {
@@ -554,6 +555,7 @@ som & som::operator=(const som & p_other) {
 
     m_location = p_other.m_location;
     m_sqrt_distances = p_other.m_sqrt_distances;
+    m_sqrt_distances_memory = p_other.m_sqrt_distances_memory;
     m_capture_objects = p_other.m_capture_objects;
     m_neighbors = p_other.m_neighbors;
 
@@ -26,6 +26,8 @@
 
 #include "definitions.hpp"
 
+#include "utils/memory.hpp"
+
 
 namespace ccore {
 
@@ -128,6 +130,7 @@ private:
     /* just for convenience (avoid excess calculation during learning) */
     dataset                 m_location;
     dataset                 m_sqrt_distances;
+    utils::memory::memory_reservation   m_sqrt_distances_memory;
     som_gain_sequence       m_capture_objects;
     som_neighbor_sequence   m_neighbors;
 
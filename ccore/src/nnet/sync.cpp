@@ -34,14 +34,17 @@
 #include "differential/runge_kutta_fehlberg_45.hpp"
 
 #include "parallel/parallel.hpp"
+#include "parallel/parallel_algorithm.hpp"
 
 #include "utils/math.hpp"
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
 
 
 using namespace ccore::container;
 using namespace ccore::differential;
 using namespace ccore::parallel;
+using namespace ccore::utils::statistics;
 using namespace ccore::utils::math;
 using namespace ccore::utils::metric;
 
@@ -56,6 +59,12 @@ namespace nnet {
 
 const std::size_t sync_network::MAXIMUM_MATRIX_REPRESENTATION_SIZE      = 4096;
 
+const std::size_t sync_network::PHASE_CALCULATION_GRAIN                 = 16;
+
+const std::size_t sync_ordering::ORDER_REDUCTION_GRAIN                  = 1024;
+
+const std::size_t sync_ordering::LOCAL_ORDER_REDUCTION_GRAIN            = 64;
+
 
 
 double sync_ordering::calculate_sync_order(const std::vector<double> & p_phases) {
@@ -72,15 +81,19 @@ double sync_ordering::calculate_sync_order(const std::vector<sync_oscillator> &
 
 template <class TypeContainer>
 double sync_ordering::calculate_sync_order_parameter(const TypeContainer & p_container, const phase_getter & p_getter) {
-    double exp_amount = 0.0;
-    double average_phase = 0.0;
+    const auto accumulate = [](const order_accumulator & p_value1, const order_accumulator & p_value2) {
+        return order_accumulator(p_value1.first + p_value2.first, p_value1.second + p_value2.second);
+    };
 
-    for (std::size_t index = 0; index < p_container.size(); index++) {
-        const double phase = p_getter(index);
+    /* first - sum of exponents, second - sum of phases */
+    const order_accumulator amounts = parallel_transform_reduce(std::size_t(0), p_container.size(), order_accumulator(0.0, 0.0), accumulate,
+        [&p_getter](const std::size_t p_index) {
+            const double phase = p_getter(p_index);
+            return order_accumulator(std::exp( std::abs( std::complex<double>(0, 1) * phase ) ), phase);
+        }, ORDER_REDUCTION_GRAIN);
 
-        exp_amount += std::exp( std::abs( std::complex<double>(0, 1) * phase ) );
-        average_phase += phase;
-    }
+    double exp_amount = amounts.first;
+    double average_phase = amounts.second;
 
     exp_amount /= p_container.size();
     average_phase = std::exp( std::abs( std::complex<double>(0, 1) * (average_phase / p_container.size()) ) );
@@ -103,22 +116,29 @@ double sync_ordering::calculate_local_sync_order(const std::shared_ptr<adjacency
 
 template <class TypeContainer>
 double sync_ordering::calculate_local_sync_order_parameter(const std::shared_ptr<adjacency_collection> p_connections, const TypeContainer & p_container, const phase_getter & p_getter) {
-    double exp_amount = 0.0;
-    double number_neighbors = 0.0;
-
-    for (std::size_t i = 0; i < p_container.size(); i++) {
-        double phase = p_getter(i);
-
-        std::vector<std::size_t> neighbors;
-        p_connections->get_neighbors(i, neighbors);
+    const auto accumulate = [](const order_accumulator & p_value1, const order_accumulator & p_value2) {
+        return order_accumulator(p_value1.first + p_value2.first, p_value1.second + p_value2.second);
+    };
+
+    /* first - sum of exponents, second - amount of neighbors */
+    const order_accumulator amounts = parallel_transform_reduce(std::size_t(0), p_container.size(), order_accumulator(0.0, 0.0), accumulate,
+        [&p_connections, &p_getter](const std::size_t p_index) {
+            const double phase = p_getter(p_index);
+
+            std::vector<std::size_t> neighbors;
+            p_connections->get_neighbors(p_index, neighbors);
+
+            double exp_amount = 0.0;
+            for (auto & index_neighbor : neighbors) {
+                double phase_neighbor = p_getter(index_neighbor);
+                exp_amount += std::exp( -std::abs( phase_neighbor - phase ) );
+            }
 
-        for (auto & index_neighbor : neighbors) {
-            double phase_neighbor = p_getter(index_neighbor);
-            exp_amount += std::exp( -std::abs( phase_neighbor - phase ) );
-        }
+            return order_accumulator(exp_amount, (double) neighbors.size());
+        }, LOCAL_ORDER_REDUCTION_GRAIN);
 
-        number_neighbors += neighbors.size();
-    }
+    double exp_amount = amounts.first;
+    double number_neighbors = amounts.second;
 
     if (number_neighbors == 0.0) {
         number_neighbors = 1.0;
@@ -232,6 +252,8 @@ double sync_network::phase_kuramoto(const double t, const double teta, const std
 void sync_network::simulate_static(const std::size_t steps, const double time, const solve_type solver, const bool collect_dynamic, sync_dynamic & output_dynamic) {
     output_dynamic.clear();
 
+    statistics_collector collector(output_dynamic.statistics(), output_dynamic.is_statistics_enabled());
+
     const double step = time / (double) steps;
     const double int_step = step / 10.0;
 
@@ -251,6 +273,8 @@ void sync_network::simulate_static(const std::size_t steps, const double time, c
 void sync_network::simulate_dynamic(const double order, const double step, const solve_type solver, const bool collect_dynamic, sync_dynamic & output_dynamic) {
     output_dynamic.clear();
 
+    statistics_collector collector(output_dynamic.statistics(), output_dynamic.is_statistics_enabled());
+
     store_dynamic(0, collect_dynamic, output_dynamic);     /* store initial state */
 
     double current_order = sync_local_order();
@@ -292,11 +316,14 @@ void sync_network::store_dynamic(const double time, const bool collect_dynamic,
 
 
 void sync_network::calculate_phases(const solve_type solver, const double t, const double step, const double int_step) {
+    phase_timer timer(phase_t::SIMULATION);
+    statistics_collector::increment(counter_t::SIMULATION_STEPS);
+
     std::vector<double> next_phases(size(), 0.0);
 
     parallel_for(std::size_t(0), size(), [this, solver, t, step, int_step, &next_phases](const std::size_t p_index) {
         calculate_phase(solver, t, step, int_step, p_index, next_phases);
-    });
+    }, schedule(schedule_policy::GUIDED, PHASE_CALCULATION_GRAIN));
 
     /* store result */
     for (std::size_t index = 0; index < size(); index++) {
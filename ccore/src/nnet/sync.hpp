@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <memory>
+#include <utility>
 
 #include "container/adjacency.hpp"
 #include "container/adjacency_connector.hpp"
@@ -107,6 +108,15 @@ class sync_ordering {
 private:
     using phase_getter = std::function<double(std::size_t)>;
 
+    /* pair of accumulated values that is reduced during calculation of order parameter */
+    using order_accumulator = std::pair<double, double>;
+
+    /* amount of oscillators that are processed by one task during calculation of order parameter */
+    const static std::size_t ORDER_REDUCTION_GRAIN;
+
+    /* local order visits neighbors of each oscillator, therefore its tasks contain less oscillators */
+    const static std::size_t LOCAL_ORDER_REDUCTION_GRAIN;
+
 public:
     /**
      *
@@ -297,6 +307,9 @@ class sync_network {
 private:
     const static std::size_t MAXIMUM_MATRIX_REPRESENTATION_SIZE;
 
+    /* minimum amount of oscillators that are processed by one task, cost of oscillator depends on its degree */
+    const static std::size_t PHASE_CALCULATION_GRAIN;
+
 private:
     using iterator = std::vector<sync_oscillator>::iterator;
 
@@ -0,0 +1,93 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "cancellation_token.hpp"
+
+#include <cmath>
+#include <string>
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+operation_cancelled::operation_cancelled(void) :
+    std::runtime_error("Operation has been cancelled.")
+{ }
+
+
+cancellation_token::cancellation_token(void) :
+    m_state(std::make_shared<state>())
+{ }
+
+
+void cancellation_token::cancel(void) {
+    m_state->m_cancelled.store(true, std::memory_order_release);
+}
+
+
+void cancellation_token::set_deadline(const clock::time_point & p_deadline) {
+    m_state->m_deadline.store(p_deadline.time_since_epoch().count(), std::memory_order_release);
+}
+
+
+void cancellation_token::set_timeout(const double p_seconds) {
+    if (std::isnan(p_seconds) || (p_seconds < 0.0)) {
+        throw std::invalid_argument("Timeout of cancellation token should be non-negative, '" + std::to_string(p_seconds) + "' is specified.");
+    }
+
+    const clock::time_point now = clock::now();
+    const clock::rep remaining = (clock::time_point::max() - now).count();
+
+    /* timeout that does not fit into the clock means that there is no deadline */
+    const double ticks = p_seconds * clock::period::den / clock::period::num;
+    if (ticks >= (double) remaining) {
+        set_deadline(clock::time_point::max());
+        return;
+    }
+
+    set_deadline(now + clock::duration((clock::rep) ticks));
+}
+
+
+bool cancellation_token::is_cancelled(void) const {
+    if (m_state->m_cancelled.load(std::memory_order_acquire)) {
+        return true;
+    }
+
+    const clock::rep deadline = m_state->m_deadline.load(std::memory_order_acquire);
+    if (deadline == clock::time_point::max().time_since_epoch().count()) {
+        return false;
+    }
+
+    if (clock::now().time_since_epoch().count() >= deadline) {
+        m_state->m_cancelled.store(true, std::memory_order_release);
+        return true;
+    }
+
+    return false;
+}
+
+
+}
+
+}
@@ -0,0 +1,125 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+/**
+ *
+ * @brief   Exception that is thrown by parallel loop when cancellation of the current call is requested.
+ *
+ */
+class operation_cancelled : public std::runtime_error {
+public:
+    operation_cancelled(void);
+};
+
+
+/**
+ *
+ * @brief   Token that is used to request cooperative cancellation of long-running calls.
+ * @details Copies of the token share the same state, therefore the token can be cancelled from another thread
+ *           using its copy. The token is attached to execution context of a call: algorithms check it at iteration
+ *           boundaries and return partial results, parallel loops inside of 'cancellation_scope' check it before each
+ *           chunk and throw 'operation_cancelled'.
+ *
+ */
+class cancellation_token {
+public:
+    using clock = std::chrono::steady_clock;
+
+private:
+    struct state {
+        std::atomic<bool>                   m_cancelled     = { false };
+        std::atomic<clock::rep>             m_deadline      = { clock::time_point::max().time_since_epoch().count() };
+    };
+
+private:
+    std::shared_ptr<state>  m_state;
+
+public:
+    /**
+     *
+     * @brief   Creates token that is not cancelled and does not have deadline.
+     *
+     */
+    cancellation_token(void);
+
+    cancellation_token(const cancellation_token & p_other) = default;
+
+    cancellation_token(cancellation_token && p_other) = default;
+
+    ~cancellation_token(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Requests cancellation of calls that use the token.
+     *
+     */
+    void cancel(void);
+
+    /**
+     *
+     * @brief   Sets time point after that the token is considered as cancelled.
+     *
+     */
+    void set_deadline(const clock::time_point & p_deadline);
+
+    /**
+     *
+     * @brief   Sets deadline that is specified number of seconds later than the current time.
+     * @details Timeout that exceeds range of the clock (including infinity) removes deadline.
+     *
+     * @param[in] p_seconds: timeout in seconds.
+     *
+     * @throw   std::invalid_argument if the timeout is negative or NaN.
+     *
+     */
+    void set_timeout(const double p_seconds);
+
+    /**
+     *
+     * @brief   Returns 'true' if cancellation is requested or deadline is expired.
+     *
+     */
+    bool is_cancelled(void) const;
+
+    cancellation_token & operator=(const cancellation_token & p_other) = default;
+
+    cancellation_token & operator=(cancellation_token && p_other) = default;
+};
+
+
+}
+
+}
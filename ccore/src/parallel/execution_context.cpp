@@ -0,0 +1,199 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "execution_context.hpp"
+
+#include "work_stealing_pool.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+namespace {
+
+
+std::mutex                  DEFAULT_CONTEXT_MUTEX;
+execution_context           DEFAULT_CONTEXT;
+std::atomic<std::size_t>    DEFAULT_THREAD_COUNT(execution_context::get_hardware_thread_count());
+
+thread_local const execution_context * ACTIVE_CONTEXT = nullptr;
+
+thread_local bool CANCELLATION_ENABLED = false;
+
+
+}
+
+
+execution_context::execution_context(const std::size_t p_thread_count, const bool p_serial) :
+    m_thread_count(p_thread_count), m_serial(p_serial)
+{ }
+
+
+std::size_t execution_context::get_thread_count(void) const {
+    if (m_serial) {
+        return 1;
+    }
+
+    return (m_thread_count > 0) ? m_thread_count : get_hardware_thread_count();
+}
+
+
+void execution_context::set_thread_count(const std::size_t p_thread_count) {
+    m_thread_count = p_thread_count;
+}
+
+
+bool execution_context::is_serial(void) const {
+    return m_serial;
+}
+
+
+void execution_context::set_serial(const bool p_serial) {
+    m_serial = p_serial;
+}
+
+
+const std::vector<std::size_t> & execution_context::get_affinity(void) const {
+    return m_affinity;
+}
+
+
+void execution_context::set_affinity(const std::vector<std::size_t> & p_cpus) {
+    m_affinity = p_cpus;
+}
+
+
+const cancellation_token & execution_context::get_cancellation_token(void) const {
+    return m_token;
+}
+
+
+void execution_context::set_cancellation_token(const cancellation_token & p_token) {
+    m_token = p_token;
+}
+
+
+execution_context execution_context::get_default(void) {
+    std::lock_guard<std::mutex> guard(DEFAULT_CONTEXT_MUTEX);
+    return DEFAULT_CONTEXT;
+}
+
+
+void execution_context::set_default(const execution_context & p_context) {
+    for (const std::size_t cpu : p_context.get_affinity()) {
+        if (!work_stealing_pool::is_cpu_supported(cpu)) {
+            throw std::invalid_argument("CPU '" + std::to_string(cpu) + "' is not supported by the system.");
+        }
+    }
+
+    std::lock_guard<std::mutex> guard(DEFAULT_CONTEXT_MUTEX);
+
+    const std::size_t thread_count = p_context.get_thread_count();
+    const std::size_t pool_size = thread_count - 1;     /* caller is the one of threads */
+
+    const std::shared_ptr<work_stealing_pool> pool = work_stealing_pool::get_instance();
+    if ((pool->size() != pool_size) || (pool->get_affinity() != p_context.get_affinity())) {
+        work_stealing_pool::reset_instance(pool_size, p_context.get_affinity());
+    }
+
+    DEFAULT_CONTEXT = p_context;
+    DEFAULT_THREAD_COUNT.store(thread_count);
+}
+
+
+const execution_context * execution_context::get_active(void) {
+    return ACTIVE_CONTEXT;
+}
+
+
+std::size_t execution_context::get_current_thread_count(void) {
+    return ACTIVE_CONTEXT ? ACTIVE_CONTEXT->get_thread_count() : DEFAULT_THREAD_COUNT.load(std::memory_order_relaxed);
+}
+
+
+bool execution_context::is_cancellation_requested(void) {
+    /* the default context is shared by all calls, therefore only activated context can be cancelled */
+    return ACTIVE_CONTEXT && ACTIVE_CONTEXT->m_token.is_cancelled();
+}
+
+
+void execution_context::throw_if_cancelled(void) {
+    if (CANCELLATION_ENABLED && is_cancellation_requested()) {
+        throw operation_cancelled();
+    }
+}
+
+
+std::size_t execution_context::get_hardware_thread_count(void) {
+    const std::size_t amount_threads = std::thread::hardware_concurrency();
+    return (amount_threads > 0) ? amount_threads : 1;
+}
+
+
+const execution_context * execution_context::activate(const execution_context * p_context) {
+    const execution_context * previous = ACTIVE_CONTEXT;
+    ACTIVE_CONTEXT = p_context;
+    return previous;
+}
+
+
+execution_context_scope::execution_context_scope(const execution_context * p_context) :
+    m_previous(execution_context::activate(p_context))
+{ }
+
+
+execution_context_scope::execution_context_scope(const execution_context & p_context) :
+    execution_context_scope(&p_context)
+{ }
+
+
+execution_context_scope::~execution_context_scope(void) {
+    execution_context::activate(m_previous);
+}
+
+
+cancellation_scope::cancellation_scope(const bool p_enabled) :
+    m_previous(CANCELLATION_ENABLED)
+{
+    CANCELLATION_ENABLED = p_enabled;
+}
+
+
+cancellation_scope::~cancellation_scope(void) {
+    CANCELLATION_ENABLED = m_previous;
+}
+
+
+bool cancellation_scope::is_enabled(void) {
+    return CANCELLATION_ENABLED;
+}
+
+
+}
+
+}
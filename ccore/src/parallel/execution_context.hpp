@@ -0,0 +1,245 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+
+#include "cancellation_token.hpp"
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+/**
+ *
+ * @brief   Execution context defines how parallel loops of algorithms are executed: amount of threads, serial mode,
+ *           CPU affinity of worker threads and cancellation token of the call.
+ * @details The default context is shared by the whole process, it uses all hardware threads and it can be changed
+ *           by 'set_default'. Context of a call is activated for the current thread by 'execution_context_scope',
+ *           in this case it is used by all parallel loops inside the call including nested loops that are executed
+ *           by worker threads.
+ *
+ */
+class execution_context {
+private:
+    std::size_t                 m_thread_count  = 0;    /* 0 - amount of hardware threads */
+    bool                        m_serial        = false;
+    std::vector<std::size_t>    m_affinity      = { };
+    cancellation_token          m_token;
+
+public:
+    execution_context(void) = default;
+
+    /**
+     *
+     * @brief   Creates execution context.
+     *
+     * @param[in] p_thread_count: maximum amount of threads (including caller) that execute parallel loop, 0 means
+     *             amount of hardware threads.
+     * @param[in] p_serial: if 'true' then parallel loops are executed by the caller only.
+     *
+     */
+    explicit execution_context(const std::size_t p_thread_count, const bool p_serial = false);
+
+    execution_context(const execution_context & p_other) = default;
+
+    execution_context(execution_context && p_other) = default;
+
+    ~execution_context(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Returns amount of threads that are used by parallel loop: 1 in case of serial mode, amount of
+     *           hardware threads if the amount is not specified.
+     *
+     */
+    std::size_t get_thread_count(void) const;
+
+    void set_thread_count(const std::size_t p_thread_count);
+
+    bool is_serial(void) const;
+
+    void set_serial(const bool p_serial);
+
+    /**
+     *
+     * @brief   Returns CPUs that worker threads are bound to, empty if threads are not bound.
+     *
+     */
+    const std::vector<std::size_t> & get_affinity(void) const;
+
+    /**
+     *
+     * @brief   Sets CPUs that worker threads should be bound to (by 'sched_setaffinity' on Linux).
+     * @details Affinity is applied to worker threads by 'set_default' only, because worker threads are shared by
+     *           all calls.
+     *
+     */
+    void set_affinity(const std::vector<std::size_t> & p_cpus);
+
+    const cancellation_token & get_cancellation_token(void) const;
+
+    /**
+     *
+     * @brief   Sets token that is used to cancel calls that are executed in the context.
+     *
+     */
+    void set_cancellation_token(const cancellation_token & p_token);
+
+    execution_context & operator=(const execution_context & p_other) = default;
+
+    execution_context & operator=(execution_context && p_other) = default;
+
+public:
+    /**
+     *
+     * @brief   Returns copy of the default execution context of the process.
+     *
+     */
+    static execution_context get_default(void);
+
+    /**
+     *
+     * @brief   Changes the default execution context of the process, worker threads are recreated if amount of
+     *           threads or affinity is changed.
+     * @details The function should not be called while algorithms are running.
+     *
+     * @throw   std::invalid_argument if CPU from affinity list is not supported by the system.
+     *
+     */
+    static void set_default(const execution_context & p_context);
+
+    /**
+     *
+     * @brief   Returns context that is activated for the current thread, nullptr if the default context is used.
+     *
+     */
+    static const execution_context * get_active(void);
+
+    /**
+     *
+     * @brief   Returns amount of threads that should be used by parallel loop that is called by the current thread.
+     *
+     */
+    static std::size_t get_current_thread_count(void);
+
+    /**
+     *
+     * @brief   Returns 'true' if cancellation is requested for the call that is executed by the current thread.
+     *
+     */
+    static bool is_cancellation_requested(void);
+
+    /**
+     *
+     * @brief   Throws 'operation_cancelled' if cancellation is requested for the call that is executed by the current
+     *           thread and the thread is inside of 'cancellation_scope'.
+     *
+     */
+    static void throw_if_cancelled(void);
+
+    /**
+     *
+     * @brief   Returns amount of hardware threads.
+     *
+     */
+    static std::size_t get_hardware_thread_count(void);
+
+private:
+    friend class execution_context_scope;
+
+    static const execution_context * activate(const execution_context * p_context);
+};
+
+
+/**
+ *
+ * @brief   Activates execution context for the current thread until the scope is destroyed.
+ *
+ */
+class execution_context_scope {
+private:
+    const execution_context * m_previous = nullptr;
+
+public:
+    /**
+     *
+     * @brief   Activates execution context, the context should live until the scope is destroyed.
+     *
+     * @param[in] p_context: context that is activated, nullptr activates the default context.
+     *
+     */
+    explicit execution_context_scope(const execution_context * p_context);
+
+    explicit execution_context_scope(const execution_context & p_context);
+
+    execution_context_scope(const execution_context_scope & p_other) = delete;
+
+    execution_context_scope(execution_context_scope && p_other) = delete;
+
+    ~execution_context_scope(void);
+};
+
+
+/**
+ *
+ * @brief   Allows parallel loops of the current thread to be interrupted by 'operation_cancelled' until the scope is
+ *           destroyed.
+ * @details Scope is opened by algorithms that handle the exception and return partial results, therefore other
+ *           algorithms are never interrupted in the middle of iteration.
+ *
+ */
+class cancellation_scope {
+private:
+    bool m_previous = false;
+
+public:
+    /**
+     *
+     * @brief   Enables or disables interruption of parallel loops of the current thread.
+     *
+     */
+    explicit cancellation_scope(const bool p_enabled = true);
+
+    cancellation_scope(const cancellation_scope & p_other) = delete;
+
+    cancellation_scope(cancellation_scope && p_other) = delete;
+
+    ~cancellation_scope(void);
+
+public:
+    /**
+     *
+     * @brief   Returns 'true' if parallel loops of the current thread can be interrupted.
+     *
+     */
+    static bool is_enabled(void);
+};
+
+
+}
+
+}
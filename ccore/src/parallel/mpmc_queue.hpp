@@ -0,0 +1,175 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+/**
+ *
+ * @brief   Bounded lock-free queue for multiple producers and multiple consumers based on a ring buffer.
+ * @details Each cell of the ring has a sequence number that defines whether the cell is ready to be written by
+ *           a producer or read by a consumer of the current lap, therefore producers and consumers synchronize only
+ *           on the cell that they use and on the atomic positions of the ring.
+ *
+ */
+template <typename TypeValue>
+class mpmc_queue {
+private:
+    struct cell {
+        std::atomic<std::size_t>    m_sequence;
+        TypeValue                   m_value;
+    };
+
+    /* positions are placed to different cache lines to avoid false sharing between producers and consumers */
+    static const std::size_t CACHE_LINE_SIZE = 64;
+
+private:
+    std::unique_ptr<cell[]>     m_cells;
+    const std::size_t           m_mask;
+
+    char                        m_padding_producer[CACHE_LINE_SIZE];
+    std::atomic<std::size_t>    m_enqueue_position  = { 0 };
+
+    char                        m_padding_consumer[CACHE_LINE_SIZE];
+    std::atomic<std::size_t>    m_dequeue_position  = { 0 };
+
+public:
+    /**
+     *
+     * @brief   Creates queue with specified capacity.
+     *
+     * @param[in] p_capacity: maximum amount of elements in the queue, it should be power of two and greater than 1.
+     *
+     */
+    explicit mpmc_queue(const std::size_t p_capacity) :
+        m_cells(nullptr),
+        m_mask(p_capacity - 1)
+    {
+        if ((p_capacity < 2) || ((p_capacity & (p_capacity - 1)) != 0)) {
+            throw std::invalid_argument("Capacity of the queue should be power of two and greater than 1.");
+        }
+
+        m_cells.reset(new cell[p_capacity]);
+        for (std::size_t i = 0; i < p_capacity; i++) {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(const mpmc_queue & p_other) = delete;
+
+    mpmc_queue(mpmc_queue && p_other) = delete;
+
+    ~mpmc_queue(void) = default;
+
+public:
+    /**
+     *
+     * @brief   Places value to the end of the queue if the queue is not full.
+     *
+     * @param[in] p_value: value that should be placed, it is moved only if the value is placed.
+     *
+     * @return  'true' if the value is placed, 'false' if the queue is full.
+     *
+     */
+    bool try_push(TypeValue & p_value) {
+        std::size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+        while (true) {
+            cell & target = m_cells[position & m_mask];
+
+            const std::size_t sequence = target.m_sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = (std::ptrdiff_t) sequence - (std::ptrdiff_t) position;
+
+            if (difference == 0) {
+                if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    target.m_value = std::move(p_value);
+                    target.m_sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false;
+            }
+            else {
+                position = m_enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *
+     * @brief   Takes value from the beginning of the queue if the queue is not empty.
+     *
+     * @param[out] p_value: value that is taken from the queue.
+     *
+     * @return  'true' if the value is taken, 'false' if the queue is empty.
+     *
+     */
+    bool try_pop(TypeValue & p_value) {
+        std::size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+        while (true) {
+            cell & target = m_cells[position & m_mask];
+
+            const std::size_t sequence = target.m_sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = (std::ptrdiff_t) sequence - (std::ptrdiff_t) (position + 1);
+
+            if (difference == 0) {
+                if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    p_value = std::move(target.m_value);
+                    target.m_value = TypeValue();
+                    target.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (difference < 0) {
+                return false;
+            }
+            else {
+                position = m_dequeue_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     *
+     * @brief   Returns maximum amount of elements in the queue.
+     *
+     */
+    std::size_t capacity(void) const {
+        return m_mask + 1;
+    }
+};
+
+
+}
+
+}
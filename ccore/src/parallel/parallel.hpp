@@ -22,16 +22,19 @@
 #pragma once
 
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
-#include <functional>
-#include <future>
-#include <vector>
+#include <iterator>
 
-#include "spinlock.hpp"
+#include "execution_context.hpp"
+
+#include "utils/statistics.hpp"
+#include "utils/trace.hpp"
 
 
 /* Available options: 
-    1. PARALLEL_IMPLEMENTATION_ASYNC_POOL - own parallel implementation based on std::async pool
+    1. PARALLEL_IMPLEMENTATION_POOL       - own parallel implementation based on persistent work-stealing pool
     2. PARALLEL_IMPLEMENTATION_NONE       - parallel implementation is not used
     3. PARALLEL_IMPLEMENTATION_PPL        - parallel PPL implementation (windows system only)         */
 
@@ -39,12 +42,14 @@
 #if defined(WIN32) || (_WIN32) || (_WIN64)
 #define PARALLEL_IMPLEMENTATION_PPL
 #else
-#define PARALLEL_IMPLEMENTATION_ASYNC_POOL
+#define PARALLEL_IMPLEMENTATION_POOL
 #endif
 
 
 #if defined(PARALLEL_IMPLEMENTATION_PPL)
 #include <ppl.h>
+#elif defined(PARALLEL_IMPLEMENTATION_POOL)
+#include "work_stealing_pool.hpp"
 #endif
 
 
@@ -53,114 +58,414 @@ namespace ccore {
 namespace parallel {
 
 
-/* Pool of threads is used to prevent overhead in case of nested loop */
-static const std::size_t AMOUNT_HARDWARE_THREADS = std::thread::hardware_concurrency();
-static const std::size_t AMOUNT_THREADS = (AMOUNT_HARDWARE_THREADS > 1) ? (AMOUNT_HARDWARE_THREADS - 1) : 0;
-static std::vector<std::future<void>> FUTURE_STORAGE(AMOUNT_THREADS);
-static std::vector<spinlock> FUTURE_LOCKS(AMOUNT_THREADS);
+/**
+ *
+ * @brief   Defines how iterations of a parallel loop are distributed between threads.
+ *
+ */
+enum class schedule_policy {
+    /* range is split into equal chunks in line with amount of threads, suitable when iterations have the same cost */
+    STATIC,
+
+    /* range is split into chunks of grain size that are taken by threads one by one */
+    DYNAMIC,
+
+    /* threads take chunks that are proportional to the rest of the range and decrease down to grain size */
+    GUIDED
+};
+
+
+/**
+ *
+ * @brief   Schedule of a parallel loop that consists of distribution policy and grain size - minimum amount of
+ *           iterations that are processed by one task.
+ *
+ */
+class schedule {
+private:
+    schedule_policy     m_policy    = schedule_policy::STATIC;
+    std::size_t         m_grain     = 1;
+
+public:
+    /**
+     *
+     * @brief   Creates static schedule with grain size 1.
+     *
+     */
+    schedule(void) = default;
+
+    /**
+     *
+     * @brief   Creates schedule with specified policy and grain size.
+     *
+     * @param[in] p_policy: policy that is used to distribute iterations between threads.
+     * @param[in] p_grain: minimum amount of iterations that are processed by one task (0 is considered as 1).
+     *
+     */
+    explicit schedule(const schedule_policy p_policy, const std::size_t p_grain = 1) :
+        m_policy(p_policy),
+        m_grain(std::max(p_grain, std::size_t(1)))
+    { }
+
+public:
+    /**
+     *
+     * @brief   Returns policy that is used to distribute iterations between threads.
+     *
+     */
+    schedule_policy get_policy(void) const { return m_policy; }
+
+    /**
+     *
+     * @brief   Returns minimum amount of iterations that are processed by one task.
+     *
+     */
+    std::size_t get_grain(void) const { return m_grain; }
+};
+
+
+namespace details {
+
+
+/* Range is split into several chunks per thread to balance load by stealing when iterations have different cost */
+const std::size_t AMOUNT_CHUNKS_PER_THREAD = 4;
+
+
+/**
+ *
+ * @brief   Returns begin of the chunk when range [0; p_length) is split into p_amount_chunks chunks of equal size
+ *           (the first chunks are longer by one element if the length is not divisible).
+ *
+ */
+inline std::size_t get_chunk_begin(const std::size_t p_index, const std::size_t p_length, const std::size_t p_amount_chunks) {
+    const std::size_t step = p_length / p_amount_chunks;
+    const std::size_t remainder = p_length % p_amount_chunks;
+
+    return p_index * step + std::min(p_index, remainder);
+}
 
 
-template <typename TypeIndex, typename TypeAction>
-void parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task) {
-#if defined(PARALLEL_IMPLEMENTATION_ASYNC_POOL)
-    const TypeIndex step = (p_end - p_start) / (AMOUNT_THREADS + 1);
-    TypeIndex current_start = p_start;
-    TypeIndex current_end = p_start + step;
+}
 
-    std::vector<std::size_t> captured_feature;
 
-    for (std::size_t i = 0; i < AMOUNT_THREADS; ++i) {
-        const auto async_task = [&p_task, current_start, current_end](){
-            for (TypeIndex i = current_start; i < current_end; ++i) {
-                p_task(i);
-            }
-        };
+#if defined(PARALLEL_IMPLEMENTATION_POOL)
 
-        std::size_t free_index = (std::size_t) -1;
-        for (std::size_t i = 0; i < AMOUNT_THREADS; i++) {
-            if (FUTURE_LOCKS[i].try_lock()) {
-                free_index = i;
-                break;
-            }
+namespace details {
+
+
+/**
+ *
+ * @brief   Returns amount of threads (runners) that should process specified amount of independent work items.
+ *
+ */
+inline std::size_t get_amount_runners(const std::size_t p_amount_items) {
+    const std::size_t amount_threads = execution_context::get_current_thread_count();
+    if (amount_threads < 2) {
+        return 1;
+    }
+
+    return std::min({ amount_threads, work_stealing_pool::get_instance()->size() + 1, p_amount_items });
+}
+
+
+/**
+ *
+ * @brief   Executes runner by specified amount of threads of the shared work-stealing pool.
+ * @details The current thread is one of runners and after that it helps to execute the rest tasks of the pool.
+ *           Runners activate the execution context, the cancellation scope and the statistics collector of the
+ *           current thread, therefore nested parallel loops use the same context.
+ *
+ * @param[in] p_amount_runners: amount of threads that execute the runner, it should be greater than 1.
+ * @param[in] p_runner: runner that takes work items until all of them are processed.
+ *
+ */
+template <typename TypeRunner>
+void parallel_runners(const std::size_t p_amount_runners, const TypeRunner & p_runner) {
+    const std::shared_ptr<work_stealing_pool> pool = work_stealing_pool::get_instance();
+    const execution_context * context = execution_context::get_active();
+    const bool interruptible = cancellation_scope::is_enabled();
+    utils::statistics::statistics_collector * collector = utils::statistics::statistics_collector::get_active();
+
+    const auto runner = [&p_runner, context, interruptible, collector]() {
+        execution_context_scope scope(context);
+        cancellation_scope cancellation(interruptible);
+        utils::statistics::statistics_scope statistics(collector);
+        p_runner();
+    };
+
+    work_stealing_pool::task_group group;
+    for (std::size_t index_runner = 1; index_runner < p_amount_runners; index_runner++) {
+        pool->submit(group, runner);
+    }
+
+    group.run(runner);
+    pool->wait(group);
+}
+
+
+/**
+ *
+ * @brief   Splits range [0; p_length) into specified amount of chunks and executes them by the shared work-stealing
+ *           pool.
+ * @details Amount of threads is defined by the execution context of the current thread. Each thread (runner)
+ *           takes the next unprocessed chunk until all of them are processed.
+ *
+ * @param[in] p_length: length of the range.
+ * @param[in] p_amount_chunks: amount of chunks, it should be from 1 to the length.
+ * @param[in] p_chunk_task: task that is called for each chunk with its index and borders [begin; end).
+ *
+ */
+template <typename TypeChunkAction>
+void parallel_chunks(const std::size_t p_length, const std::size_t p_amount_chunks, const TypeChunkAction & p_chunk_task) {
+    const std::size_t amount_runners = get_amount_runners(p_amount_chunks);
+    if (amount_runners < 2) {
+        for (std::size_t index = 0; index < p_amount_chunks; index++) {
+            execution_context::throw_if_cancelled();
+
+            utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+            p_chunk_task(index, get_chunk_begin(index, p_length, p_amount_chunks), get_chunk_begin(index + 1, p_length, p_amount_chunks));
         }
 
-        if (free_index != (std::size_t) -1) {
-            FUTURE_STORAGE[free_index] = std::async(std::launch::async, async_task);
-            captured_feature.push_back(free_index);
+        return;
+    }
+
+    std::atomic<std::size_t> next_chunk(0);
+    parallel_runners(amount_runners, [&p_chunk_task, &next_chunk, p_length, p_amount_chunks]() {
+        for (std::size_t index = next_chunk.fetch_add(1); index < p_amount_chunks; index = next_chunk.fetch_add(1)) {
+            execution_context::throw_if_cancelled();
+
+            utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+            p_chunk_task(index, get_chunk_begin(index, p_length, p_amount_chunks), get_chunk_begin(index + 1, p_length, p_amount_chunks));
         }
-        else {
-            async_task();
+    });
+}
+
+
+/**
+ *
+ * @brief   Executes range [0; p_length) by the shared work-stealing pool using guided self-scheduling.
+ * @details Each runner takes chunk of size that is proportional to the rest of the range divided by amount of
+ *           runners but not less than grain size. Large chunks at the beginning reduce synchronization overhead and
+ *           small chunks at the end balance iterations with different cost.
+ *
+ * @param[in] p_length: length of the range.
+ * @param[in] p_grain: minimum size of chunk.
+ * @param[in] p_chunk_task: task that is called for each chunk with its borders [begin; end).
+ *
+ */
+template <typename TypeChunkAction>
+void parallel_guided(const std::size_t p_length, const std::size_t p_grain, const TypeChunkAction & p_chunk_task) {
+    const std::size_t amount_runners = get_amount_runners((p_length + p_grain - 1) / p_grain);
+    if (amount_runners < 2) {
+        /* chunks are still used to check cancellation, their amount is logarithmic to the length */
+        for (std::size_t begin = 0; begin < p_length; ) {
+            const std::size_t rest = p_length - begin;
+            const std::size_t size = std::min(rest, std::max(p_grain, rest / 2));
+
+            execution_context::throw_if_cancelled();
+
+            utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+            p_chunk_task(begin, begin + size);
+            begin += size;
         }
 
-        current_start = current_end;
-        current_end += step;
+        return;
     }
 
-    for (TypeIndex i = current_start; i < p_end; ++i) {
-        p_task(i);
+    std::atomic<std::size_t> next_index(0);
+    parallel_runners(amount_runners, [&p_chunk_task, &next_index, p_length, p_grain, amount_runners]() {
+        std::size_t begin = next_index.load();
+        while (begin < p_length) {
+            const std::size_t rest = p_length - begin;
+            const std::size_t size = std::min(rest, std::max(p_grain, rest / (2 * amount_runners)));
+
+            if (next_index.compare_exchange_weak(begin, begin + size)) {
+                execution_context::throw_if_cancelled();
+
+                utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+                p_chunk_task(begin, begin + size);
+                begin = next_index.load();
+            }
+        }
+    });
+}
+
+
+/**
+ *
+ * @brief   Splits range [0; p_length) into chunks in line with schedule and executes them by the shared
+ *           work-stealing pool.
+ *
+ * @param[in] p_length: length of the range.
+ * @param[in] p_schedule: schedule that defines distribution of the range between threads.
+ * @param[in] p_chunk_task: task that is called for each chunk with its borders [begin; end).
+ *
+ */
+template <typename TypeChunkAction>
+void parallel_chunks(const std::size_t p_length, const schedule & p_schedule, const TypeChunkAction & p_chunk_task) {
+    const std::size_t amount_threads = execution_context::get_current_thread_count();
+    const std::size_t amount_grains = (p_length + p_schedule.get_grain() - 1) / p_schedule.get_grain();
+
+    std::size_t amount_chunks = amount_grains;
+    switch (p_schedule.get_policy()) {
+    case schedule_policy::STATIC:
+        amount_chunks = std::min(amount_grains, amount_threads * AMOUNT_CHUNKS_PER_THREAD);
+        break;
+
+    case schedule_policy::GUIDED:
+        if ((amount_grains > 1) && (amount_threads > 1)) {
+            parallel_guided(p_length, p_schedule.get_grain(), p_chunk_task);
+            return;
+        }
+        break;
+
+    case schedule_policy::DYNAMIC:
+        break;
     }
 
-    for (auto index_feature : captured_feature) {
-        FUTURE_STORAGE[index_feature].get();
-        FUTURE_LOCKS[index_feature].unlock();
+    if ((amount_chunks < 2) || (amount_threads < 2)) {
+        execution_context::throw_if_cancelled();
+
+        utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+        p_chunk_task(std::size_t(0), p_length);
+        return;
     }
+
+    parallel_chunks(p_length, amount_chunks, [&p_chunk_task](const std::size_t, const std::size_t p_begin, const std::size_t p_end) {
+        p_chunk_task(p_begin, p_end);
+    });
+}
+
+
+}
+
 #elif defined(PARALLEL_IMPLEMENTATION_PPL)
-    concurrency::parallel_for(p_start, p_end, p_task);
-#else
-    for (std::size_t i = p_start; i < p_end; i++) {
-        p_task(i);
+
+namespace details {
+
+
+/**
+ *
+ * @brief   Splits range [0; p_length) into chunks in line with schedule and executes them by PPL.
+ * @details PPL threads activate the execution context, the cancellation scope and the statistics collector of the
+ *           current thread, cancellation is checked at the beginning of each chunk as it is done by the pool.
+ *
+ * @param[in] p_length: length of the range.
+ * @param[in] p_schedule: schedule that defines distribution of the range between threads.
+ * @param[in] p_chunk_task: task that is called for each chunk with its borders [begin; end).
+ *
+ */
+template <typename TypeChunkAction>
+void parallel_chunks(const std::size_t p_length, const schedule & p_schedule, const TypeChunkAction & p_chunk_task) {
+    const std::size_t amount_threads = execution_context::get_current_thread_count();
+    const std::size_t amount_grains = (p_length + p_schedule.get_grain() - 1) / p_schedule.get_grain();
+
+    std::size_t amount_chunks = amount_grains;
+    if (p_schedule.get_policy() == schedule_policy::STATIC) {
+        amount_chunks = std::min(amount_grains, amount_threads * AMOUNT_CHUNKS_PER_THREAD);
     }
-#endif
-}
 
+    if ((amount_chunks < 2) || (amount_threads < 2)) {
+        execution_context::throw_if_cancelled();
 
-template <typename TypeIter, typename TypeAction>
-void parallel_for_each(const TypeIter p_begin, const TypeIter p_end, const TypeAction & p_task) {
-#if defined(PARALLEL_IMPLEMENTATION_ASYNC_POOL)
-    const std::size_t step = std::distance(p_begin, p_end) / (AMOUNT_THREADS + 1);
+        utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+        p_chunk_task(std::size_t(0), p_length);
+        return;
+    }
 
-    auto current_start = p_begin;
-    auto current_end = p_begin + step;
+    const execution_context * context = execution_context::get_active();
+    const bool interruptible = cancellation_scope::is_enabled();
+    utils::statistics::statistics_collector * collector = utils::statistics::statistics_collector::get_active();
 
-    std::vector<std::size_t> captured_feature;
+    const auto chunk = [&p_chunk_task, context, interruptible, collector, p_length, amount_chunks](const std::size_t p_index) {
+        execution_context_scope scope(context);
+        cancellation_scope cancellation(interruptible);
+        utils::statistics::statistics_scope statistics(collector);
 
-    for (std::size_t i = 0; i < AMOUNT_THREADS; ++i) {
-        auto async_task = [&p_task, current_start, current_end](){
-            for (auto iter = current_start; iter != current_end; ++iter) {
-                p_task(*iter);
-            }
-        };
+        execution_context::throw_if_cancelled();
 
-        std::size_t free_index = (std::size_t) -1;
-        for (std::size_t i = 0; i < AMOUNT_THREADS; i++) {
-            if (FUTURE_LOCKS[i].try_lock()) {
-                free_index = i;
-                break;
-            }
-        }
+        utils::trace::trace_scope trace("parallel_for chunk", "parallel");
+        p_chunk_task(get_chunk_begin(p_index, p_length, amount_chunks), get_chunk_begin(p_index + 1, p_length, amount_chunks));
+    };
 
-        if (free_index != (std::size_t) -1) {
-            FUTURE_STORAGE[free_index] = std::async(std::launch::async, async_task);
-            captured_feature.push_back(free_index);
-        }
-        else {
-            async_task();
-        }
+    switch (p_schedule.get_policy()) {
+    case schedule_policy::STATIC:
+        concurrency::parallel_for(std::size_t(0), amount_chunks, std::size_t(1), chunk, concurrency::static_partitioner());
+        break;
+
+    case schedule_policy::DYNAMIC:
+        concurrency::parallel_for(std::size_t(0), amount_chunks, std::size_t(1), chunk, concurrency::simple_partitioner(1));
+        break;
 
-        current_start = current_end;
-        current_end += step;
+    case schedule_policy::GUIDED:
+        concurrency::parallel_for(std::size_t(0), amount_chunks, std::size_t(1), chunk, concurrency::auto_partitioner());
+        break;
     }
+}
 
-    for (auto iter = current_start; iter != p_end; ++iter) {
-        p_task(*iter);
+
+}
+
+#endif
+
+
+/**
+ *
+ * @brief   Executes task for each index from range [p_start; p_end) in parallel in line with specified schedule.
+ *
+ * @param[in] p_start: first index of the range.
+ * @param[in] p_end: index that follows the last index of the range.
+ * @param[in] p_task: task that is called for each index.
+ * @param[in] p_schedule: schedule that defines distribution of iterations between threads, dynamic or guided
+ *             policy should be used when iterations have significantly different cost.
+ *
+ * @throw   operation_cancelled if cancellation of the current call is requested inside of 'cancellation_scope', the
+ *           rest chunks are not executed.
+ *
+ */
+template <typename TypeIndex, typename TypeAction>
+void parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task, const schedule & p_schedule) {
+#if defined(PARALLEL_IMPLEMENTATION_POOL) || defined(PARALLEL_IMPLEMENTATION_PPL)
+    if (p_start >= p_end) {
+        return;
     }
 
-    for (auto index_feature : captured_feature) {
-        FUTURE_STORAGE[index_feature].get();
-        FUTURE_LOCKS[index_feature].unlock();
+    details::parallel_chunks((std::size_t) (p_end - p_start), p_schedule, [p_start, &p_task](const std::size_t p_chunk_begin, const std::size_t p_chunk_end) {
+        const TypeIndex end = p_start + (TypeIndex) p_chunk_end;
+        for (TypeIndex i = p_start + (TypeIndex) p_chunk_begin; i < end; ++i) {
+            p_task(i);
+        }
+    });
+#else
+    (void) p_schedule;
+
+    for (TypeIndex i = p_start; i < p_end; ++i) {
+        p_task(i);
     }
-#elif defined(PARALLEL_IMPLEMENTATION_PPL)
-    concurrency::parallel_for_each(p_begin, p_end, p_task);
+#endif
+}
+
+
+template <typename TypeIndex, typename TypeAction>
+void parallel_for(const TypeIndex p_start, const TypeIndex p_end, const TypeAction & p_task) {
+    parallel_for(p_start, p_end, p_task, schedule());
+}
+
+
+template <typename TypeIter, typename TypeAction>
+void parallel_for_each(const TypeIter p_begin, const TypeIter p_end, const TypeAction & p_task) {
+#if defined(PARALLEL_IMPLEMENTATION_POOL) || defined(PARALLEL_IMPLEMENTATION_PPL)
+    const auto length = std::distance(p_begin, p_end);
+    if (length <= 0) {
+        return;
+    }
+
+    details::parallel_chunks((std::size_t) length, schedule(), [p_begin, &p_task](const std::size_t p_chunk_begin, const std::size_t p_chunk_end) {
+        const TypeIter end = std::next(p_begin, p_chunk_end);
+        for (auto iter = std::next(p_begin, p_chunk_begin); iter != end; ++iter) {
+            p_task(*iter);
+        }
+    });
 #else
     for (auto iter = p_begin; iter != p_end; ++iter) {
         p_task(*iter);
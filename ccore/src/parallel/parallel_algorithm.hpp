@@ -0,0 +1,273 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "parallel.hpp"
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+namespace details {
+
+
+/* Amount of chunks of reduction and scan depends on length of range only (not on amount of threads), therefore
+   partial results are combined in the same order and floating-point result is the same on any system. */
+const std::size_t MAXIMUM_REDUCTION_CHUNKS      = 256;
+
+/* Ranges that are shorter are sorted serially, longer ranges are split into chunks that are not shorter than half of it. */
+const std::size_t MINIMUM_PARALLEL_SORT_LENGTH  = 8192;
+const std::size_t MAXIMUM_SORT_CHUNKS           = 64;
+
+
+inline std::size_t get_reduction_chunks(const std::size_t p_length, const std::size_t p_grain) {
+    const std::size_t grain = std::max(p_grain, std::size_t(1));
+    return std::min(MAXIMUM_REDUCTION_CHUNKS, (p_length + grain - 1) / grain);
+}
+
+
+}
+
+
+/**
+ *
+ * @brief   Transforms each index of range [p_start; p_end) and reduces results using binary operation.
+ * @details Range is split into chunks in line with its length and the grain only, results of chunks are combined
+ *           from left to right starting from the initial value, therefore the result does not depend on amount of
+ *           threads. Transform is called exactly once for each index. Reduce operation should be associative.
+ *
+ * @param[in] p_start: the first index of the range.
+ * @param[in] p_end: index after the last index of the range.
+ * @param[in] p_init: initial value of the reduction.
+ * @param[in] p_reduce: binary operation that combines two values.
+ * @param[in] p_transform: operation that returns value for an index.
+ * @param[in] p_grain: minimum amount of indexes that are processed by one task, it should be increased when
+ *             transform is cheap.
+ *
+ * @return  Returns reduced value, the initial value if the range is empty.
+ *
+ */
+template <typename TypeIndex, typename TypeValue, typename TypeReduce, typename TypeTransform>
+TypeValue parallel_transform_reduce(const TypeIndex p_start, const TypeIndex p_end, const TypeValue & p_init, const TypeReduce & p_reduce, const TypeTransform & p_transform, const std::size_t p_grain = 1) {
+    if (p_start >= p_end) {
+        return p_init;
+    }
+
+    const std::size_t length = (std::size_t) (p_end - p_start);
+    const std::size_t amount_chunks = details::get_reduction_chunks(length, p_grain);
+
+    std::vector<TypeValue> partials(amount_chunks, p_init);
+    parallel_for(std::size_t(0), amount_chunks, [p_start, length, amount_chunks, &partials, &p_reduce, &p_transform](const std::size_t p_chunk) {
+        const TypeIndex begin = p_start + (TypeIndex) details::get_chunk_begin(p_chunk, length, amount_chunks);
+        const TypeIndex end = p_start + (TypeIndex) details::get_chunk_begin(p_chunk + 1, length, amount_chunks);
+
+        TypeValue partial = p_transform(begin);
+        for (TypeIndex i = begin + 1; i < end; ++i) {
+            partial = p_reduce(partial, p_transform(i));
+        }
+
+        partials[p_chunk] = std::move(partial);
+    });
+
+    TypeValue result = p_init;
+    for (const auto & partial : partials) {
+        result = p_reduce(result, partial);
+    }
+
+    return result;
+}
+
+
+/**
+ *
+ * @brief   Reduces elements of range [p_begin; p_end) using binary operation in deterministic order.
+ *
+ * @param[in] p_begin: random access iterator to the first element.
+ * @param[in] p_end: random access iterator after the last element.
+ * @param[in] p_init: initial value of the reduction.
+ * @param[in] p_reduce: associative binary operation that combines two values.
+ * @param[in] p_grain: minimum amount of elements that are processed by one task.
+ *
+ * @return  Returns reduced value, the initial value if the range is empty.
+ *
+ * @see parallel_transform_reduce
+ *
+ */
+template <typename TypeIter, typename TypeValue, typename TypeReduce>
+TypeValue parallel_reduce(const TypeIter p_begin, const TypeIter p_end, const TypeValue & p_init, const TypeReduce & p_reduce, const std::size_t p_grain = 1) {
+    return parallel_transform_reduce(std::size_t(0), (std::size_t) std::distance(p_begin, p_end), p_init, p_reduce,
+        [p_begin](const std::size_t p_index) -> TypeValue { return *(p_begin + p_index); }, p_grain);
+}
+
+
+/**
+ *
+ * @brief   Calculates inclusive prefix of range [p_begin; p_end) using binary operation and writes it to output.
+ * @details Range is split into chunks in line with its length and the grain only: totals of chunks are calculated
+ *           in parallel, then offsets of chunks are calculated serially and after that each chunk is scanned in
+ *           parallel. Output may be the same as input.
+ *
+ * @param[in] p_begin: random access iterator to the first element.
+ * @param[in] p_end: random access iterator after the last element.
+ * @param[in] p_output: random access iterator to the first element of output.
+ * @param[in] p_operation: associative binary operation.
+ * @param[in] p_grain: minimum amount of elements that are processed by one task.
+ *
+ * @return  Returns iterator after the last written element of output.
+ *
+ */
+template <typename TypeIter, typename TypeOutputIter, typename TypeOperation>
+TypeOutputIter parallel_inclusive_scan(const TypeIter p_begin, const TypeIter p_end, const TypeOutputIter p_output, const TypeOperation & p_operation, const std::size_t p_grain = 1) {
+    using value_type = typename std::iterator_traits<TypeIter>::value_type;
+
+    const std::size_t length = (std::size_t) std::distance(p_begin, p_end);
+    if (length == 0) {
+        return p_output;
+    }
+
+    const std::size_t amount_chunks = details::get_reduction_chunks(length, p_grain);
+
+    const auto scan_chunk = [p_begin, p_output, length, amount_chunks, &p_operation](const std::size_t p_chunk, const value_type * p_offset) {
+        const std::size_t begin = details::get_chunk_begin(p_chunk, length, amount_chunks);
+        const std::size_t end = details::get_chunk_begin(p_chunk + 1, length, amount_chunks);
+
+        value_type value = p_offset ? p_operation(*p_offset, *(p_begin + begin)) : value_type(*(p_begin + begin));
+        *(p_output + begin) = value;
+
+        for (std::size_t i = begin + 1; i < end; i++) {
+            value = p_operation(value, *(p_begin + i));
+            *(p_output + i) = value;
+        }
+    };
+
+    if (amount_chunks == 1) {
+        scan_chunk(0, nullptr);
+        return p_output + length;
+    }
+
+    std::vector<value_type> totals(amount_chunks, *p_begin);
+    parallel_for(std::size_t(0), amount_chunks, [p_begin, length, amount_chunks, &totals, &p_operation](const std::size_t p_chunk) {
+        const std::size_t begin = details::get_chunk_begin(p_chunk, length, amount_chunks);
+        const std::size_t end = details::get_chunk_begin(p_chunk + 1, length, amount_chunks);
+
+        value_type total = *(p_begin + begin);
+        for (std::size_t i = begin + 1; i < end; i++) {
+            total = p_operation(total, *(p_begin + i));
+        }
+
+        totals[p_chunk] = std::move(total);
+    });
+
+    for (std::size_t i = 1; i < amount_chunks; i++) {
+        totals[i] = p_operation(totals[i - 1], totals[i]);
+    }
+
+    parallel_for(std::size_t(0), amount_chunks, [&scan_chunk, &totals](const std::size_t p_chunk) {
+        scan_chunk(p_chunk, (p_chunk > 0) ? &totals[p_chunk - 1] : nullptr);
+    });
+
+    return p_output + length;
+}
+
+
+/**
+ *
+ * @brief   Calculates inclusive prefix sum of range [p_begin; p_end) and writes it to output.
+ *
+ * @see parallel_inclusive_scan
+ *
+ */
+template <typename TypeIter, typename TypeOutputIter>
+TypeOutputIter parallel_inclusive_scan(const TypeIter p_begin, const TypeIter p_end, const TypeOutputIter p_output) {
+    return parallel_inclusive_scan(p_begin, p_end, p_output, std::plus<typename std::iterator_traits<TypeIter>::value_type>());
+}
+
+
+/**
+ *
+ * @brief   Sorts range [p_begin; p_end) using comparator.
+ * @details Short ranges are sorted by 'std::sort'. Long ranges are split into chunks in line with length, chunks
+ *           are sorted in parallel and then neighbor sorted sequences are merged in parallel pairwise. Order of equal
+ *           elements is not specified but it does not depend on amount of threads.
+ *
+ * @param[in] p_begin: random access iterator to the first element.
+ * @param[in] p_end: random access iterator after the last element.
+ * @param[in] p_compare: comparator that defines strict weak ordering.
+ *
+ */
+template <typename TypeIter, typename TypeCompare>
+void parallel_sort(const TypeIter p_begin, const TypeIter p_end, const TypeCompare & p_compare) {
+    const std::size_t length = (std::size_t) std::distance(p_begin, p_end);
+    if (length < details::MINIMUM_PARALLEL_SORT_LENGTH) {
+        std::sort(p_begin, p_end, p_compare);
+        return;
+    }
+
+    const std::size_t amount_chunks = std::min(details::MAXIMUM_SORT_CHUNKS, length / (details::MINIMUM_PARALLEL_SORT_LENGTH / 2));
+    const auto chunk_begin = [p_begin, length, amount_chunks](const std::size_t p_chunk) {
+        return p_begin + details::get_chunk_begin(std::min(p_chunk, amount_chunks), length, amount_chunks);
+    };
+
+    parallel_for(std::size_t(0), amount_chunks, [&chunk_begin, &p_compare](const std::size_t p_chunk) {
+        std::sort(chunk_begin(p_chunk), chunk_begin(p_chunk + 1), p_compare);
+    });
+
+    for (std::size_t width = 1; width < amount_chunks; width *= 2) {
+        const std::size_t amount_merges = (amount_chunks + 2 * width - 1) / (2 * width);
+
+        parallel_for(std::size_t(0), amount_merges, [&chunk_begin, &p_compare, width, amount_chunks](const std::size_t p_merge) {
+            const std::size_t left = p_merge * 2 * width;
+            const std::size_t middle = left + width;
+
+            if (middle < amount_chunks) {
+                std::inplace_merge(chunk_begin(left), chunk_begin(middle), chunk_begin(middle + width), p_compare);
+            }
+        });
+    }
+}
+
+
+/**
+ *
+ * @brief   Sorts range [p_begin; p_end) in ascending order.
+ *
+ * @see parallel_sort
+ *
+ */
+template <typename TypeIter>
+void parallel_sort(const TypeIter p_begin, const TypeIter p_end) {
+    parallel_sort(p_begin, p_end, std::less<typename std::iterator_traits<TypeIter>::value_type>());
+}
+
+
+}
+
+}
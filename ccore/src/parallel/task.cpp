@@ -21,26 +21,60 @@
 
 #include "task.hpp"
 
+#include <thread>
+
 
 namespace ccore {
 
 namespace parallel {
 
 
+const std::size_t task::AMOUNT_SPIN_ITERATIONS = 1024;
+
+
 task::task(const proc & p_task) :
     m_task(p_task)
-{ 
-    m_ready.lock();
-}
+{ }
+
+
+task::task(proc && p_task) :
+    m_task(std::move(p_task))
+{ }
 
 
 void task::set_ready(void) {
-    m_ready.unlock();
+    m_ready.store(true);
+
+    /* the waiter increases counter before it checks the state under the mutex, therefore it is notified or sees the state */
+    if (m_waiters.load() > 0) {
+        std::lock_guard<std::mutex> guard(m_ready_mutex);
+        m_ready_cond.notify_all();
+    }
+}
+
+
+bool task::is_ready(void) const {
+    return m_ready.load(std::memory_order_acquire);
 }
 
 
 void task::wait_ready(void) const {
-    m_ready.lock();
+    for (std::size_t i = 0; i < AMOUNT_SPIN_ITERATIONS; i++) {
+        if (is_ready()) {
+            return;
+        }
+
+        if (i % 64 == 63) {
+            std::this_thread::yield();
+        }
+    }
+
+    m_waiters.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(m_ready_mutex);
+        m_ready_cond.wait(lock, [this]() { return m_ready.load(); });
+    }
+    m_waiters.fetch_sub(1);
 }
 
 
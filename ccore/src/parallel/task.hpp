@@ -22,13 +22,12 @@
 #pragma once
 
 
+#include <atomic>
 #include <condition_variable>
-#include <functional>
-#include <list>
 #include <memory>
 #include <mutex>
 
-#include "spinlock.hpp"
+#include "task_function.hpp"
 
 
 namespace ccore {
@@ -39,27 +38,45 @@ namespace parallel {
 class thread_executor;
 
 
+/**
+ *
+ * @brief   Task of the thread pool that can be waited for completion.
+ * @details Waiting thread spins for a short time because fine-grained tasks are usually completed quickly and
+ *           then blocks on the condition variable to release its core.
+ *
+ */
 class task {
 public:
     friend thread_executor;
 
 public:
-    using proc      = std::function<void(void)>;
+    using proc      = task_function;
     using ptr       = std::shared_ptr<task>;
     using id        = std::size_t;
 
 private:
-    proc                m_task          = proc();
-    mutable spinlock    m_ready;
+    /* amount of checks of the ready state before waiting thread is blocked */
+    static const std::size_t AMOUNT_SPIN_ITERATIONS;
+
+private:
+    proc                                m_task          = proc();
+
+    std::atomic<bool>                   m_ready         = { false };
+    mutable std::atomic<std::size_t>    m_waiters       = { 0 };
+
+    mutable std::mutex                  m_ready_mutex;
+    mutable std::condition_variable     m_ready_cond;
 
 public:
     task(void) = default;
 
     explicit task(const proc & p_task);
 
-    task(const task & p_other) = default;
+    explicit task(proc && p_task);
+
+    task(const task & p_other) = delete;
 
-    task(task && p_other) = default;
+    task(task && p_other) = delete;
 
     ~task(void) = default;
 
@@ -67,6 +84,18 @@ private:
     void set_ready(void);
 
 public:
+    /**
+     *
+     * @brief   Returns 'true' if the task has been executed.
+     *
+     */
+    bool is_ready(void) const;
+
+    /**
+     *
+     * @brief   Waits until the task is executed.
+     *
+     */
     void wait_ready(void) const;
 
 public:
@@ -0,0 +1,254 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+/**
+ *
+ * @brief   Type-erased callable object without arguments and result that stores small callables (for example,
+ *           lambdas that capture several references) inside the object without dynamic memory allocation.
+ * @details Callables that do not fit into the internal buffer or whose move constructor may throw are allocated
+ *           on the heap. Copying is supported only for copy-constructible callables.
+ *
+ */
+class task_function {
+public:
+    /**
+     *
+     * @brief   Size of the internal buffer that is used to store callables without dynamic memory allocation.
+     *
+     */
+    static const std::size_t INPLACE_SIZE = 6 * sizeof(void *);
+
+private:
+    using storage = typename std::aligned_storage<INPLACE_SIZE, alignof(std::max_align_t)>::type;
+
+    struct operations {
+        void (*m_invoke)(storage &);
+        void (*m_move)(storage &, storage &);
+        void (*m_copy)(const storage &, storage &);
+        void (*m_destroy)(storage &);
+    };
+
+    template <typename TypeCallable>
+    using is_inplace = std::integral_constant<bool,
+        (sizeof(TypeCallable) <= INPLACE_SIZE) &&
+        (alignof(std::max_align_t) % alignof(TypeCallable) == 0) &&
+        std::is_nothrow_move_constructible<TypeCallable>::value>;
+
+    template <typename TypeCallable>
+    struct inplace_operations {
+        static TypeCallable & get(storage & p_storage) { return *reinterpret_cast<TypeCallable *>(&p_storage); }
+
+        static const TypeCallable & get(const storage & p_storage) { return *reinterpret_cast<const TypeCallable *>(&p_storage); }
+
+        static void invoke(storage & p_storage) { get(p_storage)(); }
+
+        static void move(storage & p_source, storage & p_destination) {
+            new (&p_destination) TypeCallable(std::move(get(p_source)));
+            get(p_source).~TypeCallable();
+        }
+
+        static void copy(const storage & p_source, storage & p_destination) { copy_callable(p_source, p_destination, std::is_copy_constructible<TypeCallable>()); }
+
+        static void destroy(storage & p_storage) { get(p_storage).~TypeCallable(); }
+
+        static void copy_callable(const storage & p_source, storage & p_destination, std::true_type) { new (&p_destination) TypeCallable(get(p_source)); }
+
+        static void copy_callable(const storage &, storage &, std::false_type) { throw std::bad_function_call(); }
+    };
+
+    template <typename TypeCallable>
+    struct heap_operations {
+        static TypeCallable *& get(storage & p_storage) { return *reinterpret_cast<TypeCallable **>(&p_storage); }
+
+        static TypeCallable * get(const storage & p_storage) { return *reinterpret_cast<TypeCallable * const *>(&p_storage); }
+
+        static void invoke(storage & p_storage) { (*get(p_storage))(); }
+
+        static void move(storage & p_source, storage & p_destination) {
+            new (&p_destination) TypeCallable *(get(p_source));
+            get(p_source) = nullptr;
+        }
+
+        static void copy(const storage & p_source, storage & p_destination) { copy_callable(p_source, p_destination, std::is_copy_constructible<TypeCallable>()); }
+
+        static void destroy(storage & p_storage) { delete get(p_storage); }
+
+        static void copy_callable(const storage & p_source, storage & p_destination, std::true_type) { new (&p_destination) TypeCallable *(new TypeCallable(*get(p_source))); }
+
+        static void copy_callable(const storage &, storage &, std::false_type) { throw std::bad_function_call(); }
+    };
+
+    template <typename TypeCallable>
+    struct operations_holder {
+        using implementation = typename std::conditional<is_inplace<TypeCallable>::value,
+            inplace_operations<TypeCallable>, heap_operations<TypeCallable>>::type;
+
+        static const operations * get(void) {
+            static const operations instance = { &implementation::invoke, &implementation::move, &implementation::copy, &implementation::destroy };
+            return &instance;
+        }
+    };
+
+private:
+    mutable storage     m_storage;
+    const operations *  m_operations = nullptr;
+
+public:
+    /**
+     *
+     * @brief   Creates empty function.
+     *
+     */
+    task_function(void) = default;
+
+    /**
+     *
+     * @brief   Creates empty function.
+     *
+     */
+    task_function(std::nullptr_t) { }
+
+    /**
+     *
+     * @brief   Creates function that stores copy of the callable object.
+     *
+     * @param[in] p_callable: callable object without arguments.
+     *
+     */
+    template <typename TypeCallable, typename = typename std::enable_if<
+        !std::is_same<typename std::decay<TypeCallable>::type, task_function>::value>::type>
+    task_function(TypeCallable && p_callable) {
+        using callable = typename std::decay<TypeCallable>::type;
+        assign(std::forward<TypeCallable>(p_callable), is_inplace<callable>());
+        m_operations = operations_holder<callable>::get();
+    }
+
+    task_function(const task_function & p_other) {
+        if (p_other.m_operations) {
+            p_other.m_operations->m_copy(p_other.m_storage, m_storage);
+            m_operations = p_other.m_operations;
+        }
+    }
+
+    task_function(task_function && p_other) noexcept {
+        if (p_other.m_operations) {
+            p_other.m_operations->m_move(p_other.m_storage, m_storage);
+            m_operations = p_other.m_operations;
+            p_other.m_operations = nullptr;
+        }
+    }
+
+    ~task_function(void) {
+        reset();
+    }
+
+public:
+    task_function & operator=(const task_function & p_other) {
+        if (this != &p_other) {
+            task_function copy(p_other);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    task_function & operator=(task_function && p_other) noexcept {
+        if (this != &p_other) {
+            reset();
+
+            if (p_other.m_operations) {
+                p_other.m_operations->m_move(p_other.m_storage, m_storage);
+                m_operations = p_other.m_operations;
+                p_other.m_operations = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    task_function & operator=(std::nullptr_t) {
+        reset();
+        return *this;
+    }
+
+    /**
+     *
+     * @brief   Calls stored callable object.
+     *
+     * @throw   std::bad_function_call if the function is empty.
+     *
+     */
+    void operator()(void) const {
+        if (!m_operations) {
+            throw std::bad_function_call();
+        }
+
+        m_operations->m_invoke(m_storage);
+    }
+
+    /**
+     *
+     * @brief   Returns 'true' if the function stores callable object.
+     *
+     */
+    explicit operator bool(void) const {
+        return m_operations != nullptr;
+    }
+
+private:
+    void reset(void) {
+        if (m_operations) {
+            m_operations->m_destroy(m_storage);
+            m_operations = nullptr;
+        }
+    }
+
+    template <typename TypeCallable>
+    void assign(TypeCallable && p_callable, std::true_type) {
+        new (&m_storage) typename std::decay<TypeCallable>::type(std::forward<TypeCallable>(p_callable));
+    }
+
+    template <typename TypeCallable>
+    void assign(TypeCallable && p_callable, std::false_type) {
+        using callable = typename std::decay<TypeCallable>::type;
+        new (&m_storage) callable *(new callable(std::forward<TypeCallable>(p_callable)));
+    }
+};
+
+
+}
+
+}
@@ -23,6 +23,8 @@
 
 #include <exception>
 
+#include "utils/trace.hpp"
+
 
 namespace ccore {
 
@@ -43,7 +45,11 @@ void thread_executor::run(void) {
         m_getter(task);
 
         if (task) {
-            (*task)();
+            {
+                utils::trace::trace_scope trace("thread_pool task", "pool");
+                (*task)();
+            }
+
             task->set_ready();
         }
         else {
@@ -32,20 +32,28 @@ namespace parallel {
 const std::size_t   thread_pool::DEFAULT_POOL_SIZE =
         (std::thread::hardware_concurrency() > 1) ? std::thread::hardware_concurrency() : 4;
 
+const std::size_t   thread_pool::QUEUE_CAPACITY = 4096;
 
-thread_pool::thread_pool(void) {
+const std::size_t   thread_pool::AMOUNT_SPIN_ITERATIONS = 256;
+
+
+thread_pool::thread_pool(void) :
+    m_queue(QUEUE_CAPACITY)
+{
     initialize(DEFAULT_POOL_SIZE);
 }
 
 
-thread_pool::thread_pool(const std::size_t p_size) {
+thread_pool::thread_pool(const std::size_t p_size) :
+    m_queue(QUEUE_CAPACITY)
+{
     initialize(p_size);
 }
 
 
 thread_pool::~thread_pool(void) {
     {
-        std::lock_guard<std::mutex> lock_common(m_common_mutex);
+        std::lock_guard<std::mutex> guard(m_sleep_mutex);
         m_stop = true;
     }
 
@@ -58,37 +66,27 @@ thread_pool::~thread_pool(void) {
 
 
 task::ptr thread_pool::add_task(const task::proc & p_raw_task) {
-    task::ptr client_task = std::make_shared<task>(p_raw_task);
-
-    {
-        std::lock_guard<std::mutex> lock_common(m_common_mutex);
-
-        m_queue.push_back(client_task);
-    }
-
-    m_queue_not_empty_cond.notify_one();
+    queue_entry entry = { std::make_shared<task>(p_raw_task), false };
+    task::ptr client_task = entry.m_task;
 
+    push_entry(entry);
     return client_task;
 }
 
 
 task::ptr thread_pool::add_task_if_free(const task::proc & p_raw_task) {
-    task::ptr client_task = nullptr;
-
-    {
-        std::lock_guard<std::mutex> lock_common(m_common_mutex);
-
-        if (m_reserve > 0) {
-            client_task = std::make_shared<task>(p_raw_task);
-
-            m_queue.push_back(client_task);
-
-            m_queue_not_empty_cond.notify_one();
-
-            m_reserve--;
+    std::size_t reserve = m_reserve.load();
+    do {
+        if (reserve == 0) {
+            return nullptr;
         }
     }
+    while (!m_reserve.compare_exchange_weak(reserve, reserve - 1));
+
+    queue_entry entry = { std::make_shared<task>(p_raw_task), true };
+    task::ptr client_task = entry.m_task;
 
+    push_entry(entry);
     return client_task;
 }
 
@@ -100,40 +98,89 @@ std::size_t thread_pool::size(void) const {
 
 void thread_pool::initialize(const std::size_t p_size) {
     m_pool    = { };
-    m_queue   = { };
     m_stop    = false;
+    m_reserve = 0;      /* each thread reserves itself when it is ready to take a task */
 
     thread_executor::task_getter getter = std::bind(&thread_pool::get_task, this, std::placeholders::_1);
 
     for (std::size_t index = 0; index < p_size; index++) {
         m_pool.emplace_back(new thread_executor(getter));
     }
+}
 
-    m_reserve = m_free = p_size;
+
+void thread_pool::push_entry(queue_entry & p_entry) {
+    if (!m_queue.try_push(p_entry)) {
+        std::lock_guard<spinlock> guard(m_overflow_lock);
+        m_overflow.push_back(std::move(p_entry));
+        m_overflow_size.fetch_add(1);
+    }
+
+    /* the task should be visible for a thread that has not been counted as sleeping yet */
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    /* the mutex guarantees that a thread that has not found tasks is already waiting for the notification */
+    if (m_sleeping.load() > 0) {
+        { std::lock_guard<std::mutex> guard(m_sleep_mutex); }
+        m_queue_not_empty_cond.notify_one();
+    }
 }
 
 
-void thread_pool::get_task(task::ptr & p_task) {
-    std::unique_lock<std::mutex> lock_common(m_common_mutex);
+bool thread_pool::pop_entry(queue_entry & p_entry) {
+    if (!m_queue.try_pop(p_entry)) {
+        if (m_overflow_size.load() == 0) {
+            return false;
+        }
 
+        std::lock_guard<spinlock> guard(m_overflow_lock);
+        if (m_overflow.empty()) {
+            return false;
+        }
+
+        p_entry = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        m_overflow_size.fetch_sub(1);
+    }
+
+    /* a task that has not been reserved occupies a free thread */
+    if (!p_entry.m_reserved) {
+        m_reserve.fetch_sub(1);
+    }
+
+    return true;
+}
+
+
+void thread_pool::get_task(task::ptr & p_task) {
     p_task = nullptr;
+    m_reserve.fetch_add(1);
 
-    m_reserve++;
-    m_free++;
+    queue_entry entry;
+    for (std::size_t i = 0; i < AMOUNT_SPIN_ITERATIONS; i++) {
+        if (pop_entry(entry)) {
+            p_task = std::move(entry.m_task);
+            return;
+        }
 
-    while(m_queue.empty() && !m_stop) {
-        m_queue_not_empty_cond.wait(lock_common, [this]{ return !m_queue.empty() || m_stop; });
+        std::this_thread::yield();
     }
 
-    if (!m_queue.empty()) {
-        p_task = m_queue.front();
-        m_queue.pop_front();
+    std::unique_lock<std::mutex> lock(m_sleep_mutex);
+    m_sleeping.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
 
-        if (m_reserve == m_free)
-            m_reserve--;
+    while (!pop_entry(entry)) {
+        if (m_stop) {
+            m_sleeping.fetch_sub(1);
+            return;
+        }
 
-        m_free--;
+        m_queue_not_empty_cond.wait(lock);
     }
+
+    m_sleeping.fetch_sub(1);
+    p_task = std::move(entry.m_task);
 }
 
 
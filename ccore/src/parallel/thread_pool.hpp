@@ -22,9 +22,12 @@
 #pragma once
 
 
+#include <atomic>
 #include <deque>
 #include <vector>
 
+#include "mpmc_queue.hpp"
+#include "spinlock.hpp"
 #include "thread_executor.hpp"
 
 
@@ -33,6 +36,15 @@ namespace ccore {
 namespace parallel {
 
 
+/**
+ *
+ * @brief   Pool of threads that execute tasks from the bounded lock-free queue.
+ * @details Idle thread spins for a short time checking the queue and then blocks until a task is added, therefore
+ *           fine-grained tasks are taken without blocking and idle threads do not occupy cores. Tasks that do not
+ *           fit to the full queue are placed to the overflow queue, therefore adding a task never waits for threads
+ *           of the pool (that can be the ones that add tasks).
+ *
+ */
 class thread_pool {
 public:
     using ptr              = std::shared_ptr<thread_pool>;
@@ -40,21 +52,40 @@ public:
 private:
     using thread_container = std::vector<thread_executor::ptr>;
 
+    struct queue_entry {
+        task::ptr   m_task      = nullptr;
+        bool        m_reserved  = false;    /* task has been added by 'add_task_if_free' that has reserved a thread */
+    };
+
 public:
     static const std::size_t        DEFAULT_POOL_SIZE;
 
+    /**
+     *
+     * @brief   Maximum amount of tasks in the lock-free queue, the rest tasks are placed to the overflow queue.
+     *
+     */
+    static const std::size_t        QUEUE_CAPACITY;
+
+private:
+    /* amount of attempts to take a task before idle thread is blocked */
+    static const std::size_t        AMOUNT_SPIN_ITERATIONS;
+
 private:
     thread_container                m_pool  = { };
 
-    std::deque<task::ptr>           m_queue = { };
+    mpmc_queue<queue_entry>         m_queue;
 
-    mutable std::mutex              m_common_mutex;
+    spinlock                        m_overflow_lock;
+    std::deque<queue_entry>         m_overflow          = { };
+    std::atomic<std::size_t>        m_overflow_size     = { 0 };
 
+    std::mutex                      m_sleep_mutex;
     std::condition_variable         m_queue_not_empty_cond;
 
-    std::size_t                     m_free = 0;
-    std::size_t                     m_reserve = 0;
-    bool                            m_stop = false;
+    std::atomic<std::size_t>        m_sleeping  = { 0 };
+    std::atomic<std::size_t>        m_reserve   = { 0 };
+    std::atomic<bool>               m_stop      = { false };
 
 public:
     thread_pool(void);
@@ -77,6 +108,10 @@ public:
 private:
     void initialize(const std::size_t p_size);
 
+    void push_entry(queue_entry & p_entry);
+
+    bool pop_entry(queue_entry & p_entry);
+
     void get_task(task::ptr & p_task);
 };
 
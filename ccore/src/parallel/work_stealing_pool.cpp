@@ -0,0 +1,315 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "work_stealing_pool.hpp"
+
+#include <string>
+
+#include "utils/trace.hpp"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+namespace {
+
+
+/* pool and index of queue of the current thread if it is a worker */
+thread_local work_stealing_pool *   CURRENT_POOL        = nullptr;
+thread_local std::size_t            CURRENT_WORKER      = 0;
+
+
+/* instance is read by atomic operations, the mutex serializes its creation and replacement */
+std::mutex                                  INSTANCE_MUTEX;
+std::shared_ptr<work_stealing_pool>         INSTANCE            = nullptr;
+
+
+}
+
+
+const std::size_t work_stealing_pool::DEFAULT_POOL_SIZE =
+        (std::thread::hardware_concurrency() > 1) ? std::thread::hardware_concurrency() - 1 : 0;
+
+const std::size_t work_stealing_pool::WAIT_SPIN_ROUNDS = 256;
+
+
+void work_stealing_pool::task_group::run(const task & p_task) {
+    try {
+        p_task();
+    }
+    catch (...) {
+        store_exception();
+    }
+}
+
+
+void work_stealing_pool::task_group::store_exception(void) {
+    std::lock_guard<spinlock> guard(m_exception_lock);
+    if (!m_exception) {
+        m_exception = std::current_exception();
+    }
+}
+
+
+void work_stealing_pool::task_group::complete_task(void) {
+    std::size_t pending = m_pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (m_pending.compare_exchange_weak(pending, pending - 1, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    /* waiting thread takes the mutex before the group is destroyed, therefore the group is alive until it is released */
+    std::lock_guard<std::mutex> guard(m_done_mutex);
+    if (m_pending.fetch_sub(1, std::memory_order_release) == 1) {
+        m_done_cond.notify_all();
+    }
+}
+
+
+work_stealing_pool::work_stealing_pool(const std::size_t p_size, const std::vector<std::size_t> & p_affinity) :
+    m_affinity(p_affinity)
+{
+    for (std::size_t i = 0; i < p_size + 1; i++) {
+        m_queues.emplace_back(new task_queue());
+    }
+
+    for (std::size_t i = 0; i < p_size; i++) {
+        m_workers.emplace_back(&work_stealing_pool::run_worker, this, i);
+    }
+}
+
+
+work_stealing_pool::~work_stealing_pool(void) {
+    {
+        std::lock_guard<std::mutex> guard(m_sleep_mutex);
+        m_stop = true;
+    }
+
+    m_sleep_cond.notify_all();
+
+    for (auto & worker : m_workers) {
+        worker.join();
+    }
+}
+
+
+std::shared_ptr<work_stealing_pool> work_stealing_pool::get_instance(void) {
+    std::shared_ptr<work_stealing_pool> pool = std::atomic_load(&INSTANCE);
+    if (pool) {
+        return pool;
+    }
+
+    std::lock_guard<std::mutex> guard(INSTANCE_MUTEX);
+    pool = std::atomic_load(&INSTANCE);
+    if (!pool) {
+        pool = std::make_shared<work_stealing_pool>(DEFAULT_POOL_SIZE);
+        std::atomic_store(&INSTANCE, pool);
+    }
+
+    return pool;
+}
+
+
+void work_stealing_pool::reset_instance(const std::size_t p_size, const std::vector<std::size_t> & p_affinity) {
+    std::lock_guard<std::mutex> guard(INSTANCE_MUTEX);
+
+    /* if the previous pool is not used then its workers are stopped before the new ones are created */
+    std::atomic_store(&INSTANCE, std::shared_ptr<work_stealing_pool>(nullptr));
+    std::atomic_store(&INSTANCE, std::make_shared<work_stealing_pool>(p_size, p_affinity));
+}
+
+
+bool work_stealing_pool::is_cpu_supported(const std::size_t p_cpu) {
+#if defined(__linux__)
+    return p_cpu < CPU_SETSIZE;
+#else
+    return p_cpu < std::thread::hardware_concurrency();
+#endif
+}
+
+
+std::size_t work_stealing_pool::size(void) const {
+    return m_workers.size();
+}
+
+
+const std::vector<std::size_t> & work_stealing_pool::get_affinity(void) const {
+    return m_affinity;
+}
+
+
+void work_stealing_pool::submit(task_group & p_group, task && p_task) {
+    p_group.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t index_queue = (CURRENT_POOL == this) ? CURRENT_WORKER : m_workers.size();
+    task_queue & queue = *m_queues[index_queue];
+    {
+        std::lock_guard<spinlock> guard(queue.m_lock);
+        queue.m_tasks.push_back({ std::move(p_task), &p_group });
+    }
+
+    m_queued.fetch_add(1);
+
+    /* the mutex guarantees that a worker that has not found tasks is already waiting for the notification */
+    if (m_sleeping.load() > 0) {
+        { std::lock_guard<std::mutex> guard(m_sleep_mutex); }
+        m_sleep_cond.notify_one();
+    }
+}
+
+
+void work_stealing_pool::wait(task_group & p_group) {
+    std::size_t idle_rounds = 0;
+    while (p_group.m_pending.load(std::memory_order_acquire) > 0) {
+        if (execute_pending_task()) {
+            idle_rounds = 0;
+        }
+        else if (idle_rounds < WAIT_SPIN_ROUNDS) {
+            idle_rounds++;
+            std::this_thread::yield();
+        }
+        else {
+            /* remaining tasks are executed by other threads, the last of them wakes the current thread up */
+            std::unique_lock<std::mutex> lock(p_group.m_done_mutex);
+            p_group.m_done_cond.wait(lock, [&p_group]() { return p_group.m_pending.load(std::memory_order_acquire) == 0; });
+        }
+    }
+
+    /* the last task may still hold the mutex after the counter is decreased */
+    { std::lock_guard<std::mutex> guard(p_group.m_done_mutex); }
+
+    if (p_group.m_exception) {
+        std::exception_ptr exception = p_group.m_exception;
+        p_group.m_exception = nullptr;
+
+        std::rethrow_exception(exception);
+    }
+}
+
+
+void work_stealing_pool::run_worker(const std::size_t p_index) {
+    CURRENT_POOL = this;
+    CURRENT_WORKER = p_index;
+
+    bind_worker();
+    utils::trace::tracer::set_thread_name("worker " + std::to_string(p_index));
+
+    while (true) {
+        if (execute_pending_task()) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+
+        m_sleeping.fetch_add(1);
+        m_sleep_cond.wait(lock, [this]() { return m_stop || (m_queued.load() > 0); });
+        m_sleeping.fetch_sub(1);
+
+        if (m_stop && (m_queued.load() == 0)) {
+            return;
+        }
+    }
+}
+
+
+void work_stealing_pool::bind_worker(void) const {
+    if (m_affinity.empty()) {
+        return;
+    }
+
+#if defined(__linux__)
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (const std::size_t cpu : m_affinity) {
+        CPU_SET(cpu, &cpus);
+    }
+
+    /* binding is an optimization: if CPUs are not available (for example, due to cgroup) the worker is not bound */
+    sched_setaffinity(0, sizeof(cpu_set_t), &cpus);
+#endif
+}
+
+
+bool work_stealing_pool::execute_pending_task(void) {
+    if (m_queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+
+    const std::size_t amount_queues = m_queues.size();
+    const bool is_worker = (CURRENT_POOL == this);
+
+    /* own tasks are taken from the back (the most recent ones), tasks of other queues are stolen from the front */
+    const std::size_t index_own = is_worker ? CURRENT_WORKER : m_workers.size();
+
+    task_entry entry;
+    bool found = pop_task(*m_queues[index_own], is_worker, entry);
+
+    for (std::size_t i = 1; (i < amount_queues) && !found; i++) {
+        found = pop_task(*m_queues[(index_own + i) % amount_queues], false, entry);
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    m_queued.fetch_sub(1);
+
+    task_group & group = *entry.m_group;
+    {
+        utils::trace::trace_scope trace("pool task", "pool");
+        group.run(entry.m_task);
+        entry.m_task = nullptr;
+    }
+
+    /* the group may be destroyed by waiting thread right after the task is completed */
+    group.complete_task();
+    return true;
+}
+
+
+bool work_stealing_pool::pop_task(task_queue & p_queue, const bool p_back, task_entry & p_entry) {
+    std::lock_guard<spinlock> guard(p_queue.m_lock);
+    if (p_queue.m_tasks.empty()) {
+        return false;
+    }
+
+    if (p_back) {
+        p_entry = std::move(p_queue.m_tasks.back());
+        p_queue.m_tasks.pop_back();
+    }
+    else {
+        p_entry = std::move(p_queue.m_tasks.front());
+        p_queue.m_tasks.pop_front();
+    }
+
+    return true;
+}
+
+
+}
+
+}
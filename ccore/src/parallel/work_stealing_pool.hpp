@@ -0,0 +1,230 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "spinlock.hpp"
+#include "task_function.hpp"
+
+
+namespace ccore {
+
+namespace parallel {
+
+
+/**
+ *
+ * @brief   Persistent pool of worker threads with work stealing that is used by parallel loops.
+ * @details Each worker has its own deque of tasks: the worker pushes and pops tasks at the back of its deque, other
+ *           workers steal tasks from the front. Tasks that are submitted by threads that are not workers of the pool
+ *           are placed to the shared queue. Thread that waits for a group of tasks executes pending tasks instead of
+ *           blocking, therefore nested parallel loops (parallel loop inside a task of another parallel loop) are
+ *           executed by all workers and never deadlock.
+ *
+ */
+class work_stealing_pool {
+public:
+    using task = task_function;     /* small callables are stored without dynamic memory allocation */
+
+    /**
+     *
+     * @brief   Group of tasks that is used to wait for completion of the tasks that belong to it.
+     * @details The first exception that is thrown by a task of the group is stored and rethrown by 'wait'.
+     *
+     */
+    class task_group {
+    private:
+        friend work_stealing_pool;
+
+    private:
+        std::atomic<std::size_t>    m_pending     = { 0 };
+        std::exception_ptr          m_exception   = nullptr;
+        spinlock                    m_exception_lock;
+
+        std::mutex                  m_done_mutex;   /* the last task is completed under the mutex */
+        std::condition_variable     m_done_cond;
+
+    public:
+        task_group(void) = default;
+
+        task_group(const task_group & p_other) = delete;
+
+        task_group(task_group && p_other) = delete;
+
+        ~task_group(void) = default;
+
+    public:
+        /**
+         *
+         * @brief   Executes task in the current thread, exception of the task is stored in the group.
+         *
+         */
+        void run(const task & p_task);
+
+    private:
+        void store_exception(void);
+
+        void complete_task(void);
+    };
+
+private:
+    struct task_entry {
+        task            m_task;
+        task_group *    m_group = nullptr;
+    };
+
+    /* queues are allocated separately to avoid false sharing between workers */
+    struct task_queue {
+        spinlock                m_lock;
+        std::deque<task_entry>  m_tasks;
+    };
+
+private:
+    std::vector<std::unique_ptr<task_queue>>    m_queues;       /* queue of each worker and the shared queue at the end */
+    std::vector<std::thread>                    m_workers;
+    std::vector<std::size_t>                    m_affinity;
+
+    std::atomic<std::size_t>    m_queued      = { 0 };
+    std::atomic<std::size_t>    m_sleeping    = { 0 };
+    bool                        m_stop        = false;
+
+    std::mutex                  m_sleep_mutex;
+    std::condition_variable     m_sleep_cond;
+
+public:
+    /**
+     *
+     * @brief   Default amount of workers: all hardware threads except one that is occupied by a caller.
+     *
+     */
+    static const std::size_t DEFAULT_POOL_SIZE;
+
+private:
+    static const std::size_t WAIT_SPIN_ROUNDS;
+
+public:
+    /**
+     *
+     * @brief   Creates pool and starts workers.
+     *
+     * @param[in] p_size: amount of workers, if it is 0 then tasks are executed by threads that wait for them.
+     * @param[in] p_affinity: CPUs that workers are bound to, if it is empty then workers are not bound.
+     *
+     */
+    explicit work_stealing_pool(const std::size_t p_size, const std::vector<std::size_t> & p_affinity = { });
+
+    work_stealing_pool(const work_stealing_pool & p_other) = delete;
+
+    work_stealing_pool(work_stealing_pool && p_other) = delete;
+
+    ~work_stealing_pool(void);
+
+public:
+    /**
+     *
+     * @brief   Returns pool that is shared by all parallel loops of the library.
+     * @details Caller owns the returned pool together with the library, therefore the pool stays valid even if it is
+     *           replaced by 'reset_instance' meanwhile.
+     *
+     */
+    static std::shared_ptr<work_stealing_pool> get_instance(void);
+
+    /**
+     *
+     * @brief   Replaces pool that is shared by all parallel loops.
+     * @details Parallel loops that are executed by the previous pool are completed by it, the previous pool is
+     *           destroyed when the last of them is finished.
+     *
+     * @param[in] p_size: amount of workers of the new pool.
+     * @param[in] p_affinity: CPUs that workers of the new pool are bound to.
+     *
+     */
+    static void reset_instance(const std::size_t p_size, const std::vector<std::size_t> & p_affinity);
+
+    /**
+     *
+     * @brief   Returns 'true' if thread can be bound to the CPU on the current system.
+     *
+     */
+    static bool is_cpu_supported(const std::size_t p_cpu);
+
+public:
+    /**
+     *
+     * @brief   Returns amount of workers.
+     *
+     */
+    std::size_t size(void) const;
+
+    /**
+     *
+     * @brief   Returns CPUs that workers are bound to.
+     *
+     */
+    const std::vector<std::size_t> & get_affinity(void) const;
+
+    /**
+     *
+     * @brief   Places task to the pool, the task should be waited using the group.
+     *
+     * @param[in] p_group: group that the task belongs to, it should live until 'wait' is returned.
+     * @param[in] p_task: task that should be executed.
+     *
+     */
+    void submit(task_group & p_group, task && p_task);
+
+    /**
+     *
+     * @brief   Waits for all tasks of the group, the current thread executes pending tasks of the pool meanwhile.
+     * @details If there are no pending tasks then the thread yields for limited amount of rounds and after that it
+     *           sleeps until the last task of the group is completed by another thread.
+     *
+     * @param[in] p_group: group of tasks that should be completed.
+     *
+     * @throw   Rethrows the first exception that has been thrown by a task of the group.
+     *
+     */
+    void wait(task_group & p_group);
+
+private:
+    void run_worker(const std::size_t p_index);
+
+    void bind_worker(void) const;
+
+    bool execute_pending_task(void);
+
+    bool pop_task(task_queue & p_queue, const bool p_back, task_entry & p_entry);
+};
+
+
+}
+
+}
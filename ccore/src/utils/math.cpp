@@ -21,6 +21,9 @@
 
 #include "math.hpp"
 
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
 
 namespace ccore {
@@ -36,6 +39,41 @@ double heaviside(const double value) {
 }
 
 
+std::vector<double> cholesky_decomposition(const std::vector<double> & p_matrix, const std::size_t p_dimension) {
+    if (p_matrix.size() != p_dimension * p_dimension) {
+        throw std::invalid_argument("Matrix with '" + std::to_string(p_matrix.size()) + "' elements is not square matrix of dimension '" 
+            + std::to_string(p_dimension) + "'.");
+    }
+
+    std::vector<double> lower(p_matrix.size(), 0.0);
+    for (std::size_t row = 0; row < p_dimension; row++) {
+        for (std::size_t column = 0; column <= row; column++) {
+            if (std::abs(p_matrix[row * p_dimension + column] - p_matrix[column * p_dimension + row]) > 1e-9 * (1.0 + std::abs(p_matrix[row * p_dimension + column]))) {
+                throw std::invalid_argument("Matrix is not symmetric.");
+            }
+
+            double value = p_matrix[row * p_dimension + column];
+            for (std::size_t k = 0; k < column; k++) {
+                value -= lower[row * p_dimension + k] * lower[column * p_dimension + k];
+            }
+
+            if (row == column) {
+                if (value <= 0.0) {
+                    throw std::invalid_argument("Matrix is not positive-definite.");
+                }
+
+                lower[row * p_dimension + column] = std::sqrt(value);
+            }
+            else {
+                lower[row * p_dimension + column] = value / lower[column * p_dimension + column];
+            }
+        }
+    }
+
+    return lower;
+}
+
+
 }
 
 }
@@ -21,6 +21,10 @@
 #pragma once
 
 
+#include <cstddef>
+#include <vector>
+
+
 namespace ccore {
 
 namespace utils {
@@ -65,6 +69,22 @@ TypeValue absolute_difference(const TypeValue & p_value1, const TypeValue & p_va
 }
 
 
+/**
+ *
+ * @brief   Calculates Cholesky decomposition A = L * L^T of symmetric positive-definite matrix.
+ *
+ * @param[in] p_matrix: square matrix A that is stored row by row.
+ * @param[in] p_dimension: amount of rows (and columns) of the matrix.
+ *
+ * @return  Returns lower triangular matrix L that is stored row by row (elements above diagonal are zero).
+ *
+ * @throw   std::invalid_argument if size of the matrix is not equal to square of dimension, or if matrix
+ *           is not symmetric positive-definite.
+ *
+ */
+std::vector<double> cholesky_decomposition(const std::vector<double> & p_matrix, const std::size_t p_dimension);
+
+
 }
 
 }
@@ -0,0 +1,375 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "utils/memory.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace memory {
+
+
+namespace {
+
+
+/* sizes of the most common elements of structures */
+const std::size_t VECTOR_SIZE           = sizeof(std::vector<double>);
+const std::size_t VALUE_SIZE            = sizeof(double);
+const std::size_t INDEX_SIZE            = sizeof(std::size_t);
+
+/* approximate sizes of a node of k-d tree (including control block of smart pointer) and of an oscillator */
+const std::size_t KDNODE_SIZE           = 128;
+const std::size_t OSCILLATOR_SIZE       = 8 * sizeof(double);
+
+/* networks use bit matrix for connections if amount of oscillators is bigger than this value */
+const std::size_t MAXIMUM_MATRIX_REPRESENTATION_SIZE = 4096;
+
+
+using estimator = std::function<std::size_t(const std::vector<double> &, const std::size_t, const std::size_t)>;
+
+
+std::size_t get_parameter(const std::vector<double> & p_parameters, const std::size_t p_index, const std::size_t p_default) {
+    if ((p_index < p_parameters.size()) && (p_parameters[p_index] > 0.0)) {
+        return static_cast<std::size_t>(p_parameters[p_index]);
+    }
+
+    return p_default;
+}
+
+
+std::size_t points(const std::size_t p_size, const std::size_t p_dimension) {
+    return p_size * (VECTOR_SIZE + p_dimension * VALUE_SIZE);
+}
+
+
+std::size_t dense_points(const std::size_t p_size, const std::size_t p_dimension) {
+    return p_size * p_dimension * VALUE_SIZE;
+}
+
+
+std::size_t clusters(const std::size_t p_size, const std::size_t p_amount_clusters) {
+    return p_size * INDEX_SIZE + p_amount_clusters * VECTOR_SIZE;
+}
+
+
+std::size_t matrix(const std::size_t p_size) {
+    return p_size * (VECTOR_SIZE + p_size * VALUE_SIZE);
+}
+
+
+std::size_t network_connections(const std::size_t p_size) {
+    if (p_size > MAXIMUM_MATRIX_REPRESENTATION_SIZE) {
+        const std::size_t element_bit_length = (sizeof(std::size_t) << 3);
+        return p_size * (VECTOR_SIZE + (p_size + element_bit_length - 1) / element_bit_length * INDEX_SIZE);
+    }
+
+    return matrix(p_size);
+}
+
+
+std::size_t network_dynamic(const std::size_t p_steps, const std::size_t p_size) {
+    return p_steps * (VECTOR_SIZE + VALUE_SIZE + p_size * VALUE_SIZE);
+}
+
+
+std::size_t estimate_centroid(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t amount_clusters = get_parameter(p_parameters, 0, 1);
+
+    /* input, dense copy, current and previous centers, labels and clusters */
+    return points(p_size, p_dimension) + dense_points(p_size, p_dimension) + 2 * points(amount_clusters, p_dimension) +
+        p_size * INDEX_SIZE + clusters(p_size, amount_clusters);
+}
+
+
+std::size_t estimate_xmeans(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t maximum_clusters = get_parameter(p_parameters, 0, 20);
+
+    /* k-means of parents in addition, local copies of objects of parent clusters are used for their splitting */
+    return estimate_centroid({ static_cast<double>(maximum_clusters) }, p_size, p_dimension) + points(p_size, p_dimension) +
+        clusters(p_size, maximum_clusters);
+}
+
+
+std::size_t estimate_density(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t amount_neighbors = get_parameter(p_parameters, 0, 10);
+
+    /* input, dense copy, k-d tree, objects of expanded cluster, neighbors of one object, clusters and noise */
+    return points(p_size, p_dimension) + dense_points(p_size, p_dimension) + p_size * KDNODE_SIZE +
+        p_size * INDEX_SIZE + amount_neighbors * INDEX_SIZE + clusters(p_size, p_size);
+}
+
+
+std::size_t estimate_optics(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t amount_neighbors = get_parameter(p_parameters, 0, 10);
+
+    /* optics descriptors, ordered objects and distances to neighbors of one object in addition */
+    return estimate_density(p_parameters, p_size, p_dimension) + p_size * (2 * VALUE_SIZE + 2 * INDEX_SIZE) + p_size * INDEX_SIZE +
+        amount_neighbors * VALUE_SIZE;
+}
+
+
+std::size_t estimate_agglomerative(const std::vector<double> &, const std::size_t p_size, const std::size_t p_dimension) {
+    /* input, centers of clusters, clusters */
+    return 2 * points(p_size, p_dimension) + clusters(p_size, p_size);
+}
+
+
+std::size_t estimate_cure(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t amount_clusters = get_parameter(p_parameters, 0, 1);
+    const std::size_t amount_representatives = get_parameter(p_parameters, 1, 5);
+
+    /* each object is a cluster initially with its own mean and representative that are stored by k-d tree */
+    return points(p_size, p_dimension) + 2 * points(p_size, p_dimension) + p_size * (3 * VECTOR_SIZE + KDNODE_SIZE) +
+        points(amount_clusters * amount_representatives, p_dimension) + clusters(p_size, amount_clusters);
+}
+
+
+std::size_t estimate_rock(const std::vector<double> &, const std::size_t p_size, const std::size_t p_dimension) {
+    return points(p_size, p_dimension) + matrix(p_size) + clusters(p_size, p_size);
+}
+
+
+std::size_t estimate_oscillatory(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t) {
+    const std::size_t steps = get_parameter(p_parameters, 0, 1);
+    return network_connections(p_size) + p_size * OSCILLATOR_SIZE + network_dynamic(steps, p_size);
+}
+
+
+std::size_t estimate_legion(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    /* dynamic connections are always represented by matrix */
+    return estimate_oscillatory(p_parameters, p_size, p_dimension) + matrix(p_size);
+}
+
+
+std::size_t estimate_syncnet(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const bool connection_weights = (get_parameter(p_parameters, 0, 0) > 0);
+    const std::size_t steps = get_parameter(p_parameters, 1, 1);
+
+    /* input, its copy that is used as locations of oscillators, network, optional weights, ensembles */
+    std::size_t result = 2 * points(p_size, p_dimension) + network_connections(p_size) + p_size * OSCILLATOR_SIZE +
+        network_dynamic(steps, p_size) + clusters(p_size, p_size);
+
+    if (connection_weights) {
+        result += matrix(p_size);
+    }
+
+    return result;
+}
+
+
+std::size_t estimate_hsyncnet(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t steps = get_parameter(p_parameters, 1, 1);
+
+    /* hierarchical network does not use connection weights, k-d tree is used to find neighbors */
+    return estimate_syncnet({ 0.0, static_cast<double>(steps) }, p_size, p_dimension) + p_size * KDNODE_SIZE;
+}
+
+
+std::size_t estimate_som(const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const std::size_t rows = get_parameter(p_parameters, 0, 1);
+    const std::size_t columns = get_parameter(p_parameters, 1, 1);
+    const std::size_t neurons = rows * columns;
+
+    /* input, current and previous weights, locations of neurons, distances between them, captured objects, neighbors */
+    return points(p_size, p_dimension) + 2 * points(neurons, p_dimension) + points(neurons, 2) + matrix(neurons) +
+        clusters(p_size, neurons) + neurons * (VECTOR_SIZE + 8 * INDEX_SIZE);
+}
+
+
+const std::unordered_map<std::string, estimator> & get_estimators(void) {
+    static const std::unordered_map<std::string, estimator> ESTIMATORS = {
+        { "agglomerative",  estimate_agglomerative },
+        { "cure",           estimate_cure },
+        { "dbscan",         estimate_density },
+        { "hsyncnet",       estimate_hsyncnet },
+        { "kmeans",         estimate_centroid },
+        { "kmedoids",       estimate_centroid },
+        { "legion",         estimate_legion },
+        { "optics",         estimate_optics },
+        { "pcnn",           estimate_oscillatory },
+        { "rock",           estimate_rock },
+        { "som",            estimate_som },
+        { "sync",           estimate_oscillatory },
+        { "syncnet",        estimate_syncnet },
+        { "xmeans",         estimate_xmeans }
+    };
+
+    return ESTIMATORS;
+}
+
+
+}
+
+
+std::atomic<std::size_t> memory_usage::m_current(0);
+
+std::atomic<std::size_t> memory_usage::m_peak(0);
+
+std::mutex memory_usage::m_trackers_lock;
+
+std::vector<memory_peak_tracker *> memory_usage::m_trackers;
+
+std::atomic<std::size_t> memory_usage::m_amount_trackers(0);
+
+
+void memory_usage::allocate(const std::size_t p_bytes) {
+    const std::size_t current = m_current.fetch_add(p_bytes) + p_bytes;
+
+    std::size_t peak = m_peak.load();
+    while ((current > peak) && !m_peak.compare_exchange_weak(peak, current)) { }
+
+    /* trackers exist only while statistics are collected, otherwise the lock is not taken */
+    if (m_amount_trackers.load() > 0) {
+        std::lock_guard<std::mutex> guard(m_trackers_lock);
+        for (memory_peak_tracker * tracker : m_trackers) {
+            tracker->update(current);
+        }
+    }
+}
+
+
+void memory_usage::release(const std::size_t p_bytes) {
+    m_current.fetch_sub(p_bytes);
+}
+
+
+std::size_t memory_usage::get_current(void) {
+    return m_current.load();
+}
+
+
+std::size_t memory_usage::get_peak(void) {
+    return m_peak.load();
+}
+
+
+memory_peak_tracker::memory_peak_tracker(void) {
+    std::lock_guard<std::mutex> guard(memory_usage::m_trackers_lock);
+
+    m_peak.store(memory_usage::get_current());
+    memory_usage::m_trackers.push_back(this);
+    memory_usage::m_amount_trackers.fetch_add(1);
+}
+
+
+memory_peak_tracker::~memory_peak_tracker(void) {
+    std::lock_guard<std::mutex> guard(memory_usage::m_trackers_lock);
+
+    auto & trackers = memory_usage::m_trackers;
+    trackers.erase(std::find(trackers.begin(), trackers.end(), this));
+    memory_usage::m_amount_trackers.fetch_sub(1);
+}
+
+
+std::size_t memory_peak_tracker::get_peak(void) const {
+    return m_peak.load();
+}
+
+
+void memory_peak_tracker::update(const std::size_t p_current) {
+    std::size_t peak = m_peak.load();
+    while ((p_current > peak) && !m_peak.compare_exchange_weak(peak, p_current)) { }
+}
+
+
+memory_reservation::memory_reservation(const std::size_t p_bytes) {
+    reset(p_bytes);
+}
+
+
+memory_reservation::memory_reservation(const memory_reservation & p_other) {
+    reset(p_other.m_bytes);
+}
+
+
+memory_reservation::memory_reservation(memory_reservation && p_other) noexcept :
+    m_bytes(p_other.m_bytes)
+{
+    p_other.m_bytes = 0;
+}
+
+
+memory_reservation::~memory_reservation(void) {
+    reset(0);
+}
+
+
+void memory_reservation::reset(const std::size_t p_bytes) {
+    if (p_bytes > m_bytes) {
+        memory_usage::allocate(p_bytes - m_bytes);
+    }
+    else if (p_bytes < m_bytes) {
+        memory_usage::release(m_bytes - p_bytes);
+    }
+
+    m_bytes = p_bytes;
+}
+
+
+std::size_t memory_reservation::get_bytes(void) const {
+    return m_bytes;
+}
+
+
+memory_reservation & memory_reservation::operator=(const memory_reservation & p_other) {
+    if (this != &p_other) {
+        reset(p_other.m_bytes);
+    }
+
+    return *this;
+}
+
+
+memory_reservation & memory_reservation::operator=(memory_reservation && p_other) noexcept {
+    if (this != &p_other) {
+        reset(0);
+
+        m_bytes = p_other.m_bytes;
+        p_other.m_bytes = 0;
+    }
+
+    return *this;
+}
+
+
+std::size_t estimate_memory(const std::string & p_algorithm, const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension) {
+    const auto & estimators = get_estimators();
+
+    const auto iterator = estimators.find(p_algorithm);
+    if (iterator == estimators.cend()) {
+        throw std::invalid_argument("CCORE [memory]: memory estimation is not supported for algorithm '" + p_algorithm + "'.");
+    }
+
+    return iterator->second(p_parameters, p_size, p_dimension);
+}
+
+
+}
+
+}
+
+}
@@ -0,0 +1,187 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#pragma once
+
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace memory {
+
+
+/**
+ *
+ * @brief   Process-wide accounting of memory that is used by the largest containers of the library.
+ * @details Only containers whose size grows faster than input data are tracked: adjacency matrices, dense datasets,
+ *           matrices of distances and connection weights of networks, output dynamics. Values are approximate
+ *           because allocator overhead is not taken into account.
+ *
+ */
+class memory_peak_tracker;
+
+
+class memory_usage {
+private:
+    friend memory_peak_tracker;
+
+private:
+    static std::atomic<std::size_t>     m_current;
+    static std::atomic<std::size_t>     m_peak;
+
+    static std::mutex                           m_trackers_lock;
+    static std::vector<memory_peak_tracker *>   m_trackers;
+    static std::atomic<std::size_t>             m_amount_trackers;
+
+public:
+    static void allocate(const std::size_t p_bytes);
+
+    static void release(const std::size_t p_bytes);
+
+    /**
+     *
+     * @brief   Returns amount of bytes that are tracked at the moment.
+     *
+     */
+    static std::size_t get_current(void);
+
+    /**
+     *
+     * @brief   Returns maximum amount of bytes that has been tracked since the start of the process.
+     * @details Peak of a part of the process (for example, an algorithm call) is measured by 'memory_peak_tracker'.
+     *
+     */
+    static std::size_t get_peak(void);
+};
+
+
+/**
+ *
+ * @brief   Maximum amount of tracked memory since creation of the tracker.
+ * @details Tracker is updated by each allocation while it exists, therefore trackers of calls that are executed at the
+ *           same time measure their peaks independently. Memory is tracked for the whole process, thus the peak
+ *           includes containers that were allocated before the tracker and containers of other threads.
+ *
+ */
+class memory_peak_tracker {
+private:
+    friend memory_usage;
+
+private:
+    std::atomic<std::size_t>    m_peak = { 0 };
+
+public:
+    memory_peak_tracker(void);
+
+    memory_peak_tracker(const memory_peak_tracker & p_other) = delete;
+
+    memory_peak_tracker(memory_peak_tracker && p_other) = delete;
+
+    ~memory_peak_tracker(void);
+
+public:
+    std::size_t get_peak(void) const;
+
+private:
+    void update(const std::size_t p_current);
+};
+
+
+/**
+ *
+ * @brief   Amount of memory that is owned by a container and reported to 'memory_usage'.
+ * @details Reservation is a member of a tracked container: copy reserves the same amount again, move transfers it,
+ *           destructor releases it.
+ *
+ */
+class memory_reservation {
+private:
+    std::size_t m_bytes = 0;
+
+public:
+    memory_reservation(void) = default;
+
+    explicit memory_reservation(const std::size_t p_bytes);
+
+    memory_reservation(const memory_reservation & p_other);
+
+    memory_reservation(memory_reservation && p_other) noexcept;
+
+    ~memory_reservation(void);
+
+public:
+    /**
+     *
+     * @brief   Replaces amount of reserved memory.
+     *
+     */
+    void reset(const std::size_t p_bytes);
+
+    std::size_t get_bytes(void) const;
+
+public:
+    memory_reservation & operator=(const memory_reservation & p_other);
+
+    memory_reservation & operator=(memory_reservation && p_other) noexcept;
+};
+
+
+/**
+ *
+ * @brief   Estimates amount of memory in bytes that is required by an algorithm to process data.
+ * @details Estimation includes input data, the largest internal structures and the result. Parameters that are not
+ *           specified have default values. Supported algorithms and their parameters:
+ *           - "agglomerative": no parameters;
+ *           - "cure": [amount of clusters, amount of representatives];
+ *           - "dbscan": [average amount of neighbors in connectivity radius];
+ *           - "hsyncnet": [amount of clusters, amount of stored steps of dynamic];
+ *           - "kmeans", "kmedoids": [amount of clusters];
+ *           - "legion", "pcnn", "sync": [amount of stored steps of dynamic], dimension is ignored;
+ *           - "optics": [average amount of neighbors in connectivity radius];
+ *           - "rock": no parameters;
+ *           - "som": [rows, columns];
+ *           - "syncnet": [connection weights (0 or 1), amount of stored steps of dynamic];
+ *           - "xmeans": [maximum amount of clusters].
+ *
+ * @param[in] p_algorithm: name of the algorithm.
+ * @param[in] p_parameters: parameters of the algorithm that affect required memory.
+ * @param[in] p_size: amount of points in input data or amount of oscillators in a network.
+ * @param[in] p_dimension: dimension of input data.
+ *
+ * @return  Estimated amount of bytes, 'std::invalid_argument' is thrown if algorithm is unknown.
+ *
+ */
+std::size_t estimate_memory(const std::string & p_algorithm, const std::vector<double> & p_parameters, const std::size_t p_size, const std::size_t p_dimension);
+
+
+}
+
+}
+
+}
@@ -21,7 +21,11 @@
 
 #include "metric.hpp"
 
-#include <algorithm>
+#include <numeric>
+#include <string>
+
+#include "container/kdtree.hpp"
+#include "container/pairwise_distance_matrix.hpp"
 
 
 namespace ccore {
@@ -32,28 +36,35 @@ namespace metric {
 
 
 double average_neighbor_distance(const std::vector<std::vector<double> > * points, const std::size_t num_neigh) {
-    std::vector<std::vector<double> > dist_matrix( points->size(), std::vector<double>(points->size(), 0.0) );
-    for (std::size_t i = 0; i < points->size(); i++) {
-        for (std::size_t j = i + 1; j < points->size(); j++) {
-            double distance = euclidean_distance( (*points)[i], (*points)[j] );
-            dist_matrix[i][j] = distance;
-            dist_matrix[j][i] = distance;
-        }
-
-        std::sort(dist_matrix[i].begin(), dist_matrix[i].end());
+    if (num_neigh >= points->size()) {
+        throw std::invalid_argument("Amount of neighbors '" + std::to_string(num_neigh) +
+            "' should be less than amount of points '" + std::to_string(points->size()) + "'.");
     }
 
-    double total_distance = 0.0;
-    for (std::size_t i = 0; i < points->size(); i++) {
-        for (std::size_t j = 0; j < num_neigh; j++) {
-            total_distance += dist_matrix[i][j + 1];
-        }
-    }
+    std::vector<std::size_t> neighbors;
+    std::vector<double> distances;
+    container::kdtree_searcher::find_k_nearest_neighbors(container::dense_dataset(*points), num_neigh, neighbors, distances);
+
+    const double total_distance = std::accumulate(distances.begin(), distances.end(), 0.0);
 
     return total_distance / ( (double) num_neigh * (double) points->size() );
 }
 
 
+void distance_matrix(const dataset & p_points, dataset & p_distance_matrix) {
+    using matrix_t = container::pairwise_distance_matrix<double>;
+
+    const matrix_t matrix = matrix_t::create(container::dense_dataset(p_points), distance_metric_factory<point>::euclidean(),
+        container::distance_matrix_layout::SQUARE);
+
+    p_distance_matrix.assign(p_points.size(), point());
+    for (std::size_t i = 0; i < p_points.size(); i++) {
+        const double * row = matrix.data() + i * p_points.size();
+        p_distance_matrix[i].assign(row, row + p_points.size());
+    }
+}
+
+
 }
 
 }
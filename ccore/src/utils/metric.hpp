@@ -24,11 +24,19 @@
 
 #include "definitions.hpp"
 
+#include "container/dense_dataset.hpp"
+
+#include "utils/math.hpp"
+#include "utils/metric_simd.hpp"
+
 #include <algorithm>
 #include <cmath>
 #include <exception>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 
@@ -51,18 +59,47 @@ using distance_functor = std::function<double(const TypeContainer &, const TypeC
 
 /**
  *
- * @brief   Calculates square of Euclidean distance between points.
+ * @brief   Encapsulates distance metric calculation function between two points whose coordinates are
+ *           stored contiguously in memory (used for points of 'dense_dataset').
  *
- * @param[in] point1: point #1 that is represented by coordinates.
- * @param[in] point2: point #2 that is represented by coordinates.
+ */
+using distance_kernel = std::function<double(const double *, const double *, const std::size_t)>;
+
+
+namespace details {
+
+
+/**
  *
- * @return  Returns square of Euclidean distance between points.
+ * @brief   Defines whether container stores coordinates of type 'double' contiguously, such containers
+ *           are processed by vectorized distance kernels.
  *
  */
 template <typename TypeContainer>
-double euclidean_distance_square(const TypeContainer & point1, const TypeContainer & point2) {
+struct is_contiguous_double : std::false_type { };
+
+template <>
+struct is_contiguous_double<std::vector<double>> : std::true_type { };
+
+template <>
+struct is_contiguous_double<container::point_view> : std::true_type { };
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+using is_contiguous_pair = std::integral_constant<bool, 
+    is_contiguous_double<TypeContainer>::value && is_contiguous_double<TypeOtherContainer>::value>;
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+double euclidean_distance_square(const TypeContainer & point1, const TypeOtherContainer & point2, std::true_type) {
+    return simd::euclidean_distance_square(point1.data(), point2.data(), point2.size());
+}
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+double euclidean_distance_square(const TypeContainer & point1, const TypeOtherContainer & point2, std::false_type) {
     double distance = 0.0;
-    typename TypeContainer::const_iterator iter_point1 = point1.begin();
+    auto iter_point1 = std::begin(point1);
 
     for (auto & dim_point2 : point2) {
         double difference = (*iter_point1 - dim_point2);
@@ -75,6 +112,65 @@ double euclidean_distance_square(const TypeContainer & point1, const TypeContain
 }
 
 
+template <typename TypeContainer, typename TypeOtherContainer>
+double manhattan_distance(const TypeContainer & point1, const TypeOtherContainer & point2, std::true_type) {
+    return simd::manhattan_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+double manhattan_distance(const TypeContainer & point1, const TypeOtherContainer & point2, std::false_type) {
+    double distance = 0.0;
+    auto iter_point1 = std::begin(point1);
+
+    for (auto & dim_point2 : point2) {
+        distance += std::abs(*iter_point1 - dim_point2);
+        iter_point1++;
+    }
+
+    return distance;
+}
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+double chebyshev_distance(const TypeContainer & point1, const TypeOtherContainer & point2, std::true_type) {
+    return simd::chebyshev_distance(point1.data(), point2.data(), point2.size());
+}
+
+
+template <typename TypeContainer, typename TypeOtherContainer>
+double chebyshev_distance(const TypeContainer & point1, const TypeOtherContainer & point2, std::false_type) {
+    double distance = 0.0;
+    auto iter_point1 = std::begin(point1);
+
+    for (auto & dim_point2 : point2) {
+        distance = std::max(distance, std::abs(*iter_point1 - dim_point2));
+        iter_point1++;
+    }
+
+    return distance;
+}
+
+
+}
+
+
+/**
+ *
+ * @brief   Calculates square of Euclidean distance between points.
+ *
+ * @param[in] point1: point #1 that is represented by coordinates.
+ * @param[in] point2: point #2 that is represented by coordinates.
+ *
+ * @return  Returns square of Euclidean distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double euclidean_distance_square(const TypeContainer & point1, const TypeOtherContainer & point2) {
+    return details::euclidean_distance_square(point1, point2, details::is_contiguous_pair<TypeContainer, TypeOtherContainer>());
+}
+
+
 /**
  *
  * @brief   Calculates Euclidean distance between points.
@@ -85,8 +181,8 @@ double euclidean_distance_square(const TypeContainer & point1, const TypeContain
  * @return  Returns Euclidean distance between points.
  *
  */
-template <typename TypeContainer>
-double euclidean_distance(const TypeContainer & point1, const TypeContainer & point2) {
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double euclidean_distance(const TypeContainer & point1, const TypeOtherContainer & point2) {
     return std::sqrt(euclidean_distance_square(point1, point2));
 }
 
@@ -101,37 +197,174 @@ double euclidean_distance(const TypeContainer & point1, const TypeContainer & po
  * @return  Returns Manhattan distance between points.
  *
  */
-template <typename TypeContainer>
-double manhattan_distance(const TypeContainer & point1, const TypeContainer & point2) {
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double manhattan_distance(const TypeContainer & point1, const TypeOtherContainer & point2) {
+    return details::manhattan_distance(point1, point2, details::is_contiguous_pair<TypeContainer, TypeOtherContainer>());
+}
+
+
+/**
+ *
+ * @brief   Calculates Chebyshev distance between points.
+ *
+ * @param[in] point1: point #1 that is represented by coordinates.
+ * @param[in] point2: point #2 that is represented by coordinates.
+ *
+ * @return  Returns Chebyshev distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double chebyshev_distance(const TypeContainer & point1, const TypeOtherContainer & point2) {
+    return details::chebyshev_distance(point1, point2, details::is_contiguous_pair<TypeContainer, TypeOtherContainer>());
+}
+
+
+namespace details {
+
+
+/**
+ *
+ * @brief   Maximum degree of Minkowski distance that is calculated by multiplications instead of 'std::pow'.
+ *
+ */
+const unsigned int MINKOWSKI_MAXIMUM_INTEGER_DEGREE = 32;
+
+
+/**
+ *
+ * @brief   Returns degree as integer if it is integer from 1 to MINKOWSKI_MAXIMUM_INTEGER_DEGREE, otherwise 0.
+ *
+ */
+inline unsigned int get_integer_degree(const double p_degree) {
+    if ((p_degree >= 1.0) && (p_degree <= (double) MINKOWSKI_MAXIMUM_INTEGER_DEGREE) && (std::floor(p_degree) == p_degree)) {
+        return (unsigned int) p_degree;
+    }
+
+    return 0;
+}
+
+
+/**
+ *
+ * @brief   Raises value to integer power using exponentiation by squaring.
+ *
+ */
+inline double integer_power(double p_value, unsigned int p_exponent) {
+    double result = 1.0;
+    while (p_exponent > 0) {
+        if (p_exponent & 1U) {
+            result *= p_value;
+        }
+
+        p_value *= p_value;
+        p_exponent >>= 1U;
+    }
+
+    return result;
+}
+
+
+}
+
+
+/**
+ *
+ * @brief   Calculates Minkowski distance between points.
+ * @details Integer degrees are calculated without 'std::pow' per coordinate, degrees 1 and 2 are calculated
+ *           by Manhattan and Euclidean distance kernels.
+ *
+ * @param[in] p_point1: point #1 that is represented by coordinates.
+ * @param[in] p_point2: point #2 that is represented by coordinates.
+ * @param[in] p_degree: degree of Minkownski equation.
+ *
+ * @return  Returns Minkowski distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double minkowski_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2, const double p_degree) {
+    const unsigned int integer_degree = details::get_integer_degree(p_degree);
+    if (integer_degree == 1) {
+        return manhattan_distance(p_point1, p_point2);
+    }
+    else if (integer_degree == 2) {
+        return euclidean_distance(p_point1, p_point2);
+    }
+
     double distance = 0.0;
-    typename TypeContainer::const_iterator iter_point1 = point1.begin();
+    auto iter_point1 = std::begin(p_point1);
+
+    if (integer_degree > 0) {
+        for (auto & dim_point2 : p_point2) {
+            distance += details::integer_power(std::abs(*iter_point1 - dim_point2), integer_degree);
+            iter_point1++;
+        }
+    }
+    else {
+        for (auto & dim_point2 : p_point2) {
+            distance += std::pow(std::abs(*iter_point1 - dim_point2), p_degree);
+            iter_point1++;
+        }
+    }
+
+    return std::pow(distance, 1.0 / p_degree);
+}
+
+
+/**
+ *
+ * @brief   Calculates cosine distance (one minus cosine similarity) between points.
+ * @details If one of points is zero vector then the distance is 1.0, if both of them are zero vectors
+ *           then the distance is 0.0.
+ *
+ * @param[in] p_point1: point #1 that is represented by coordinates.
+ * @param[in] p_point2: point #2 that is represented by coordinates.
+ *
+ * @return  Returns cosine distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double cosine_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2) {
+    double product = 0.0, norm1 = 0.0, norm2 = 0.0;
+    auto iter_point1 = std::begin(p_point1);
+
+    for (auto & dim_point2 : p_point2) {
+        product += *iter_point1 * dim_point2;
+        norm1 += *iter_point1 * *iter_point1;
+        norm2 += dim_point2 * dim_point2;
 
-    for (auto & dim_point2 : point2) {
-        distance += std::abs(*iter_point1 - dim_point2);
         iter_point1++;
     }
 
-    return distance;
+    if ((norm1 == 0.0) || (norm2 == 0.0)) {
+        return (norm1 == norm2) ? 0.0 : 1.0;
+    }
+
+    return 1.0 - product / std::sqrt(norm1 * norm2);
 }
 
 
 /**
  *
- * @brief   Calculates Chebyshev distance between points.
+ * @brief   Calculates Canberra distance between points.
+ * @details Coordinates where both points are zero do not contribute to the distance.
  *
- * @param[in] point1: point #1 that is represented by coordinates.
- * @param[in] point2: point #2 that is represented by coordinates.
+ * @param[in] p_point1: point #1 that is represented by coordinates.
+ * @param[in] p_point2: point #2 that is represented by coordinates.
  *
- * @return  Returns Chebyshev distance between points.
+ * @return  Returns Canberra distance between points.
  *
  */
-template <typename TypeContainer>
-double chebyshev_distance(const TypeContainer & point1, const TypeContainer & point2) {
+template <typename TypeContainer, typename TypeOtherContainer = TypeContainer>
+double canberra_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2) {
     double distance = 0.0;
-    typename TypeContainer::const_iterator iter_point1 = point1.begin();
+    auto iter_point1 = std::begin(p_point1);
+
+    for (auto & dim_point2 : p_point2) {
+        const double divider = std::abs(*iter_point1) + std::abs(dim_point2);
+        if (divider > 0.0) {
+            distance += std::abs(*iter_point1 - dim_point2) / divider;
+        }
 
-    for (auto & dim_point2 : point2) {
-        distance = std::max(distance, std::abs(*iter_point1 - dim_point2));
         iter_point1++;
     }
 
@@ -141,51 +374,175 @@ double chebyshev_distance(const TypeContainer & point1, const TypeContainer & po
 
 /**
  *
- * @brief   Calculates square of Minkowski distance between points.
+ * @brief   Calculates weighted Euclidean distance between points.
  *
  * @param[in] p_point1: point #1 that is represented by coordinates.
  * @param[in] p_point2: point #2 that is represented by coordinates.
- * @param[in] p_degree: degree of Minkownski equation.
+ * @param[in] p_weights: weight of each coordinate, size should be equal to dimension of points.
  *
- * @return  Returns square of Minkowski distance between points.
+ * @return  Returns weighted Euclidean distance between points.
  *
  */
-template <typename TypeContainer>
-double minkowski_distance(const TypeContainer & p_point1, const TypeContainer & p_point2, const double p_degree) {
+template <typename TypeContainer, typename TypeOtherContainer, typename TypeWeights>
+double weighted_euclidean_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2, const TypeWeights & p_weights) {
     double distance = 0.0;
-    typename TypeContainer::const_iterator iter_point1 = p_point1.begin();
+    auto iter_point1 = std::begin(p_point1);
+    auto iter_weight = std::begin(p_weights);
 
     for (auto & dim_point2 : p_point2) {
-        double difference = (*iter_point1 - dim_point2);
-        distance += std::pow(difference, p_degree);
+        const double difference = *iter_point1 - dim_point2;
+        distance += *iter_weight * difference * difference;
 
         iter_point1++;
+        iter_weight++;
     }
 
-    return std::pow(distance, 1.0 / p_degree);
+    return std::sqrt(distance);
 }
 
 
 /**
  *
- * @brief   Calculates distance matrix using points container.
+ * @brief   Calculates Gower distance between points with numerical coordinates.
+ * @details Difference of each coordinate is normalized by range of corresponding feature, features with
+ *           zero range do not contribute to the distance.
+ *
+ * @param[in] p_point1: point #1 that is represented by coordinates.
+ * @param[in] p_point2: point #2 that is represented by coordinates.
+ * @param[in] p_ranges: range (maximum minus minimum) of each feature, size should be equal to dimension of points.
+ *
+ * @return  Returns Gower distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer, typename TypeRanges>
+double gower_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2, const TypeRanges & p_ranges) {
+    double distance = 0.0;
+    std::size_t dimension = 0;
+
+    auto iter_point1 = std::begin(p_point1);
+    auto iter_range = std::begin(p_ranges);
+
+    for (auto & dim_point2 : p_point2) {
+        if (*iter_range > 0.0) {
+            distance += std::abs(*iter_point1 - dim_point2) / *iter_range;
+        }
+
+        iter_point1++;
+        iter_range++;
+        dimension++;
+    }
+
+    return (dimension > 0) ? distance / (double) dimension : 0.0;
+}
+
+
+/**
+ *
+ * @brief   Calculates Mahalanobis distance between points using Cholesky factor of inverse covariance matrix.
+ * @details Inverse covariance matrix S^-1 is represented as U^T * U, where U is upper triangular matrix, then
+ *           distance is norm of U * (x - y), it is calculated without allocation of temporary vectors.
+ *
+ * @param[in] p_point1: point #1 that is represented by coordinates.
+ * @param[in] p_point2: point #2 that is represented by coordinates.
+ * @param[in] p_factor: upper triangular matrix U that is stored row by row (dimension x dimension).
+ *
+ * @return  Returns Mahalanobis distance between points.
+ *
+ */
+template <typename TypeContainer, typename TypeOtherContainer, typename TypeFactor>
+double mahalanobis_distance(const TypeContainer & p_point1, const TypeOtherContainer & p_point2, const TypeFactor & p_factor) {
+    const std::size_t dimension = p_point2.size();
+
+    double distance = 0.0;
+    for (std::size_t row = 0; row < dimension; row++) {
+        const std::size_t offset = row * dimension;
+
+        double projection = 0.0;
+        for (std::size_t column = row; column < dimension; column++) {
+            projection += p_factor[offset + column] * (p_point1[column] - p_point2[column]);
+        }
+
+        distance += projection * projection;
+    }
+
+    return std::sqrt(distance);
+}
+
+
+/**
+ *
+ * @brief   Calculates Euclidean distance matrix using points container.
+ * @details Distances are calculated tile by tile in parallel by 'container::pairwise_distance_matrix'.
  *
  * @param[in]  p_points: input data that is represented by points.
  * @param[out] p_distance_matrix: output distance matrix of points.
  *
  */
-template <typename TypeContainer>
-void distance_matrix(const TypeContainer & p_points, TypeContainer & p_distance_matrix) {
-    using TypeElement = typename TypeContainer::value_type;
-    
-    p_distance_matrix = TypeContainer(p_points.size(), TypeElement(p_points.size(), 0.0));
-
-    for (std::size_t i = 0; i < p_points.size(); i++) {
-        for (std::size_t j = i + 1; j < p_points.size(); j++) {
-            const double distance = euclidean_distance(p_points.at(i), p_points.at(j));
-            p_distance_matrix[i][j] = distance;
-            p_distance_matrix[j][i] = distance;
-        }
+void distance_matrix(const dataset & p_points, dataset & p_distance_matrix);
+
+
+/**
+ *
+ * @brief   Defines type of distance metric.
+ *
+ */
+enum class metric_type {
+    EUCLIDEAN = 0,
+    EUCLIDEAN_SQUARE,
+    MANHATTAN,
+    CHEBYSHEV,
+    MINKOWSKI,
+    COSINE,
+    MAHALANOBIS,
+    WEIGHTED_EUCLIDEAN,
+    CANBERRA,
+    GOWER,
+    USER_DEFINED = 1000
+};
+
+
+/**
+ *
+ * @brief   Parameters of distance metric (weights, ranges or matrix factor) that are shared between copies of the metric.
+ *
+ */
+using metric_arguments = std::shared_ptr<const std::vector<double>>;
+
+
+/**
+ *
+ * @brief   Creates parameters of metric that has parameter per coordinate (weights or ranges of features).
+ *
+ * @param[in] p_arguments: parameter of each coordinate.
+ * @param[in] p_name: name of parameters that is used in the error message.
+ *
+ * @throw   std::invalid_argument if parameters are empty.
+ *
+ */
+inline metric_arguments create_metric_arguments(const std::vector<double> & p_arguments, const std::string & p_name) {
+    if (p_arguments.empty()) {
+        throw std::invalid_argument(p_name + " of metric should not be empty.");
+    }
+
+    return std::make_shared<const std::vector<double>>(p_arguments);
+}
+
+
+/**
+ *
+ * @brief   Checks that points have dimension that is expected by metric with parameter per coordinate.
+ *
+ * @param[in] p_dimension1: dimension of the first point.
+ * @param[in] p_dimension2: dimension of the second point.
+ * @param[in] p_expected: dimension that is defined by parameters of the metric.
+ *
+ * @throw   std::invalid_argument if dimension of any point differs from the expected dimension.
+ *
+ */
+inline void check_metric_dimension(const std::size_t p_dimension1, const std::size_t p_dimension2, const std::size_t p_expected) {
+    if ((p_dimension1 != p_expected) || (p_dimension2 != p_expected)) {
+        throw std::invalid_argument("Dimension of points ('" + std::to_string(p_dimension1) + "', '" + std::to_string(p_dimension2) +
+            "') does not correspond to dimension of metric arguments ('" + std::to_string(p_expected) + "').");
     }
 }
 
@@ -194,6 +551,8 @@ void distance_matrix(const TypeContainer & p_points, TypeContainer & p_distance_
  *
  * @brief   Basic distance metric provides interface for calculation distance between objects in line with
  *           specific metric.
+ * @details Built-in metrics store their type, therefore algorithms can replace the metric by corresponding
+ *           compile-time metric policy using 'visit_metric'.
  *
  */
 template <typename TypeContainer>
@@ -201,11 +560,33 @@ class distance_metric {
 protected:
     distance_functor<TypeContainer> m_functor = nullptr;
 
+    distance_kernel                 m_kernel  = nullptr;
+
+    metric_type                     m_type    = metric_type::USER_DEFINED;
+
+    double                          m_degree  = 0.0;
+
+    metric_arguments                m_arguments = nullptr;
+
+    std::size_t                     m_dimension = 0;    /* dimension of points that is defined by arguments, 0 - any */
+
 public:
     distance_metric(void) = default;
 
     distance_metric(const distance_functor<TypeContainer> & p_functor) : m_functor(p_functor) { }
 
+    distance_metric(const distance_functor<TypeContainer> & p_functor, const distance_kernel & p_kernel) :
+        m_functor(p_functor), m_kernel(p_kernel)
+    { }
+
+    distance_metric(const distance_functor<TypeContainer> & p_functor, const distance_kernel & p_kernel, const metric_type p_type, const double p_degree = 0.0) :
+        m_functor(p_functor), m_kernel(p_kernel), m_type(p_type), m_degree(p_degree)
+    { }
+
+    distance_metric(const distance_functor<TypeContainer> & p_functor, const distance_kernel & p_kernel, const metric_type p_type, const metric_arguments & p_arguments, const std::size_t p_dimension) :
+        m_functor(p_functor), m_kernel(p_kernel), m_type(p_type), m_arguments(p_arguments), m_dimension(p_dimension)
+    { }
+
     distance_metric(const distance_metric & p_other) = default;
 
     distance_metric(distance_metric && p_other) = default;
@@ -215,18 +596,85 @@ public:
 public:
    /**
     *
-    * @brief   Performs calculation of distance metric between two points.
+    * @brief   Performs calculation of distance metric between two points.
+    *
+    * @param[in] p_point1: the first iterable point.
+    * @param[in] p_point2: the second iterable point.
+    *
+    * @return  Calculated distance between two points.
+    *
+    * @throw   std::invalid_argument if dimension of points does not correspond to arguments of the metric.
+    *
+    */
+    double operator()(const TypeContainer & p_point1, const TypeContainer & p_point2) const {
+        if (m_dimension > 0) {
+            check_metric_dimension(p_point1.size(), p_point2.size(), m_dimension);
+        }
+
+        return m_functor(p_point1, p_point2);
+    }
+
+   /**
+    *
+    * @brief   Performs calculation of distance metric between two points that are represented by different
+    *           containers with contiguous storage (for example, 'point' and 'point_view' of 'dense_dataset').
+    * @details Built-in metrics calculate distance directly using coordinates, user-defined metric is called
+    *           with copies of points.
+    *
+    * @param[in] p_point1: the first point.
+    * @param[in] p_point2: the second point.
+    *
+    * @return  Calculated distance between two points.
+    *
+    * @throw   std::invalid_argument if dimension of points does not correspond to arguments of the metric.
+    *
+    */
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        if (m_dimension > 0) {
+            check_metric_dimension(p_point1.size(), p_point2.size(), m_dimension);
+        }
+
+        if (m_kernel) {
+            return m_kernel(p_point1.data(), p_point2.data(), p_point1.size());
+        }
+
+        return m_functor(TypeContainer(std::begin(p_point1), std::end(p_point1)), TypeContainer(std::begin(p_point2), std::end(p_point2)));
+    }
+
+public:
+    /**
+    *
+    * @brief   Returns type of the metric, 'metric_type::USER_DEFINED' for metrics that are created by user functor.
+    *
+    */
+    metric_type get_type(void) const { return m_type; }
+
+    /**
+    *
+    * @brief   Returns degree of Minkowski metric.
     *
-    * @param[in] p_point1: the first iterable point.
-    * @param[in] p_point2: the second iterable point.
+    */
+    double get_degree(void) const { return m_degree; }
+
+    /**
     *
-    * @return  Calculated distance between two points.
+    * @brief   Returns parameters of the metric: weights of weighted Euclidean metric, ranges of features of Gower
+    *           metric or upper triangular Cholesky factor of inverse covariance matrix of Mahalanobis metric.
     *
     */
-    double operator()(const TypeContainer & p_point1, const TypeContainer & p_point2) const {
-        return m_functor(p_point1, p_point2);
+    const std::vector<double> & get_arguments(void) const {
+        static const std::vector<double> empty_arguments;
+        return m_arguments ? *m_arguments : empty_arguments;
     }
 
+    /**
+    *
+    * @brief   Returns dimension of points that is defined by parameters of the metric, 0 if any dimension is allowed.
+    *
+    */
+    std::size_t get_dimension(void) const { return m_dimension; }
+
 public:
     operator bool() const {
         return m_functor != nullptr;
@@ -235,6 +683,11 @@ public:
     distance_metric<TypeContainer>& operator=(const distance_metric<TypeContainer>& p_other) {
         if (this != &p_other) {
             m_functor = p_other.m_functor;
+            m_kernel  = p_other.m_kernel;
+            m_type    = p_other.m_type;
+            m_degree  = p_other.m_degree;
+            m_arguments = p_other.m_arguments;
+            m_dimension = p_other.m_dimension;
         }
 
         return *this;
@@ -251,7 +704,10 @@ template <typename TypeContainer>
 class euclidean_distance_metric : public distance_metric<TypeContainer> {
 public:
     euclidean_distance_metric(void) :
-        distance_metric<TypeContainer>(std::bind(euclidean_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2))
+        distance_metric<TypeContainer>(std::bind(euclidean_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            [](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return std::sqrt(simd::euclidean_distance_square(p_point1, p_point2, p_dimension));
+            }, metric_type::EUCLIDEAN)
     { }
 };
 
@@ -265,7 +721,8 @@ template <typename TypeContainer>
 class euclidean_distance_square_metric : public distance_metric<TypeContainer> {
 public:
     euclidean_distance_square_metric(void) :
-        distance_metric<TypeContainer>(std::bind(euclidean_distance_square<TypeContainer>, std::placeholders::_1, std::placeholders::_2))
+        distance_metric<TypeContainer>(std::bind(euclidean_distance_square<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            simd::euclidean_distance_square, metric_type::EUCLIDEAN_SQUARE)
     { }
 };
 
@@ -279,7 +736,8 @@ template <typename TypeContainer>
 class manhattan_distance_metric : public distance_metric<TypeContainer> {
 public:
     manhattan_distance_metric(void) :
-        distance_metric<TypeContainer>(std::bind(manhattan_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2))
+        distance_metric<TypeContainer>(std::bind(manhattan_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            simd::manhattan_distance, metric_type::MANHATTAN)
     { }
 };
 
@@ -293,7 +751,8 @@ template <typename TypeContainer>
 class chebyshev_distance_metric : public distance_metric<TypeContainer> {
 public:
     chebyshev_distance_metric(void) :
-        distance_metric<TypeContainer>(std::bind(chebyshev_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2))
+        distance_metric<TypeContainer>(std::bind(chebyshev_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            simd::chebyshev_distance, metric_type::CHEBYSHEV)
     { }
 };
 
@@ -314,8 +773,178 @@ public:
    *
    */
     minkowski_distance_metric(const double p_degree) :
-        distance_metric<TypeContainer>(std::bind(minkowski_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2, p_degree))
+        distance_metric<TypeContainer>(std::bind(minkowski_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2, p_degree),
+            [p_degree](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return minkowski_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension), p_degree);
+            }, metric_type::MINKOWSKI, p_degree)
+    { }
+};
+
+
+/**
+ *
+ * @brief   Cosine distance metric calculator between two points.
+ *
+ */
+template <typename TypeContainer>
+class cosine_distance_metric : public distance_metric<TypeContainer> {
+public:
+    cosine_distance_metric(void) :
+        distance_metric<TypeContainer>(std::bind(cosine_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            [](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return cosine_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension));
+            }, metric_type::COSINE)
+    { }
+};
+
+
+/**
+ *
+ * @brief   Canberra distance metric calculator between two points.
+ *
+ */
+template <typename TypeContainer>
+class canberra_distance_metric : public distance_metric<TypeContainer> {
+public:
+    canberra_distance_metric(void) :
+        distance_metric<TypeContainer>(std::bind(canberra_distance<TypeContainer>, std::placeholders::_1, std::placeholders::_2),
+            [](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return canberra_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension));
+            }, metric_type::CANBERRA)
+    { }
+};
+
+
+/**
+ *
+ * @brief   Weighted Euclidean distance metric calculator between two points.
+ *
+ */
+template <typename TypeContainer>
+class weighted_euclidean_distance_metric : public distance_metric<TypeContainer> {
+public:
+  /**
+   *
+   * @brief   Constructor of weighted Euclidean distance metric.
+   *
+   * @param[in] p_weights: weight of each coordinate, amount of weights defines dimension of points.
+   *
+   * @throw   std::invalid_argument if weights are empty.
+   *
+   */
+    weighted_euclidean_distance_metric(const std::vector<double> & p_weights) :
+        weighted_euclidean_distance_metric(create_metric_arguments(p_weights, "Weights"))
+    { }
+
+private:
+    weighted_euclidean_distance_metric(const metric_arguments & p_weights) :
+        distance_metric<TypeContainer>(
+            [p_weights](const TypeContainer & p_point1, const TypeContainer & p_point2) {
+                return weighted_euclidean_distance(p_point1, p_point2, *p_weights);
+            },
+            [p_weights](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return weighted_euclidean_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension), *p_weights);
+            }, metric_type::WEIGHTED_EUCLIDEAN, p_weights, p_weights->size())
+    { }
+};
+
+
+/**
+ *
+ * @brief   Gower distance metric calculator between two points with numerical coordinates.
+ *
+ */
+template <typename TypeContainer>
+class gower_distance_metric : public distance_metric<TypeContainer> {
+public:
+  /**
+   *
+   * @brief   Constructor of Gower distance metric.
+   *
+   * @param[in] p_ranges: range (maximum minus minimum) of each feature, amount of ranges defines dimension of points.
+   *
+   * @throw   std::invalid_argument if ranges are empty.
+   *
+   */
+    gower_distance_metric(const std::vector<double> & p_ranges) :
+        gower_distance_metric(create_metric_arguments(p_ranges, "Ranges of features"))
+    { }
+
+private:
+    gower_distance_metric(const metric_arguments & p_ranges) :
+        distance_metric<TypeContainer>(
+            [p_ranges](const TypeContainer & p_point1, const TypeContainer & p_point2) {
+                return gower_distance(p_point1, p_point2, *p_ranges);
+            },
+            [p_ranges](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return gower_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension), *p_ranges);
+            }, metric_type::GOWER, p_ranges, p_ranges->size())
+    { }
+};
+
+
+/**
+ *
+ * @brief   Mahalanobis distance metric calculator between two points.
+ *
+ */
+template <typename TypeContainer>
+class mahalanobis_distance_metric : public distance_metric<TypeContainer> {
+public:
+  /**
+   *
+   * @brief   Constructor of Mahalanobis distance metric.
+   * @details Inverse covariance matrix is factorized by Cholesky decomposition once, the factor is used for
+   *           each distance calculation.
+   *
+   * @param[in] p_inverse_covariance: inverse covariance matrix, it should be symmetric positive-definite.
+   *
+   * @throw   std::invalid_argument if the matrix is empty, it is not square or it is not positive-definite.
+   *
+   */
+    mahalanobis_distance_metric(const std::vector<std::vector<double>> & p_inverse_covariance) :
+        mahalanobis_distance_metric(create_factor(p_inverse_covariance), p_inverse_covariance.size())
     { }
+
+private:
+    mahalanobis_distance_metric(const metric_arguments & p_factor, const std::size_t p_dimension) :
+        distance_metric<TypeContainer>(
+            [p_factor](const TypeContainer & p_point1, const TypeContainer & p_point2) {
+                return mahalanobis_distance(p_point1, p_point2, *p_factor);
+            },
+            [p_factor](const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+                return mahalanobis_distance(container::point_view(p_point1, p_dimension), container::point_view(p_point2, p_dimension), *p_factor);
+            }, metric_type::MAHALANOBIS, p_factor, p_dimension)
+    { }
+
+    static metric_arguments create_factor(const std::vector<std::vector<double>> & p_inverse_covariance) {
+        const std::size_t dimension = p_inverse_covariance.size();
+        if (dimension == 0) {
+            throw std::invalid_argument("Inverse covariance matrix should not be empty.");
+        }
+
+        std::vector<double> matrix;
+        matrix.reserve(dimension * dimension);
+        for (const auto & row : p_inverse_covariance) {
+            if (row.size() != dimension) {
+                throw std::invalid_argument("Inverse covariance matrix should be square matrix.");
+            }
+
+            matrix.insert(matrix.end(), row.begin(), row.end());
+        }
+
+        /* transposed lower factor L^T is upper factor U: S^-1 = L * L^T = U^T * U */
+        const std::vector<double> lower = math::cholesky_decomposition(matrix, dimension);
+
+        auto upper = std::make_shared<std::vector<double>>(lower.size(), 0.0);
+        for (std::size_t row = 0; row < dimension; row++) {
+            for (std::size_t column = row; column < dimension; column++) {
+                (*upper)[row * dimension + column] = lower[column * dimension + row];
+            }
+        }
+
+        return upper;
+    }
 };
 
 
@@ -384,6 +1013,67 @@ public:
         return minkowski_distance_metric<TypeContainer>(p_degree);
     }
 
+   /**
+   *
+   * @brief   Creates cosine distance metric.
+   *
+   * @return  Cosine distance metric.
+   *
+   */
+    static distance_metric<TypeContainer> cosine(void) {
+        return cosine_distance_metric<TypeContainer>();
+    }
+
+   /**
+   *
+   * @brief   Creates Canberra distance metric.
+   *
+   * @return  Canberra distance metric.
+   *
+   */
+    static distance_metric<TypeContainer> canberra(void) {
+        return canberra_distance_metric<TypeContainer>();
+    }
+
+   /**
+   *
+   * @brief   Creates weighted Euclidean distance metric.
+   *
+   * @param[in] p_weights: weight of each coordinate.
+   *
+   * @return  Weighted Euclidean distance metric.
+   *
+   */
+    static distance_metric<TypeContainer> weighted_euclidean(const std::vector<double> & p_weights) {
+        return weighted_euclidean_distance_metric<TypeContainer>(p_weights);
+    }
+
+   /**
+   *
+   * @brief   Creates Gower distance metric for numerical data.
+   *
+   * @param[in] p_ranges: range (maximum minus minimum) of each feature.
+   *
+   * @return  Gower distance metric.
+   *
+   */
+    static distance_metric<TypeContainer> gower(const std::vector<double> & p_ranges) {
+        return gower_distance_metric<TypeContainer>(p_ranges);
+    }
+
+   /**
+   *
+   * @brief   Creates Mahalanobis distance metric.
+   *
+   * @param[in] p_inverse_covariance: inverse covariance matrix, it should be symmetric positive-definite.
+   *
+   * @return  Mahalanobis distance metric.
+   *
+   */
+    static distance_metric<TypeContainer> mahalanobis(const std::vector<std::vector<double>> & p_inverse_covariance) {
+        return mahalanobis_distance_metric<TypeContainer>(p_inverse_covariance);
+    }
+
    /**
    *
    * @brief   Creates user-defined distance metric.
@@ -399,15 +1089,270 @@ public:
 };
 
 
+namespace details {
+
+
+/**
+ *
+ * @brief   Base of compile-time policies of metrics that have vectorized kernels.
+ * @details Kernel is taken once when the policy is created ('visit_metric' creates it once per loop), therefore
+ *           distance between contiguous points is calculated by one call of the kernel without its lookup.
+ *
+ */
+struct kernel_policy {
+    simd::kernel_t m_kernel = nullptr;
+
+    explicit kernel_policy(const simd::kernel_t p_kernel) : m_kernel(p_kernel) { }
+
+    template <typename TypeLeft, typename TypeRight, typename TypeGeneric>
+    double calculate(const TypeLeft & p_point1, const TypeRight & p_point2, const TypeGeneric &, std::true_type) const {
+        return m_kernel(p_point1.data(), p_point2.data(), p_point2.size());
+    }
+
+    template <typename TypeLeft, typename TypeRight, typename TypeGeneric>
+    double calculate(const TypeLeft & p_point1, const TypeRight & p_point2, const TypeGeneric & p_generic, std::false_type) const {
+        return p_generic(p_point1, p_point2);
+    }
+};
+
+
+}
+
+
+/**
+ *
+ * @brief   Compile-time policy of Euclidean distance metric.
+ *
+ */
+struct euclidean_distance_policy : public details::kernel_policy {
+    euclidean_distance_policy(void) : kernel_policy(simd::get_kernels().m_euclidean_square) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return std::sqrt(calculate(p_point1, p_point2, euclidean_distance_square<TypeLeft, TypeRight>, details::is_contiguous_pair<TypeLeft, TypeRight>()));
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of square Euclidean distance metric.
+ *
+ */
+struct euclidean_distance_square_policy : public details::kernel_policy {
+    euclidean_distance_square_policy(void) : kernel_policy(simd::get_kernels().m_euclidean_square) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return calculate(p_point1, p_point2, euclidean_distance_square<TypeLeft, TypeRight>, details::is_contiguous_pair<TypeLeft, TypeRight>());
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Manhattan distance metric.
+ *
+ */
+struct manhattan_distance_policy : public details::kernel_policy {
+    manhattan_distance_policy(void) : kernel_policy(simd::get_kernels().m_manhattan) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return calculate(p_point1, p_point2, manhattan_distance<TypeLeft, TypeRight>, details::is_contiguous_pair<TypeLeft, TypeRight>());
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Chebyshev distance metric.
+ *
+ */
+struct chebyshev_distance_policy : public details::kernel_policy {
+    chebyshev_distance_policy(void) : kernel_policy(simd::get_kernels().m_chebyshev) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return calculate(p_point1, p_point2, chebyshev_distance<TypeLeft, TypeRight>, details::is_contiguous_pair<TypeLeft, TypeRight>());
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Minkowski distance metric.
+ *
+ */
+struct minkowski_distance_policy {
+    double m_degree = 2.0;
+
+    explicit minkowski_distance_policy(const double p_degree) : m_degree(p_degree) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return minkowski_distance(p_point1, p_point2, m_degree);
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of cosine distance metric.
+ *
+ */
+struct cosine_distance_policy {
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return cosine_distance(p_point1, p_point2);
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Canberra distance metric.
+ *
+ */
+struct canberra_distance_policy {
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        return canberra_distance(p_point1, p_point2);
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of weighted Euclidean distance metric, weights are owned by the metric.
+ *
+ */
+struct weighted_euclidean_distance_policy {
+    container::point_view m_weights;
+
+    explicit weighted_euclidean_distance_policy(const std::vector<double> & p_weights) : m_weights(p_weights) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        check_metric_dimension(p_point1.size(), p_point2.size(), m_weights.size());
+        return weighted_euclidean_distance(p_point1, p_point2, m_weights);
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Gower distance metric, ranges of features are owned by the metric.
+ *
+ */
+struct gower_distance_policy {
+    container::point_view m_ranges;
+
+    explicit gower_distance_policy(const std::vector<double> & p_ranges) : m_ranges(p_ranges) { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        check_metric_dimension(p_point1.size(), p_point2.size(), m_ranges.size());
+        return gower_distance(p_point1, p_point2, m_ranges);
+    }
+};
+
+
+/**
+ *
+ * @brief   Compile-time policy of Mahalanobis distance metric, Cholesky factor is owned by the metric.
+ *
+ */
+struct mahalanobis_distance_policy {
+    container::point_view m_factor;
+    std::size_t           m_dimension = 0;
+
+    mahalanobis_distance_policy(const std::vector<double> & p_factor, const std::size_t p_dimension) :
+        m_factor(p_factor), m_dimension(p_dimension)
+    { }
+
+    template <typename TypeLeft, typename TypeRight>
+    double operator()(const TypeLeft & p_point1, const TypeRight & p_point2) const {
+        check_metric_dimension(p_point1.size(), p_point2.size(), m_dimension);
+        return mahalanobis_distance(p_point1, p_point2, m_factor);
+    }
+};
+
+
+/**
+ *
+ * @brief   Calls action with compile-time policy that corresponds to the specified metric.
+ * @details The action is a generic callable that is instantiated for each policy, in case of user-defined
+ *           metric the metric itself is passed to the action. It allows algorithms to run their hot loops
+ *           without indirect call per distance calculation. Policy is created once per call, therefore
+ *           vectorized kernels are looked up once per loop.
+ *
+ * @param[in] p_metric: metric that defines policy.
+ * @param[in] p_action: action that is called with policy, for example, generic lambda.
+ *
+ */
+template <typename TypeContainer, typename TypeAction>
+void visit_metric(const distance_metric<TypeContainer> & p_metric, TypeAction && p_action) {
+    switch(p_metric.get_type()) {
+        case metric_type::EUCLIDEAN:
+            p_action(euclidean_distance_policy());
+            break;
+
+        case metric_type::EUCLIDEAN_SQUARE:
+            p_action(euclidean_distance_square_policy());
+            break;
+
+        case metric_type::MANHATTAN:
+            p_action(manhattan_distance_policy());
+            break;
+
+        case metric_type::CHEBYSHEV:
+            p_action(chebyshev_distance_policy());
+            break;
+
+        case metric_type::MINKOWSKI:
+            p_action(minkowski_distance_policy(p_metric.get_degree()));
+            break;
+
+        case metric_type::COSINE:
+            p_action(cosine_distance_policy());
+            break;
+
+        case metric_type::CANBERRA:
+            p_action(canberra_distance_policy());
+            break;
+
+        case metric_type::WEIGHTED_EUCLIDEAN:
+            p_action(weighted_euclidean_distance_policy(p_metric.get_arguments()));
+            break;
+
+        case metric_type::GOWER:
+            p_action(gower_distance_policy(p_metric.get_arguments()));
+            break;
+
+        case metric_type::MAHALANOBIS:
+            p_action(mahalanobis_distance_policy(p_metric.get_arguments(), p_metric.get_dimension()));
+            break;
+
+        default:
+            p_action(p_metric);
+            break;
+    }
+}
+
+
 /**
  *
  * @brief   Returns average distance for establish links between specified number of neighbors.
+ * @details Neighbors are found by k-nearest neighbors search in KD-tree.
  *
  * @param[in] points:    Input data.
  * @param[in] num_neigh: Number of neighbors.
  *
  * @return  Returns average distance for establish links between 'num_neigh' in data set 'points'.
  *
+ * @throw   std::invalid_argument if number of neighbors is not less than amount of points.
+ *
  */
 double average_neighbor_distance(const std::vector<std::vector<double> > * points, const std::size_t num_neigh);
 
@@ -0,0 +1,387 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "utils/metric_batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "parallel/parallel.hpp"
+
+#include "utils/metric_simd.hpp"
+#include "utils/simd_target.hpp"
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace metric {
+
+
+namespace {
+
+
+/* amount of points in one tile that are processed by one task */
+const std::size_t POINT_TILE_SIZE = 64;
+
+/* micro-kernel calculates scores for block of points against block of centers in registers */
+const std::size_t KERNEL_POINTS = 4;
+const std::size_t KERNEL_CENTERS = 8;
+
+/* amount of bytes of transposed centers in one block to keep them in L1 cache */
+const std::size_t CENTER_BLOCK_BYTES = 16384;
+
+/* relative difference between the best scores that is considered as a tie */
+const double TIE_RELATIVE_TOLERANCE = 1.0e-9;
+
+
+/**
+ *
+ * @brief   Centers that are stored in transposed layout (dimension by dimension) with their squared norms.
+ * @details Amount of centers is padded up to size of the micro-kernel by fake centers whose norms are
+ *           maximum, therefore they are never selected as the nearest.
+ *
+ */
+class packed_centers {
+public:
+    std::vector<double>     m_transposed;
+    std::vector<double>     m_norms;
+    std::size_t             m_size          = 0;
+    std::size_t             m_stride        = 0;
+    std::size_t             m_dimension     = 0;
+    std::size_t             m_block         = 0;
+
+public:
+    packed_centers(const dataset & p_centers, const std::size_t p_dimension) :
+        m_size(p_centers.size()),
+        m_stride((p_centers.size() + KERNEL_CENTERS - 1) / KERNEL_CENTERS * KERNEL_CENTERS),
+        m_dimension(p_dimension)
+    {
+        m_transposed.assign(m_stride * m_dimension, 0.0);
+        m_norms.assign(m_stride, std::numeric_limits<double>::max());
+
+        for (std::size_t index_center = 0; index_center < m_size; index_center++) {
+            const point & center = p_centers[index_center];
+            if (center.size() != m_dimension) {
+                throw std::invalid_argument("Dimension of center '" + std::to_string(index_center) + "' (" + std::to_string(center.size()) + 
+                    ") is not equal to dimension of points (" + std::to_string(m_dimension) + ").");
+            }
+
+            m_norms[index_center] = 0.0;
+            for (std::size_t dimension = 0; dimension < m_dimension; dimension++) {
+                m_transposed[dimension * m_stride + index_center] = center[dimension];
+                m_norms[index_center] += center[dimension] * center[dimension];
+            }
+        }
+
+        const std::size_t block = CENTER_BLOCK_BYTES / (sizeof(double) * std::max(m_dimension, std::size_t(1)));
+        m_block = std::max(block / KERNEL_CENTERS, std::size_t(1)) * KERNEL_CENTERS;
+    }
+};
+
+
+/**
+ *
+ * @brief   Best and second best scores of a point for each lane of the micro-kernel, where score is
+ *           ||c||^2 - 2 * x * c (squared distance without norm of the point).
+ * @details Lanes are updated without branches by vectorized kernels and they are reduced when all
+ *           centers are processed. Index of center is stored as double to be blended with scores.
+ *
+ */
+struct alignas(32) nearest_lanes {
+    double      m_best[KERNEL_CENTERS];
+    double      m_second[KERNEL_CENTERS];
+    double      m_index[KERNEL_CENTERS];
+
+    nearest_lanes(void) {
+        std::fill(m_best, m_best + KERNEL_CENTERS, std::numeric_limits<double>::max());
+        std::fill(m_second, m_second + KERNEL_CENTERS, std::numeric_limits<double>::max());
+        std::fill(m_index, m_index + KERNEL_CENTERS, 0.0);
+    }
+};
+
+
+using micro_kernel = void (*)(const double * const *, const packed_centers &, const std::size_t, nearest_lanes *);
+
+
+/**
+ *
+ * @brief   Calculates scores of KERNEL_POINTS points against KERNEL_CENTERS centers and updates lanes of the points.
+ *
+ */
+void assign_micro_block(const double * const * p_points,
+                        const packed_centers & p_centers,
+                        const std::size_t p_center_begin,
+                        nearest_lanes * p_lanes)
+{
+    double scores[KERNEL_POINTS][KERNEL_CENTERS];
+    for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+        for (std::size_t index_center = 0; index_center < KERNEL_CENTERS; index_center++) {
+            scores[index_point][index_center] = p_centers.m_norms[p_center_begin + index_center];
+        }
+    }
+
+    const double * coordinates = p_centers.m_transposed.data() + p_center_begin;
+    for (std::size_t dimension = 0; dimension < p_centers.m_dimension; dimension++) {
+        for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+            const double factor = -2.0 * p_points[index_point][dimension];
+            for (std::size_t index_center = 0; index_center < KERNEL_CENTERS; index_center++) {
+                scores[index_point][index_center] += factor * coordinates[index_center];
+            }
+        }
+
+        coordinates += p_centers.m_stride;
+    }
+
+    for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+        nearest_lanes & lanes = p_lanes[index_point];
+        for (std::size_t index_lane = 0; index_lane < KERNEL_CENTERS; index_lane++) {
+            const double score = scores[index_point][index_lane];
+            if (score < lanes.m_best[index_lane]) {
+                lanes.m_second[index_lane] = lanes.m_best[index_lane];
+                lanes.m_best[index_lane] = score;
+                lanes.m_index[index_lane] = (double) (p_center_begin + index_lane);
+            }
+            else if (score < lanes.m_second[index_lane]) {
+                lanes.m_second[index_lane] = score;
+            }
+        }
+    }
+}
+
+
+#if defined(CCORE_SIMD_X86)
+
+CCORE_SIMD_TARGET("avx2,fma")
+void assign_micro_block_avx2(const double * const * p_points,
+                             const packed_centers & p_centers,
+                             const std::size_t p_center_begin,
+                             nearest_lanes * p_lanes)
+{
+    const double * norms = p_centers.m_norms.data() + p_center_begin;
+    const __m256d norms_low = _mm256_loadu_pd(norms);
+    const __m256d norms_high = _mm256_loadu_pd(norms + 4);
+
+    __m256d scores[KERNEL_POINTS][2];
+    for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+        scores[index_point][0] = norms_low;
+        scores[index_point][1] = norms_high;
+    }
+
+    const double * coordinates = p_centers.m_transposed.data() + p_center_begin;
+    for (std::size_t dimension = 0; dimension < p_centers.m_dimension; dimension++) {
+        const __m256d coordinates_low = _mm256_loadu_pd(coordinates);
+        const __m256d coordinates_high = _mm256_loadu_pd(coordinates + 4);
+
+        for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+            const __m256d factor = _mm256_set1_pd(-2.0 * p_points[index_point][dimension]);
+            scores[index_point][0] = _mm256_fmadd_pd(factor, coordinates_low, scores[index_point][0]);
+            scores[index_point][1] = _mm256_fmadd_pd(factor, coordinates_high, scores[index_point][1]);
+        }
+
+        coordinates += p_centers.m_stride;
+    }
+
+    const double begin = (double) p_center_begin;
+    const __m256d indexes[2] = { _mm256_setr_pd(begin, begin + 1.0, begin + 2.0, begin + 3.0),
+                                 _mm256_setr_pd(begin + 4.0, begin + 5.0, begin + 6.0, begin + 7.0) };
+
+    for (std::size_t index_point = 0; index_point < KERNEL_POINTS; index_point++) {
+        nearest_lanes & lanes = p_lanes[index_point];
+        for (std::size_t half = 0; half < 2; half++) {
+            const __m256d score = scores[index_point][half];
+            const __m256d best = _mm256_load_pd(lanes.m_best + 4 * half);
+            const __m256d second = _mm256_load_pd(lanes.m_second + 4 * half);
+            const __m256d index = _mm256_load_pd(lanes.m_index + 4 * half);
+
+            /* second best is min(second, max(best, score)), it is the same as branches of scalar kernel */
+            const __m256d improved = _mm256_cmp_pd(score, best, _CMP_LT_OQ);
+            _mm256_store_pd(lanes.m_second + 4 * half, _mm256_min_pd(second, _mm256_max_pd(best, score)));
+            _mm256_store_pd(lanes.m_best + 4 * half, _mm256_blendv_pd(best, score, improved));
+            _mm256_store_pd(lanes.m_index + 4 * half, _mm256_blendv_pd(index, indexes[half], improved));
+        }
+    }
+}
+
+#endif
+
+
+/**
+ *
+ * @brief   Returns micro-kernel for instruction set that is used by distance kernels.
+ *
+ */
+micro_kernel get_micro_kernel(void) {
+#if defined(CCORE_SIMD_X86)
+    if (simd::get_level() >= simd::simd_level::AVX2) {
+        return assign_micro_block_avx2;
+    }
+#endif
+
+    return assign_micro_block;
+}
+
+
+/**
+ *
+ * @brief   Finds nearest center for one tile of points.
+ *
+ * @param[in]  p_data: points.
+ * @param[in]  p_centers: packed centers.
+ * @param[in]  p_centers_origin: centers that are used for exact calculation in case of tie.
+ * @param[in]  p_kernel: micro-kernel that calculates scores.
+ * @param[in]  p_point_index: functor that returns index of point by its position in the tile.
+ * @param[in]  p_tile_size: amount of points in the tile.
+ * @param[out] p_labels: labels of points.
+ *
+ */
+template <typename TypePointIndex>
+void assign_tile(const container::dense_dataset & p_data,
+                 const packed_centers & p_centers,
+                 const dataset & p_centers_origin,
+                 const micro_kernel p_kernel,
+                 const TypePointIndex & p_point_index,
+                 const std::size_t p_tile_size,
+                 std::vector<std::size_t> & p_labels)
+{
+    /* tile is padded up to size of the micro-kernel by the last point */
+    const double * points[POINT_TILE_SIZE];
+    for (std::size_t index_tile = 0; index_tile < POINT_TILE_SIZE; index_tile++) {
+        points[index_tile] = p_data.row(p_point_index(std::min(index_tile, p_tile_size - 1))).data();
+    }
+
+    nearest_lanes lanes[POINT_TILE_SIZE];
+
+    for (std::size_t block_begin = 0; block_begin < p_centers.m_stride; block_begin += p_centers.m_block) {
+        const std::size_t block_end = std::min(block_begin + p_centers.m_block, p_centers.m_stride);
+
+        for (std::size_t index_tile = 0; index_tile < p_tile_size; index_tile += KERNEL_POINTS) {
+            for (std::size_t index_center = block_begin; index_center < block_end; index_center += KERNEL_CENTERS) {
+                p_kernel(points + index_tile, p_centers, index_center, lanes + index_tile);
+            }
+        }
+    }
+
+    for (std::size_t index_tile = 0; index_tile < p_tile_size; index_tile++) {
+        const nearest_lanes & point_lanes = lanes[index_tile];
+
+        /* reduce lanes: the first center is preferable in case of equal scores as in per-pair search */
+        std::size_t index_lane = 0;
+        for (std::size_t index_candidate = 1; index_candidate < KERNEL_CENTERS; index_candidate++) {
+            const double score = point_lanes.m_best[index_candidate];
+            if ( (score < point_lanes.m_best[index_lane]) || 
+                 ((score == point_lanes.m_best[index_lane]) && (point_lanes.m_index[index_candidate] < point_lanes.m_index[index_lane])) )
+            {
+                index_lane = index_candidate;
+            }
+        }
+
+        const double best = point_lanes.m_best[index_lane];
+        double second = point_lanes.m_second[index_lane];
+        for (std::size_t index_candidate = 0; index_candidate < KERNEL_CENTERS; index_candidate++) {
+            if (index_candidate != index_lane) {
+                second = std::min(second, point_lanes.m_best[index_candidate]);
+            }
+        }
+
+        const std::size_t index_point = p_point_index(index_tile);
+        const container::point_view object = p_data.row(index_point);
+
+        std::size_t index_optimum = (std::size_t) point_lanes.m_index[index_lane];
+
+        if (p_centers.m_size > 1) {
+            double norm = 0.0;
+            for (const double coordinate : object) {
+                norm += coordinate * coordinate;
+            }
+
+            if (second - best <= TIE_RELATIVE_TOLERANCE * (norm + std::abs(best) + std::abs(second))) {
+                /* expansion is not accurate enough to distinguish centers, exact distances are used */
+                double distance_optimum = std::numeric_limits<double>::max();
+                for (std::size_t index_center = 0; index_center < p_centers.m_size; index_center++) {
+                    const double distance = euclidean_distance_square(object, p_centers_origin[index_center]);
+                    if (distance < distance_optimum) {
+                        distance_optimum = distance;
+                        index_optimum = index_center;
+                    }
+                }
+            }
+        }
+
+        p_labels[index_point] = index_optimum;
+    }
+}
+
+
+}
+
+
+bool is_batch_assignment_supported(const distance_metric<point> & p_metric) {
+    return (p_metric.get_type() == metric_type::EUCLIDEAN) || (p_metric.get_type() == metric_type::EUCLIDEAN_SQUARE);
+}
+
+
+void find_nearest_centers(const container::dense_dataset & p_data, const dataset & p_centers, std::vector<std::size_t> & p_labels) {
+    p_labels.assign(p_data.size(), 0);
+    if (p_centers.empty() || p_data.empty()) {
+        return;
+    }
+
+    const packed_centers centers(p_centers, p_data.dimension());
+    const micro_kernel kernel = get_micro_kernel();
+    const std::size_t amount_tiles = (p_data.size() + POINT_TILE_SIZE - 1) / POINT_TILE_SIZE;
+
+    parallel::parallel_for(std::size_t(0), amount_tiles, [&p_data, &centers, &p_centers, kernel, &p_labels](const std::size_t p_tile) {
+        const std::size_t tile_begin = p_tile * POINT_TILE_SIZE;
+        const std::size_t tile_size = std::min(POINT_TILE_SIZE, p_data.size() - tile_begin);
+
+        assign_tile(p_data, centers, p_centers, kernel, [tile_begin](const std::size_t p_index) { return tile_begin + p_index; }, tile_size, p_labels);
+    });
+}
+
+
+void find_nearest_centers(const container::dense_dataset & p_data, const std::vector<std::size_t> & p_indexes, const dataset & p_centers, std::vector<std::size_t> & p_labels) {
+    if (p_centers.empty() || p_indexes.empty()) {
+        return;
+    }
+
+    const packed_centers centers(p_centers, p_data.dimension());
+    const micro_kernel kernel = get_micro_kernel();
+    const std::size_t amount_tiles = (p_indexes.size() + POINT_TILE_SIZE - 1) / POINT_TILE_SIZE;
+
+    parallel::parallel_for(std::size_t(0), amount_tiles, [&p_data, &p_indexes, &centers, &p_centers, kernel, &p_labels](const std::size_t p_tile) {
+        const std::size_t tile_begin = p_tile * POINT_TILE_SIZE;
+        const std::size_t tile_size = std::min(POINT_TILE_SIZE, p_indexes.size() - tile_begin);
+        const std::size_t * tile_indexes = p_indexes.data() + tile_begin;
+
+        assign_tile(p_data, centers, p_centers, kernel, [tile_indexes](const std::size_t p_index) { return tile_indexes[p_index]; }, tile_size, p_labels);
+    });
+}
+
+
+}
+
+}
+
+}
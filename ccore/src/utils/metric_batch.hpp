@@ -0,0 +1,86 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+#include <vector>
+
+#include "container/dense_dataset.hpp"
+
+#include "utils/metric.hpp"
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace metric {
+
+
+/**
+ *
+ * @brief   Returns true if nearest centers for the metric can be found by batched kernel 'find_nearest_centers'.
+ * @details Euclidean and squared Euclidean distances have the same nearest center, therefore both of
+ *           them are supported.
+ *
+ * @param[in] p_metric: metric that is used for assignment of points to centers.
+ *
+ */
+bool is_batch_assignment_supported(const distance_metric<point> & p_metric);
+
+
+/**
+ *
+ * @brief   Finds nearest center (in line with Euclidean distance) for each point.
+ * @details Squared distance is expanded as ||x||^2 + ||c||^2 - 2 * x * c, where norms of centers are
+ *           calculated once, and dot products are calculated for tiles of points against blocks of
+ *           transposed centers in the same way as blocked matrix multiplication. Tiles are processed
+ *           in parallel. In case of nearly equal distances to several centers, exact distances are
+ *           used to resolve the tie, therefore the result is the same as per-pair calculation.
+ *
+ * @param[in]  p_data: points that should be assigned.
+ * @param[in]  p_centers: centers (all of them should have the same dimension as points).
+ * @param[out] p_labels: index of nearest center for each point, it is resized to amount of points.
+ *
+ */
+void find_nearest_centers(const container::dense_dataset & p_data, const dataset & p_centers, std::vector<std::size_t> & p_labels);
+
+
+/**
+ *
+ * @brief   Finds nearest center (in line with Euclidean distance) for specified points only.
+ *
+ * @param[in]  p_data: points.
+ * @param[in]  p_indexes: indexes of points that should be assigned.
+ * @param[in]  p_centers: centers (all of them should have the same dimension as points).
+ * @param[out] p_labels: labels where index of nearest center is written for each specified point, it
+ *              should be large enough to be indexed by point indexes.
+ *
+ */
+void find_nearest_centers(const container::dense_dataset & p_data, const std::vector<std::size_t> & p_indexes, const dataset & p_centers, std::vector<std::size_t> & p_labels);
+
+
+}
+
+}
+
+}
@@ -0,0 +1,518 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "utils/metric_simd.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "utils/simd_target.hpp"
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+static double euclidean_distance_square_scalar(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    double distance = 0.0;
+    for (std::size_t i = 0; i < p_dimension; i++) {
+        const double difference = p_point1[i] - p_point2[i];
+        distance += difference * difference;
+    }
+
+    return distance;
+}
+
+
+static double manhattan_distance_scalar(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    double distance = 0.0;
+    for (std::size_t i = 0; i < p_dimension; i++) {
+        distance += std::abs(p_point1[i] - p_point2[i]);
+    }
+
+    return distance;
+}
+
+
+static double chebyshev_distance_scalar(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    double distance = 0.0;
+    for (std::size_t i = 0; i < p_dimension; i++) {
+        distance = std::max(distance, std::abs(p_point1[i] - p_point2[i]));
+    }
+
+    return distance;
+}
+
+
+#if defined(CCORE_SIMD_X86)
+
+CCORE_SIMD_TARGET("sse2")
+static inline double horizontal_sum(const __m128d p_value) {
+    return _mm_cvtsd_f64(_mm_add_sd(p_value, _mm_unpackhi_pd(p_value, p_value)));
+}
+
+
+CCORE_SIMD_TARGET("sse2")
+static inline double horizontal_max(const __m128d p_value) {
+    return _mm_cvtsd_f64(_mm_max_sd(p_value, _mm_unpackhi_pd(p_value, p_value)));
+}
+
+
+CCORE_SIMD_TARGET("sse2")
+static double euclidean_distance_square_sse2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= p_dimension; i += 4) {
+        const __m128d difference1 = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        const __m128d difference2 = _mm_sub_pd(_mm_loadu_pd(p_point1 + i + 2), _mm_loadu_pd(p_point2 + i + 2));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(difference1, difference1));
+        sum2 = _mm_add_pd(sum2, _mm_mul_pd(difference2, difference2));
+    }
+
+    if (i + 2 <= p_dimension) {
+        const __m128d difference = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(difference, difference));
+        i += 2;
+    }
+
+    double distance = horizontal_sum(_mm_add_pd(sum1, sum2));
+    if (i < p_dimension) {
+        const double difference = p_point1[i] - p_point2[i];
+        distance += difference * difference;
+    }
+
+    return distance;
+}
+
+
+CCORE_SIMD_TARGET("sse2")
+static double manhattan_distance_sse2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= p_dimension; i += 4) {
+        const __m128d difference1 = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        const __m128d difference2 = _mm_sub_pd(_mm_loadu_pd(p_point1 + i + 2), _mm_loadu_pd(p_point2 + i + 2));
+        sum1 = _mm_add_pd(sum1, _mm_andnot_pd(sign_mask, difference1));
+        sum2 = _mm_add_pd(sum2, _mm_andnot_pd(sign_mask, difference2));
+    }
+
+    if (i + 2 <= p_dimension) {
+        const __m128d difference = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        sum1 = _mm_add_pd(sum1, _mm_andnot_pd(sign_mask, difference));
+        i += 2;
+    }
+
+    double distance = horizontal_sum(_mm_add_pd(sum1, sum2));
+    if (i < p_dimension) {
+        distance += std::abs(p_point1[i] - p_point2[i]);
+    }
+
+    return distance;
+}
+
+
+CCORE_SIMD_TARGET("sse2")
+static double chebyshev_distance_sse2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    const __m128d sign_mask = _mm_set1_pd(-0.0);
+
+    __m128d maximum = _mm_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 2 <= p_dimension; i += 2) {
+        const __m128d difference = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        maximum = _mm_max_pd(maximum, _mm_andnot_pd(sign_mask, difference));
+    }
+
+    double distance = horizontal_max(maximum);
+    if (i < p_dimension) {
+        distance = std::max(distance, std::abs(p_point1[i] - p_point2[i]));
+    }
+
+    return distance;
+}
+
+
+CCORE_SIMD_TARGET("avx2,fma")
+static inline __m128d fold(const __m256d p_value) {
+    return _mm_add_pd(_mm256_castpd256_pd128(p_value), _mm256_extractf128_pd(p_value, 1));
+}
+
+
+CCORE_SIMD_TARGET("avx2,fma")
+static double euclidean_distance_square_avx2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= p_dimension; i += 8) {
+        const __m256d difference1 = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i), _mm256_loadu_pd(p_point2 + i));
+        const __m256d difference2 = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i + 4), _mm256_loadu_pd(p_point2 + i + 4));
+        sum1 = _mm256_fmadd_pd(difference1, difference1, sum1);
+        sum2 = _mm256_fmadd_pd(difference2, difference2, sum2);
+    }
+
+    if (i + 4 <= p_dimension) {
+        const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i), _mm256_loadu_pd(p_point2 + i));
+        sum1 = _mm256_fmadd_pd(difference, difference, sum1);
+        i += 4;
+    }
+
+    __m128d sum = fold(_mm256_add_pd(sum1, sum2));
+    if (i + 2 <= p_dimension) {
+        const __m128d difference = _mm_sub_pd(_mm_loadu_pd(p_point1 + i), _mm_loadu_pd(p_point2 + i));
+        sum = _mm_fmadd_pd(difference, difference, sum);
+        i += 2;
+    }
+
+    double distance = horizontal_sum(sum);
+    if (i < p_dimension) {
+        const double difference = p_point1[i] - p_point2[i];
+        distance += difference * difference;
+    }
+
+    return distance;
+}
+
+
+CCORE_SIMD_TARGET("avx2,fma")
+static double manhattan_distance_avx2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= p_dimension; i += 8) {
+        const __m256d difference1 = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i), _mm256_loadu_pd(p_point2 + i));
+        const __m256d difference2 = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i + 4), _mm256_loadu_pd(p_point2 + i + 4));
+        sum1 = _mm256_add_pd(sum1, _mm256_andnot_pd(sign_mask, difference1));
+        sum2 = _mm256_add_pd(sum2, _mm256_andnot_pd(sign_mask, difference2));
+    }
+
+    if (i + 4 <= p_dimension) {
+        const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i), _mm256_loadu_pd(p_point2 + i));
+        sum1 = _mm256_add_pd(sum1, _mm256_andnot_pd(sign_mask, difference));
+        i += 4;
+    }
+
+    double distance = horizontal_sum(fold(_mm256_add_pd(sum1, sum2)));
+    for (; i < p_dimension; i++) {
+        distance += std::abs(p_point1[i] - p_point2[i]);
+    }
+
+    return distance;
+}
+
+
+CCORE_SIMD_TARGET("avx2,fma")
+static double chebyshev_distance_avx2(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    const __m256d sign_mask = _mm256_set1_pd(-0.0);
+
+    __m256d maximum = _mm256_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 4 <= p_dimension; i += 4) {
+        const __m256d difference = _mm256_sub_pd(_mm256_loadu_pd(p_point1 + i), _mm256_loadu_pd(p_point2 + i));
+        maximum = _mm256_max_pd(maximum, _mm256_andnot_pd(sign_mask, difference));
+    }
+
+    const __m128d maximum_half = _mm_max_pd(_mm256_castpd256_pd128(maximum), _mm256_extractf128_pd(maximum, 1));
+
+    double distance = horizontal_max(maximum_half);
+    for (; i < p_dimension; i++) {
+        distance = std::max(distance, std::abs(p_point1[i] - p_point2[i]));
+    }
+
+    return distance;
+}
+
+
+/* AVX-512 intrinsics of GCC use intentionally undefined values that are reported as uninitialized */
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wuninitialized"
+    #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+
+CCORE_SIMD_TARGET("avx512f")
+static inline __mmask8 tail_mask(const std::size_t p_length) {
+    return (__mmask8) ((1U << p_length) - 1U);
+}
+
+
+CCORE_SIMD_TARGET("avx512f")
+static double euclidean_distance_square_avx512(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    __m512d sum1 = _mm512_setzero_pd();
+    __m512d sum2 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= p_dimension; i += 16) {
+        const __m512d difference1 = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i), _mm512_loadu_pd(p_point2 + i));
+        const __m512d difference2 = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i + 8), _mm512_loadu_pd(p_point2 + i + 8));
+        sum1 = _mm512_fmadd_pd(difference1, difference1, sum1);
+        sum2 = _mm512_fmadd_pd(difference2, difference2, sum2);
+    }
+
+    if (i + 8 <= p_dimension) {
+        const __m512d difference = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i), _mm512_loadu_pd(p_point2 + i));
+        sum1 = _mm512_fmadd_pd(difference, difference, sum1);
+        i += 8;
+    }
+
+    if (i < p_dimension) {
+        /* masked lanes are loaded as zeros and do not change the sum */
+        const __mmask8 mask = tail_mask(p_dimension - i);
+        const __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, p_point1 + i), _mm512_maskz_loadu_pd(mask, p_point2 + i));
+        sum2 = _mm512_fmadd_pd(difference, difference, sum2);
+    }
+
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum1, sum2));
+}
+
+
+CCORE_SIMD_TARGET("avx512f")
+static double manhattan_distance_avx512(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    __m512d sum1 = _mm512_setzero_pd();
+    __m512d sum2 = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 16 <= p_dimension; i += 16) {
+        const __m512d difference1 = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i), _mm512_loadu_pd(p_point2 + i));
+        const __m512d difference2 = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i + 8), _mm512_loadu_pd(p_point2 + i + 8));
+        sum1 = _mm512_add_pd(sum1, _mm512_abs_pd(difference1));
+        sum2 = _mm512_add_pd(sum2, _mm512_abs_pd(difference2));
+    }
+
+    if (i + 8 <= p_dimension) {
+        const __m512d difference = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i), _mm512_loadu_pd(p_point2 + i));
+        sum1 = _mm512_add_pd(sum1, _mm512_abs_pd(difference));
+        i += 8;
+    }
+
+    if (i < p_dimension) {
+        const __mmask8 mask = tail_mask(p_dimension - i);
+        const __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, p_point1 + i), _mm512_maskz_loadu_pd(mask, p_point2 + i));
+        sum2 = _mm512_add_pd(sum2, _mm512_abs_pd(difference));
+    }
+
+    return _mm512_reduce_add_pd(_mm512_add_pd(sum1, sum2));
+}
+
+
+CCORE_SIMD_TARGET("avx512f")
+static double chebyshev_distance_avx512(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    __m512d maximum = _mm512_setzero_pd();
+
+    std::size_t i = 0;
+    for (; i + 8 <= p_dimension; i += 8) {
+        const __m512d difference = _mm512_sub_pd(_mm512_loadu_pd(p_point1 + i), _mm512_loadu_pd(p_point2 + i));
+        maximum = _mm512_max_pd(maximum, _mm512_abs_pd(difference));
+    }
+
+    if (i < p_dimension) {
+        const __mmask8 mask = tail_mask(p_dimension - i);
+        const __m512d difference = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, p_point1 + i), _mm512_maskz_loadu_pd(mask, p_point2 + i));
+        maximum = _mm512_max_pd(maximum, _mm512_abs_pd(difference));
+    }
+
+    return _mm512_reduce_max_pd(maximum);
+}
+
+
+#if defined(__GNUC__) && !defined(__clang__)
+    #pragma GCC diagnostic pop
+#endif
+
+#endif
+
+
+simd_level get_supported_level(void) {
+#if defined(CCORE_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return simd_level::AVX512;
+    }
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return simd_level::AVX2;
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+        return simd_level::SSE2;
+    }
+#elif defined(CCORE_SIMD_X86) && defined(_MSC_VER)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    const int maximum_leaf = info[0];
+
+    __cpuid(info, 1);
+    const bool sse2 = (info[3] & (1 << 26)) != 0;
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+
+    /* registers should be saved by operating system: YMM for AVX2, YMM, ZMM and opmask for AVX-512 */
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool os_avx = (xcr0 & 0x06) == 0x06;
+    const bool os_avx512 = (xcr0 & 0xE6) == 0xE6;
+
+    bool avx2 = false, avx512f = false;
+    if (maximum_leaf >= 7) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+        avx512f = (info[1] & (1 << 16)) != 0;
+    }
+
+    if (avx512f && os_avx512) {
+        return simd_level::AVX512;
+    }
+
+    if (avx2 && fma && os_avx) {
+        return simd_level::AVX2;
+    }
+
+    if (sse2) {
+        return simd_level::SSE2;
+    }
+#endif
+
+    return simd_level::SCALAR;
+}
+
+
+static kernel_table create_kernel_table(const simd_level p_level) {
+    kernel_table table;
+    table.m_level               = simd_level::SCALAR;
+    table.m_euclidean_square    = euclidean_distance_square_scalar;
+    table.m_manhattan           = manhattan_distance_scalar;
+    table.m_chebyshev           = chebyshev_distance_scalar;
+
+#if defined(CCORE_SIMD_X86)
+    switch(p_level) {
+    case simd_level::AVX512:
+        table.m_level               = simd_level::AVX512;
+        table.m_euclidean_square    = euclidean_distance_square_avx512;
+        table.m_manhattan           = manhattan_distance_avx512;
+        table.m_chebyshev           = chebyshev_distance_avx512;
+        break;
+
+    case simd_level::AVX2:
+        table.m_level               = simd_level::AVX2;
+        table.m_euclidean_square    = euclidean_distance_square_avx2;
+        table.m_manhattan           = manhattan_distance_avx2;
+        table.m_chebyshev           = chebyshev_distance_avx2;
+        break;
+
+    case simd_level::SSE2:
+        table.m_level               = simd_level::SSE2;
+        table.m_euclidean_square    = euclidean_distance_square_sse2;
+        table.m_manhattan           = manhattan_distance_sse2;
+        table.m_chebyshev           = chebyshev_distance_sse2;
+        break;
+
+    default:
+        break;
+    }
+#else
+    (void) p_level;
+#endif
+
+    return table;
+}
+
+
+/* table of each level is created once, switching of the level replaces pointer to the current table */
+static const kernel_table & get_level_table(const simd_level p_level) {
+    static const kernel_table TABLES[] = {
+        create_kernel_table(simd_level::SCALAR),
+        create_kernel_table(simd_level::SSE2),
+        create_kernel_table(simd_level::AVX2),
+        create_kernel_table(simd_level::AVX512)
+    };
+
+    return TABLES[static_cast<std::size_t>(p_level)];
+}
+
+
+static std::atomic<const kernel_table *> CURRENT_TABLE(nullptr);
+
+
+const kernel_table & get_kernels(void) {
+    const kernel_table * table = CURRENT_TABLE.load(std::memory_order_acquire);
+    if (table == nullptr) {
+        const kernel_table * expected = nullptr;
+        table = &get_level_table(get_supported_level());
+
+        if (!CURRENT_TABLE.compare_exchange_strong(expected, table, std::memory_order_acq_rel)) {
+            table = expected;   /* the level has been set by another thread */
+        }
+    }
+
+    return *table;
+}
+
+
+simd_level get_level(void) {
+    return get_kernels().m_level;
+}
+
+
+simd_level set_level(const simd_level p_level) {
+    const simd_level level = std::min(p_level, get_supported_level());
+    CURRENT_TABLE.store(&get_level_table(level), std::memory_order_release);
+    return level;
+}
+
+
+double euclidean_distance_square(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    return get_kernels().m_euclidean_square(p_point1, p_point2, p_dimension);
+}
+
+
+double manhattan_distance(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    return get_kernels().m_manhattan(p_point1, p_point2, p_dimension);
+}
+
+
+double chebyshev_distance(const double * p_point1, const double * p_point2, const std::size_t p_dimension) {
+    return get_kernels().m_chebyshev(p_point1, p_point2, p_dimension);
+}
+
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,159 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <cstddef>
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace metric {
+
+namespace simd {
+
+
+/**
+ *
+ * @brief   Instruction sets that are used by vectorized distance kernels.
+ *
+ */
+enum class simd_level {
+    SCALAR = 0,
+    SSE2,
+    AVX2,
+    AVX512
+};
+
+
+/**
+ *
+ * @brief   Distance kernel for points whose coordinates are stored contiguously.
+ *
+ */
+using kernel_t = double (*)(const double *, const double *, const std::size_t);
+
+
+/**
+ *
+ * @brief   Distance kernels that are compiled for the same instruction set.
+ *
+ */
+struct kernel_table {
+    simd_level  m_level                 = simd_level::SCALAR;
+    kernel_t    m_euclidean_square      = nullptr;
+    kernel_t    m_manhattan             = nullptr;
+    kernel_t    m_chebyshev             = nullptr;
+};
+
+
+/**
+ *
+ * @brief   Returns the best instruction set that is supported by the processor and operating system.
+ *
+ */
+simd_level get_supported_level(void);
+
+
+/**
+ *
+ * @brief   Returns kernels for the current instruction set.
+ * @details Loops over points should take a kernel once before the loop and call it directly, functions
+ *           'euclidean_distance_square', 'manhattan_distance' and 'chebyshev_distance' look it up on each call.
+ *
+ */
+const kernel_table & get_kernels(void);
+
+
+/**
+ *
+ * @brief   Returns instruction set that is currently used by distance kernels.
+ * @details Kernels are selected once when they are used for the first time in line with processor features.
+ *
+ */
+simd_level get_level(void);
+
+
+/**
+ *
+ * @brief   Forces distance kernels to use specific instruction set.
+ * @details The level is limited by the supported level. Kernels are replaced atomically, loops that have already
+ *           taken kernels by 'get_kernels' complete with them (it is used for testing and for benchmarking).
+ *
+ * @param[in] p_level: instruction set that should be used by kernels.
+ *
+ * @return  Instruction set that is actually used by kernels.
+ *
+ */
+simd_level set_level(const simd_level p_level);
+
+
+/**
+ *
+ * @brief   Calculates square of Euclidean distance between points whose coordinates are stored contiguously.
+ *
+ * @param[in] p_point1: pointer to coordinates of point #1.
+ * @param[in] p_point2: pointer to coordinates of point #2.
+ * @param[in] p_dimension: amount of coordinates of each point.
+ *
+ * @return  Returns square of Euclidean distance between points.
+ *
+ */
+double euclidean_distance_square(const double * p_point1, const double * p_point2, const std::size_t p_dimension);
+
+
+/**
+ *
+ * @brief   Calculates Manhattan distance between points whose coordinates are stored contiguously.
+ *
+ * @param[in] p_point1: pointer to coordinates of point #1.
+ * @param[in] p_point2: pointer to coordinates of point #2.
+ * @param[in] p_dimension: amount of coordinates of each point.
+ *
+ * @return  Returns Manhattan distance between points.
+ *
+ */
+double manhattan_distance(const double * p_point1, const double * p_point2, const std::size_t p_dimension);
+
+
+/**
+ *
+ * @brief   Calculates Chebyshev distance between points whose coordinates are stored contiguously.
+ *
+ * @param[in] p_point1: pointer to coordinates of point #1.
+ * @param[in] p_point2: pointer to coordinates of point #2.
+ * @param[in] p_dimension: amount of coordinates of each point.
+ *
+ * @return  Returns Chebyshev distance between points.
+ *
+ */
+double chebyshev_distance(const double * p_point1, const double * p_point2, const std::size_t p_dimension);
+
+
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,42 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+/* Internal header for translation units that contain vectorized kernels. */
+
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define CCORE_SIMD_X86
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+
+/* GCC and Clang compile each kernel for its own instruction set, MSVC allows intrinsics everywhere */
+#if defined(CCORE_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define CCORE_SIMD_TARGET(p_features) __attribute__ ((__target__(p_features)))
+#else
+    #define CCORE_SIMD_TARGET(p_features)
+#endif
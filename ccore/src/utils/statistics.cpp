@@ -0,0 +1,257 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "utils/statistics.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "utils/memory.hpp"
+#include "utils/trace.hpp"
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace statistics {
+
+
+namespace {
+
+
+std::atomic<bool>           ENABLED_BY_DEFAULT(false);
+std::atomic<std::uint64_t>  NEXT_COLLECTOR_ID(1);
+
+
+/* collector of the current thread and the block of counters that the thread uses for it */
+thread_local statistics_collector *     ACTIVE_COLLECTOR    = nullptr;
+thread_local std::uint64_t              CACHED_ID           = 0;
+thread_local performance_statistics *   CACHED_BLOCK        = nullptr;
+
+thread_local performance_statistics     LAST_STATISTICS;
+
+
+const char * const PHASE_NAMES[] = { "process", "update_clusters", "update_centers", "neighbor_search", "simulation" };
+
+
+}
+
+
+const std::size_t performance_statistics::AMOUNT_COUNTERS   = static_cast<std::size_t>(counter_t::AMOUNT_COUNTERS);
+
+const std::size_t performance_statistics::AMOUNT_PHASES     = static_cast<std::size_t>(phase_t::AMOUNT_PHASES);
+
+
+std::uint64_t performance_statistics::get_counter(const counter_t p_counter) const {
+    return m_counters[static_cast<std::size_t>(p_counter)];
+}
+
+
+double performance_statistics::get_phase_time(const phase_t p_phase) const {
+    return m_phases[static_cast<std::size_t>(p_phase)];
+}
+
+
+std::size_t performance_statistics::get_peak_memory(void) const {
+    return m_peak_memory;
+}
+
+
+std::size_t performance_statistics::get_current_memory(void) const {
+    return m_current_memory;
+}
+
+
+void performance_statistics::add_counter(const counter_t p_counter, const std::uint64_t p_value) {
+    m_counters[static_cast<std::size_t>(p_counter)] += p_value;
+}
+
+
+void performance_statistics::add_phase_time(const phase_t p_phase, const double p_time) {
+    m_phases[static_cast<std::size_t>(p_phase)] += p_time;
+}
+
+
+void performance_statistics::set_memory(const std::size_t p_peak, const std::size_t p_current) {
+    m_peak_memory = p_peak;
+    m_current_memory = p_current;
+}
+
+
+void performance_statistics::merge(const performance_statistics & p_other) {
+    for (std::size_t index = 0; index < m_counters.size(); index++) {
+        m_counters[index] += p_other.m_counters[index];
+    }
+
+    for (std::size_t index = 0; index < m_phases.size(); index++) {
+        m_phases[index] += p_other.m_phases[index];
+    }
+
+    m_peak_memory = std::max(m_peak_memory, p_other.m_peak_memory);
+    m_current_memory = std::max(m_current_memory, p_other.m_current_memory);
+}
+
+
+void performance_statistics::clear(void) {
+    m_counters.fill(0);
+    m_phases.fill(0.0);
+    m_peak_memory = 0;
+    m_current_memory = 0;
+}
+
+
+void performance_statistics::set_enabled_by_default(const bool p_enabled) {
+    ENABLED_BY_DEFAULT.store(p_enabled);
+}
+
+
+bool performance_statistics::is_enabled_by_default(void) {
+    return ENABLED_BY_DEFAULT.load();
+}
+
+
+const performance_statistics & performance_statistics::get_last(void) {
+    return LAST_STATISTICS;
+}
+
+
+const char * performance_statistics::get_phase_name(const phase_t p_phase) {
+    return PHASE_NAMES[static_cast<std::size_t>(p_phase)];
+}
+
+
+statistics_collector::statistics_collector(performance_statistics & p_target, const bool p_enabled) {
+    if (!p_enabled) {
+        return;
+    }
+
+    m_target = &p_target;
+    m_target->clear();
+
+    m_id = NEXT_COLLECTOR_ID.fetch_add(1);
+    m_start = clock::now();
+    m_memory_peak.reset(new memory::memory_peak_tracker());
+
+    m_previous = ACTIVE_COLLECTOR;
+    ACTIVE_COLLECTOR = this;
+}
+
+
+statistics_collector::~statistics_collector(void) {
+    if (m_target == nullptr) {
+        return;
+    }
+
+    ACTIVE_COLLECTOR = m_previous;
+
+    /* all threads have completed their iterations because parallel loops wait for them */
+    for (const auto & block : m_blocks) {
+        m_target->merge(block);
+    }
+
+    m_target->set_memory(m_memory_peak->get_peak(), memory::memory_usage::get_current());
+
+    if (m_previous != nullptr) {
+        m_previous->get_thread_block().merge(*m_target);
+    }
+
+    m_target->add_phase_time(phase_t::PROCESS, std::chrono::duration<double>(clock::now() - m_start).count());
+    LAST_STATISTICS = *m_target;
+}
+
+
+statistics_collector * statistics_collector::get_active(void) {
+    return ACTIVE_COLLECTOR;
+}
+
+
+void statistics_collector::increment(const counter_t p_counter, const std::uint64_t p_value) {
+    statistics_collector * collector = ACTIVE_COLLECTOR;
+    if (collector != nullptr) {
+        collector->get_thread_block().add_counter(p_counter, p_value);
+    }
+}
+
+
+void statistics_collector::add_phase_time(const phase_t p_phase, const double p_time) {
+    statistics_collector * collector = ACTIVE_COLLECTOR;
+    if (collector != nullptr) {
+        collector->get_thread_block().add_phase_time(p_phase, p_time);
+    }
+}
+
+
+performance_statistics & statistics_collector::get_thread_block(void) {
+    if (CACHED_ID != m_id) {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_blocks.emplace_back();
+
+        CACHED_BLOCK = &m_blocks.back();
+        CACHED_ID = m_id;
+    }
+
+    return *CACHED_BLOCK;
+}
+
+
+statistics_scope::statistics_scope(statistics_collector * p_collector) :
+    m_previous(ACTIVE_COLLECTOR)
+{
+    ACTIVE_COLLECTOR = p_collector;
+}
+
+
+statistics_scope::~statistics_scope(void) {
+    ACTIVE_COLLECTOR = m_previous;
+}
+
+
+phase_timer::phase_timer(const phase_t p_phase) :
+    m_phase(p_phase),
+    m_active(statistics_collector::get_active() != nullptr),
+    m_traced(trace::tracer::is_enabled())
+{
+    if (m_traced) {
+        trace::tracer::record(performance_statistics::get_phase_name(m_phase), "phase", 'B');
+    }
+
+    if (m_active) {
+        m_start = clock::now();
+    }
+}
+
+
+phase_timer::~phase_timer(void) {
+    if (m_traced) {
+        trace::tracer::record(performance_statistics::get_phase_name(m_phase), "phase", 'E');
+    }
+
+    if (m_active) {
+        statistics_collector::add_phase_time(m_phase, std::chrono::duration<double>(clock::now() - m_start).count());
+    }
+}
+
+
+}
+
+}
+
+}
@@ -0,0 +1,282 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "utils/memory.hpp"
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace statistics {
+
+
+/**
+ *
+ * @brief   Counters of work that is performed by an algorithm.
+ *
+ */
+enum class counter_t : std::size_t {
+    ITERATIONS = 0,             /* iterations of the main loop of an algorithm */
+    DISTANCE_CALCULATIONS,      /* evaluations of a distance metric */
+    NEIGHBOR_QUERIES,           /* radius or nearest neighbor queries */
+    KDTREE_NODES_VISITED,       /* nodes of k-d tree that are visited by queries */
+    SIMULATION_STEPS,           /* steps of simulation of oscillatory network */
+    AMOUNT_COUNTERS
+};
+
+
+/**
+ *
+ * @brief   Phases of an algorithm whose execution time is measured.
+ *
+ */
+enum class phase_t : std::size_t {
+    PROCESS = 0,                /* the whole processing */
+    UPDATE_CLUSTERS,
+    UPDATE_CENTERS,
+    NEIGHBOR_SEARCH,
+    SIMULATION,
+    AMOUNT_PHASES
+};
+
+
+/**
+ *
+ * @brief   Statistics of an algorithm run: values of counters and execution time of phases.
+ *
+ */
+class performance_statistics {
+public:
+    const static std::size_t AMOUNT_COUNTERS;
+    const static std::size_t AMOUNT_PHASES;
+
+private:
+    std::array<std::uint64_t, static_cast<std::size_t>(counter_t::AMOUNT_COUNTERS)>    m_counters  = { };
+    std::array<double, static_cast<std::size_t>(phase_t::AMOUNT_PHASES)>               m_phases    = { };
+    std::size_t                                                                         m_peak_memory       = 0;
+    std::size_t                                                                         m_current_memory    = 0;
+
+public:
+    /**
+     *
+     * @brief   Returns value of the counter.
+     *
+     */
+    std::uint64_t get_counter(const counter_t p_counter) const;
+
+    /**
+     *
+     * @brief   Returns execution time of the phase in seconds.
+     *
+     */
+    double get_phase_time(const phase_t p_phase) const;
+
+    /**
+     *
+     * @brief   Returns maximum amount of bytes that has been used by tracked containers during the run.
+     * @details Each run measures its own peak, but memory is tracked for the whole process, therefore it includes
+     *           containers that were allocated before the run and containers of runs in other threads.
+     *
+     * @see utils::memory::memory_usage
+     *
+     */
+    std::size_t get_peak_memory(void) const;
+
+    /**
+     *
+     * @brief   Returns amount of bytes that is used by tracked containers at the end of the run.
+     *
+     */
+    std::size_t get_current_memory(void) const;
+
+    void add_counter(const counter_t p_counter, const std::uint64_t p_value);
+
+    void add_phase_time(const phase_t p_phase, const double p_time);
+
+    void set_memory(const std::size_t p_peak, const std::size_t p_current);
+
+    /**
+     *
+     * @brief   Adds counters and execution time of phases of another statistics, takes maximum of memory usage.
+     *
+     */
+    void merge(const performance_statistics & p_other);
+
+    void clear(void);
+
+public:
+    /**
+     *
+     * @brief   Defines whether results that are created later collect statistics by default, it is disabled initially.
+     *
+     */
+    static void set_enabled_by_default(const bool p_enabled);
+
+    static bool is_enabled_by_default(void);
+
+    /**
+     *
+     * @brief   Returns statistics of the last collection that has been completed by the current thread.
+     * @details It is used by the C interface where results of algorithms are not available after the call.
+     *
+     */
+    static const performance_statistics & get_last(void);
+
+    /**
+     *
+     * @brief   Returns name of the phase, for example, "update_clusters".
+     *
+     */
+    static const char * get_phase_name(const phase_t p_phase);
+};
+
+
+/**
+ *
+ * @brief   Collects statistics of an algorithm run into the statistics of its result.
+ * @details Collector is created at the beginning of processing and activated for the current thread, parallel loops
+ *           activate it for threads that execute their iterations. Each thread increments its own block of counters
+ *           without synchronization, blocks are merged to the target statistics when the collector is destroyed.
+ *           Nested collector (for example, K-Means inside of X-Means) merges its counters to the outer one as well.
+ *
+ */
+class statistics_collector {
+private:
+    using clock = std::chrono::steady_clock;
+
+private:
+    performance_statistics *            m_target    = nullptr;
+    statistics_collector *              m_previous  = nullptr;
+    std::uint64_t                       m_id        = 0;
+    clock::time_point                   m_start;
+    std::unique_ptr<memory::memory_peak_tracker>    m_memory_peak   = nullptr;
+
+    std::mutex                          m_lock;
+    std::deque<performance_statistics>  m_blocks;   /* deque does not move blocks that are used by threads */
+
+public:
+    /**
+     *
+     * @brief   Creates collector and activates it for the current thread if collection is enabled.
+     *
+     * @param[in] p_target: statistics that receives collected values.
+     * @param[in] p_enabled: if 'false' then the collector does nothing.
+     *
+     */
+    statistics_collector(performance_statistics & p_target, const bool p_enabled);
+
+    statistics_collector(const statistics_collector & p_other) = delete;
+
+    statistics_collector(statistics_collector && p_other) = delete;
+
+    ~statistics_collector(void);
+
+public:
+    /**
+     *
+     * @brief   Returns collector that is active for the current thread or 'nullptr'.
+     *
+     */
+    static statistics_collector * get_active(void);
+
+    /**
+     *
+     * @brief   Increments counter of the active collector, it does nothing if there is no active collector.
+     *
+     */
+    static void increment(const counter_t p_counter, const std::uint64_t p_value = 1);
+
+    /**
+     *
+     * @brief   Adds execution time of the phase to the active collector.
+     *
+     */
+    static void add_phase_time(const phase_t p_phase, const double p_time);
+
+private:
+    performance_statistics & get_thread_block(void);
+};
+
+
+/**
+ *
+ * @brief   Activates collector for the current thread until the end of the scope.
+ * @details It is used by parallel loops to collect statistics of iterations that are executed by worker threads.
+ *
+ */
+class statistics_scope {
+private:
+    statistics_collector *  m_previous = nullptr;
+
+public:
+    explicit statistics_scope(statistics_collector * p_collector);
+
+    statistics_scope(const statistics_scope & p_other) = delete;
+
+    statistics_scope(statistics_scope && p_other) = delete;
+
+    ~statistics_scope(void);
+};
+
+
+/**
+ *
+ * @brief   Measures execution time of the phase until the end of the scope if there is an active collector.
+ * @details The phase is recorded to the timeline if tracing is enabled.
+ *
+ */
+class phase_timer {
+private:
+    using clock = std::chrono::steady_clock;
+
+private:
+    phase_t             m_phase;
+    bool                m_active;
+    bool                m_traced;
+    clock::time_point   m_start;
+
+public:
+    explicit phase_timer(const phase_t p_phase);
+
+    phase_timer(const phase_timer & p_other) = delete;
+
+    phase_timer(phase_timer && p_other) = delete;
+
+    ~phase_timer(void);
+};
+
+
+}
+
+}
+
+}
@@ -0,0 +1,203 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#include "utils/trace.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace trace {
+
+
+namespace {
+
+
+std::mutex                                      BUFFERS_LOCK;
+std::vector<std::shared_ptr<tracer::thread_buffer>>    BUFFERS;   /* buffers outlive threads that have written them */
+std::size_t                                     NEXT_THREAD_ID  = 1;
+
+std::string                                     OUTPUT_PATH;
+std::atomic<tracer::clock::rep>                 START_TIME(0);
+
+
+thread_local std::shared_ptr<tracer::thread_buffer>    THREAD_BUFFER = nullptr;
+
+
+/* tracing that is requested by environment variable lasts for the whole lifetime of the library */
+class environment_tracing {
+public:
+    environment_tracing(void) {
+        const char * path = std::getenv(tracer::ENVIRONMENT_VARIABLE);
+        if ((path != nullptr) && (*path != '\0')) {
+            tracer::start(path);
+        }
+    }
+
+    ~environment_tracing(void) {
+        tracer::stop();
+    }
+};
+
+
+void write_string(const std::string & p_value, std::ostream & p_stream) {
+    p_stream << '"';
+    for (const char symbol : p_value) {
+        if ((symbol == '"') || (symbol == '\\')) {
+            p_stream << '\\';
+        }
+
+        p_stream << symbol;
+    }
+
+    p_stream << '"';
+}
+
+
+}
+
+
+const char * const tracer::ENVIRONMENT_VARIABLE = "CCORE_TRACE_FILE";
+
+std::atomic<bool> tracer::m_enabled(false);
+
+
+void tracer::start(const std::string & p_path) {
+    std::lock_guard<std::mutex> guard(BUFFERS_LOCK);
+
+    /* buffers of threads that have been finished are not used anymore */
+    BUFFERS.erase(std::remove_if(BUFFERS.begin(), BUFFERS.end(), [](const std::shared_ptr<thread_buffer> & p_buffer) {
+        return p_buffer.use_count() == 1;
+    }), BUFFERS.end());
+
+    for (auto & buffer : BUFFERS) {
+        std::lock_guard<std::mutex> buffer_guard(buffer->m_lock);
+        buffer->m_events.clear();
+    }
+
+    OUTPUT_PATH = p_path;
+    START_TIME.store(clock::now().time_since_epoch().count());
+    m_enabled.store(true);
+}
+
+
+bool tracer::stop(void) {
+    if (!m_enabled.exchange(false)) {
+        return false;
+    }
+
+    std::ofstream stream(OUTPUT_PATH);
+    if (!stream.is_open()) {
+        return false;
+    }
+
+    write(stream);
+    return stream.good();
+}
+
+
+void tracer::record(const char * p_name, const char * p_category, const char p_phase) {
+    thread_buffer & buffer = get_thread_buffer();
+
+    const clock::time_point start = clock::time_point(clock::duration(START_TIME.load(std::memory_order_relaxed)));
+    const double time = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+
+    std::lock_guard<std::mutex> guard(buffer.m_lock);   /* the lock is contended only while events are written */
+    buffer.m_events.push_back({ p_name, p_category, p_phase, time });
+}
+
+
+void tracer::set_thread_name(const std::string & p_name) {
+    thread_buffer & buffer = get_thread_buffer();
+
+    std::lock_guard<std::mutex> guard(buffer.m_lock);
+    buffer.m_thread_name = p_name;
+}
+
+
+void tracer::write(std::ostream & p_stream) {
+    std::lock_guard<std::mutex> guard(BUFFERS_LOCK);
+
+    p_stream << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    bool first = true;
+    const auto separate = [&first, &p_stream]() {
+        p_stream << (first ? "\n" : ",\n");
+        first = false;
+    };
+
+    for (auto & buffer : BUFFERS) {
+        std::lock_guard<std::mutex> buffer_guard(buffer->m_lock);
+
+        if (!buffer->m_thread_name.empty()) {
+            separate();
+            p_stream << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->m_thread_id
+                     << ", \"args\": {\"name\": ";
+            write_string(buffer->m_thread_name, p_stream);
+            p_stream << "}}";
+        }
+
+        for (const auto & event : buffer->m_events) {
+            separate();
+            p_stream << "{\"name\": ";
+            write_string(event.m_name, p_stream);
+            p_stream << ", \"cat\": ";
+            write_string(event.m_category, p_stream);
+            p_stream << ", \"ph\": \"" << event.m_phase << "\", \"ts\": " << std::fixed << event.m_time
+                     << std::defaultfloat << ", \"pid\": 1, \"tid\": " << buffer->m_thread_id << "}";
+        }
+    }
+
+    p_stream << "\n]}\n";
+}
+
+
+tracer::thread_buffer & tracer::get_thread_buffer(void) {
+    if (THREAD_BUFFER == nullptr) {
+        THREAD_BUFFER = std::make_shared<thread_buffer>();
+
+        std::lock_guard<std::mutex> guard(BUFFERS_LOCK);
+        THREAD_BUFFER->m_thread_id = NEXT_THREAD_ID++;
+        BUFFERS.push_back(THREAD_BUFFER);
+    }
+
+    return *THREAD_BUFFER;
+}
+
+
+namespace {
+
+
+environment_tracing ENVIRONMENT_TRACING;
+
+
+}
+
+
+}
+
+}
+
+}
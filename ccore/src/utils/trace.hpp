@@ -0,0 +1,172 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+#pragma once
+
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace ccore {
+
+namespace utils {
+
+namespace trace {
+
+
+/**
+ *
+ * @brief   Records begin and end events of algorithm phases, parallel chunks, pool tasks and ODE integration and
+ *           writes them in Chrome trace-event format (it can be opened by 'chrome://tracing' or Perfetto UI).
+ * @details Tracing is disabled by default. It is enabled by 'start' or by environment variable 'CCORE_TRACE_FILE'
+ *           that contains path to the output file, in the last case the file is written when the library is unloaded.
+ *           Each thread stores its events into its own buffer, therefore recording does not synchronize threads.
+ *           Names of events should be string literals because only pointers to them are stored.
+ *
+ */
+class tracer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     *
+     * @brief   Name of environment variable with path to the trace file.
+     *
+     */
+    const static char * const ENVIRONMENT_VARIABLE;
+
+public:
+    struct event {
+        const char *    m_name      = nullptr;
+        const char *    m_category  = nullptr;
+        char            m_phase     = 'B';      /* 'B' - begin, 'E' - end */
+        double          m_time      = 0.0;      /* microseconds since start of tracing */
+    };
+
+    struct thread_buffer {
+        std::mutex          m_lock;
+        std::size_t         m_thread_id = 0;
+        std::string         m_thread_name;
+        std::vector<event>  m_events;
+    };
+
+private:
+    static std::atomic<bool>    m_enabled;
+
+public:
+    /**
+     *
+     * @brief   Starts recording of events, events that have been recorded before are discarded.
+     *
+     * @param[in] p_path: path to the file that is written by 'stop'.
+     *
+     */
+    static void start(const std::string & p_path);
+
+    /**
+     *
+     * @brief   Stops recording and writes events to the file that has been specified by 'start'.
+     *
+     * @return  Returns 'false' if tracing has not been started or the file cannot be written.
+     *
+     */
+    static bool stop(void);
+
+    /**
+     *
+     * @brief   Returns 'true' if events are recorded.
+     *
+     */
+    static bool is_enabled(void) {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     *
+     * @brief   Records event for the current thread.
+     *
+     */
+    static void record(const char * p_name, const char * p_category, const char p_phase);
+
+    /**
+     *
+     * @brief   Sets name of the current thread that is shown in the timeline.
+     *
+     */
+    static void set_thread_name(const std::string & p_name);
+
+    /**
+     *
+     * @brief   Writes recorded events in trace-event JSON format.
+     *
+     */
+    static void write(std::ostream & p_stream);
+
+private:
+    static thread_buffer & get_thread_buffer(void);
+};
+
+
+/**
+ *
+ * @brief   Records begin event at construction and end event at destruction if tracing is enabled.
+ *
+ */
+class trace_scope {
+private:
+    const char *    m_name;
+    const char *    m_category;
+    bool            m_active;
+
+public:
+    trace_scope(const char * p_name, const char * p_category) :
+        m_name(p_name),
+        m_category(p_category),
+        m_active(tracer::is_enabled())
+    {
+        if (m_active) {
+            tracer::record(m_name, m_category, 'B');
+        }
+    }
+
+    trace_scope(const trace_scope & p_other) = delete;
+
+    trace_scope(trace_scope && p_other) = delete;
+
+    ~trace_scope(void) {
+        if (m_active) {
+            tracer::record(m_name, m_category, 'E');
+        }
+    }
+};
+
+
+}
+
+}
+
+}
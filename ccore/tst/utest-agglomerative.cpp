@@ -22,12 +22,14 @@
 #include "gtest/gtest.h"
 
 #include "cluster/agglomerative.hpp"
+#include "parallel/execution_context.hpp"
 #include "samples.hpp"
 
 #include <algorithm>
 
 
 using namespace ccore::clst;
+using namespace ccore::parallel;
 
 
 static void
@@ -181,3 +183,22 @@ TEST(utest_agglomerative, clustering_sampl_simple_03_one_cluster_link_single) {
     std::vector<size_t> expected_clusters_length_2 = {60};
     template_length_process_data(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), 1, type_link::SINGLE_LINK, expected_clusters_length_2);
 }
+
+
+TEST(utest_agglomerative, cancelled_processing) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    cancellation_token token;
+    token.cancel();
+
+    execution_context context;
+    context.set_cancellation_token(token);
+    execution_context_scope scope(context);
+
+    agglomerative solver(2, type_link::AVERAGE_LINK);
+
+    cluster_data results_data;
+    solver.process(*sample, results_data);
+
+    ASSERT_EQ(sample->size(), results_data.clusters().size());
+}
@@ -22,12 +22,14 @@
 #include "gtest/gtest.h"
 
 #include "cluster/cure.hpp"
+#include "parallel/execution_context.hpp"
 
 #include "samples.hpp"
 #include "utenv_check.hpp"
 
 
 using namespace ccore::clst;
+using namespace ccore::parallel;
 
 
 static void
@@ -170,4 +172,23 @@ TEST(utest_cure, allocation_two_diamonds) {
 TEST(utest_cure, allocation_wing_nut) {
     const std::vector<size_t> expected_clusters_length = { 508, 508 };
     template_length_process_data(fcps_sample_factory::create_sample(FCPS_SAMPLE::WING_NUT), 2, 3, 0.3, expected_clusters_length);
-}
\ No newline at end of file
+}
+
+
+TEST(utest_cure, cancelled_processing) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    cancellation_token token;
+    token.cancel();
+
+    execution_context context;
+    context.set_cancellation_token(token);
+    execution_context_scope scope(context);
+
+    cure solver(2, 1, 0.5);
+
+    cure_data output_result;
+    solver.process(*sample, output_result);
+
+    ASSERT_CLUSTER_SIZES(*sample, output_result.clusters(), std::vector<size_t>(sample->size(), 1));
+}
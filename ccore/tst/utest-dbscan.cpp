@@ -29,6 +29,8 @@
 
 #include "utenv_check.hpp"
 
+#include <algorithm>
+
 
 using namespace ccore::clst;
 using namespace ccore::utils::metric;
@@ -278,3 +280,161 @@ TEST(utest_dbscan, noise_cluster_allocation_sample_simple_02_distance_matrix) {
     const std::vector<size_t> expected_clusters_length = { 10 };
     template_noise_allocation_distance_matrix(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), 2.0, 9, expected_clusters_length, 13);
 }
+
+
+TEST(utest_dbscan, allocation_sample_simple_02_dense_dataset) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02);
+
+    dbscan_data expected_result;
+    dbscan(1.0, 2).process(*data, expected_result);
+
+    dbscan_data actual_result;
+    dbscan(1.0, 2).process(ccore::container::dense_dataset(*data), actual_result);
+
+    ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+    ASSERT_EQ(expected_result.noise(), actual_result.noise());
+}
+
+
+template <typename TypeValue>
+static void
+template_length_process_pairwise_matrix(const std::shared_ptr<dataset> & p_data,
+        const double p_radius,
+        const size_t p_neighbors,
+        const std::vector<size_t> & p_expected_cluster_length,
+        const ccore::container::distance_matrix_layout p_layout)
+{
+    const ccore::container::dense_dataset points(*p_data);
+    const auto matrix = ccore::container::pairwise_distance_matrix<TypeValue>::create(points, distance_metric_factory<point>::euclidean(), p_layout);
+
+    dbscan_data output_result;
+    dbscan solver(p_radius, p_neighbors);
+    solver.process(matrix, output_result);
+
+    ASSERT_CLUSTER_SIZES(*p_data, output_result.clusters(), p_expected_cluster_length);
+}
+
+
+TEST(utest_dbscan, allocation_sample_simple_03_condensed_matrix) {
+    const std::vector<size_t> expected_clusters_length = { 10, 10, 10, 30 };
+    template_length_process_pairwise_matrix<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), 0.7, 3, expected_clusters_length, ccore::container::distance_matrix_layout::CONDENSED);
+}
+
+
+TEST(utest_dbscan, allocation_sample_simple_03_condensed_float_matrix) {
+    const std::vector<size_t> expected_clusters_length = { 10, 10, 10, 30 };
+    template_length_process_pairwise_matrix<float>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), 0.7, 3, expected_clusters_length, ccore::container::distance_matrix_layout::CONDENSED);
+}
+
+
+TEST(utest_dbscan, allocation_sample_simple_02_square_matrix) {
+    const std::vector<size_t> expected_clusters_length = { 10, 5, 8 };
+    template_length_process_pairwise_matrix<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), 1.0, 2, expected_clusters_length, ccore::container::distance_matrix_layout::SQUARE);
+}
+
+
+TEST(utest_dbscan, spatial_index_identical_results) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+
+    dbscan_data result_static, result_dynamic;
+
+    dbscan solver(0.5, 3);
+    ASSERT_EQ(ccore::container::spatial_index_t::KDTREE_STATIC, solver.get_spatial_index());
+    solver.process(*sample, result_static);
+
+    solver.set_spatial_index(ccore::container::spatial_index_t::KDTREE);
+    solver.process(*sample, result_dynamic);
+
+    for (auto result : { &result_static, &result_dynamic }) {
+        for (auto & cluster : result->clusters()) {
+            std::sort(cluster.begin(), cluster.end());
+        }
+    }
+
+    ASSERT_EQ(result_dynamic.clusters(), result_static.clusters());
+    ASSERT_EQ(result_dynamic.noise(), result_static.noise());
+}
+
+
+TEST(utest_dbscan, neighbor_graph_reuse) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    const ccore::container::neighbor_graph graph(ccore::container::dense_dataset(*sample), 0.5);
+
+    for (const std::size_t neighbors : { 1, 3, 10 }) {
+        dbscan_data expected_result, actual_result;
+        dbscan(0.5, neighbors).process(*sample, expected_result);
+        dbscan(0.5, neighbors).process(graph, actual_result);
+
+        ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+        ASSERT_EQ(expected_result.noise(), actual_result.noise());
+    }
+}
+
+
+TEST(utest_dbscan, neighbor_graph_bigger_radius) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    const ccore::container::neighbor_graph graph(ccore::container::dense_dataset(*sample), 1.0, true);
+
+    for (const double radius : { 0.3, 0.5 }) {
+        dbscan_data expected_result, actual_result;
+        dbscan(radius, 3).process(*sample, expected_result);
+        dbscan(radius, 3).process(graph, actual_result);
+
+        for (auto result : { &expected_result, &actual_result }) {
+            for (auto & cluster : result->clusters()) {
+                std::sort(cluster.begin(), cluster.end());
+            }
+
+            std::sort(result->clusters().begin(), result->clusters().end());
+            std::sort(result->noise().begin(), result->noise().end());
+        }
+
+        ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+        ASSERT_EQ(expected_result.noise(), actual_result.noise());
+    }
+}
+
+
+TEST(utest_dbscan, neighbor_graph_wrong_arguments) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    const ccore::container::dense_dataset data(*sample);
+
+    dbscan_data result;
+    ASSERT_THROW(dbscan(0.5, 3).process(ccore::container::neighbor_graph(data, 1.0, false), result), std::invalid_argument);
+    ASSERT_THROW(dbscan(0.5, 3).process(ccore::container::neighbor_graph(data, 0.4, true), result), std::invalid_argument);
+}
+
+
+TEST(utest_dbscan, vptree_non_euclidean_metric) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+
+    for (const auto & metric : { distance_metric_factory<point>::manhattan(), distance_metric_factory<point>::chebyshev() }) {
+        dataset matrix(sample->size(), point(sample->size()));
+        for (std::size_t i = 0; i < sample->size(); i++) {
+            for (std::size_t j = 0; j < sample->size(); j++) {
+                matrix[i][j] = metric((*sample)[i], (*sample)[j]);
+            }
+        }
+
+        dbscan_data expected_result, actual_result;
+
+        dbscan solver(0.5, 3);
+        solver.set_metric(metric);
+        ASSERT_EQ(metric.get_type(), solver.get_metric().get_type());
+        ASSERT_THROW(solver.process(*sample, actual_result), std::invalid_argument);
+
+        solver.process(matrix, dbscan_data_t::DISTANCE_MATRIX, expected_result);
+
+        solver.set_spatial_index(ccore::container::spatial_index_t::VPTREE);
+        solver.process(*sample, actual_result);
+
+        for (auto result : { &expected_result, &actual_result }) {
+            for (auto & cluster : result->clusters()) {
+                std::sort(cluster.begin(), cluster.end());
+            }
+        }
+
+        ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+        ASSERT_EQ(expected_result.noise(), actual_result.noise());
+    }
+}
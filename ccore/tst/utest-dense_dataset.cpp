@@ -0,0 +1,174 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "container/dense_dataset.hpp"
+
+#include "utils/metric.hpp"
+
+#include "samples.hpp"
+
+
+using namespace ccore::container;
+using namespace ccore::utils::metric;
+
+
+TEST(utest_dense_dataset, create_empty) {
+    dense_dataset data;
+
+    ASSERT_TRUE(data.empty());
+    ASSERT_EQ(0U, data.size());
+    ASSERT_EQ(0U, data.dimension());
+}
+
+
+TEST(utest_dense_dataset, create_zero) {
+    dense_dataset data(4, 3);
+
+    ASSERT_EQ(4U, data.size());
+    ASSERT_EQ(3U, data.dimension());
+    ASSERT_EQ(3U, data.stride());
+
+    for (std::size_t i = 0; i < data.size(); i++) {
+        for (std::size_t j = 0; j < data.dimension(); j++) {
+            ASSERT_EQ(0.0, data.at(i, j));
+        }
+    }
+}
+
+
+TEST(utest_dense_dataset, create_from_dataset) {
+    dataset_ptr sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    dense_dataset data(*sample);
+
+    ASSERT_EQ(sample->size(), data.size());
+    ASSERT_EQ(sample->at(0).size(), data.dimension());
+
+    for (std::size_t i = 0; i < data.size(); i++) {
+        const point_view view = data.row(i);
+
+        ASSERT_EQ(sample->at(i).size(), view.size());
+        ASSERT_TRUE(std::equal(view.begin(), view.end(), sample->at(i).begin()));
+        ASSERT_EQ(data.data() + i * data.stride(), view.data());
+    }
+
+    dataset restored;
+    data.extract(restored);
+    ASSERT_EQ(*sample, restored);
+}
+
+
+TEST(utest_dense_dataset, create_from_irregular_dataset) {
+    ASSERT_THROW(dense_dataset(dataset({ { 1.0, 2.0 }, { 1.0 } })), std::invalid_argument);
+}
+
+
+TEST(utest_dense_dataset, modify_coordinates) {
+    dense_dataset data(2, 2);
+    data.at(1, 0) = 3.0;
+    data.at(1, 1) = 4.0;
+
+    ASSERT_EQ(3.0, data[1][0]);
+    ASSERT_EQ(4.0, data[1][1]);
+}
+
+
+TEST(utest_dense_dataset, metric_point_view) {
+    dense_dataset data(dataset({ { 0.0, 0.0 }, { 3.0, 4.0 } }));
+
+    ASSERT_EQ(5.0, euclidean_distance(data.row(0), data.row(1)));
+    ASSERT_EQ(25.0, euclidean_distance_square(data.row(0), data.row(1)));
+    ASSERT_EQ(7.0, manhattan_distance(data.row(0), data.row(1)));
+    ASSERT_EQ(4.0, chebyshev_distance(data.row(0), data.row(1)));
+    ASSERT_EQ(25.0, euclidean_distance_square(point({ 3.0, 4.0 }), data.row(0)));
+}
+
+
+TEST(utest_dense_dataset, distance_metric_point_view) {
+    dense_dataset data(dataset({ { 0.0, 0.0 }, { 3.0, 4.0 } }));
+
+    ASSERT_EQ(5.0, distance_metric_factory<point>::euclidean()(data.row(0), data.row(1)));
+    ASSERT_EQ(25.0, distance_metric_factory<point>::euclidean_square()(point({ 0.0, 0.0 }), data.row(1)));
+    ASSERT_EQ(7.0, distance_metric_factory<point>::manhattan()(data.row(1), point({ 0.0, 0.0 })));
+    ASSERT_EQ(4.0, distance_metric_factory<point>::chebyshev()(data.row(0), data.row(1)));
+    ASSERT_EQ(5.0, distance_metric_factory<point>::minkowski(2)(data.row(0), data.row(1)));
+
+    distance_metric<point> metric = distance_metric_factory<point>::user_defined([](const point & p1, const point & p2) { 
+        return p1[0] + p2[1];
+    });
+
+    ASSERT_EQ(4.0, metric(data.row(0), data.row(1)));
+}
+
+
+TEST(utest_dense_dataset, create_view) {
+    double buffer[] = { 1.0, 2.0, -1.0, 3.0, 4.0, -1.0, 5.0, 6.0, -1.0 };
+    dense_dataset data(buffer, 3, 2, 3);
+
+    ASSERT_TRUE(data.is_view());
+    ASSERT_EQ(3U, data.size());
+    ASSERT_EQ(2U, data.dimension());
+    ASSERT_EQ(3U, data.stride());
+    ASSERT_EQ(buffer, data.data());
+
+    ASSERT_EQ(point({ 3.0, 4.0 }), point(data.row(1).begin(), data.row(1).end()));
+
+    data.at(2, 1) = 7.0;
+    ASSERT_EQ(7.0, buffer[7]);
+
+    dataset restored;
+    data.extract(restored);
+    ASSERT_EQ(dataset({ { 1.0, 2.0 }, { 3.0, 4.0 }, { 5.0, 7.0 } }), restored);
+}
+
+
+TEST(utest_dense_dataset, create_view_invalid_stride) {
+    double buffer[] = { 1.0, 2.0, 3.0, 4.0 };
+    ASSERT_THROW(dense_dataset(buffer, 2, 2, 1), std::invalid_argument);
+}
+
+
+TEST(utest_dense_dataset, copy_and_move) {
+    double buffer[] = { 1.0, 2.0, 3.0, 4.0 };
+    dense_dataset view(buffer, 2, 2, 2);
+
+    dense_dataset view_copy(view);
+    ASSERT_TRUE(view_copy.is_view());
+    ASSERT_EQ(buffer, view_copy.data());
+
+    dense_dataset owner(dataset({ { 1.0, 2.0 }, { 3.0, 4.0 } }));
+    dense_dataset owner_copy(owner);
+    ASSERT_FALSE(owner_copy.is_view());
+    ASSERT_NE(owner.data(), owner_copy.data());
+
+    owner_copy.at(0, 0) = 10.0;
+    ASSERT_EQ(1.0, owner.at(0, 0));
+
+    const double * owner_buffer = owner.data();
+    dense_dataset owner_moved(std::move(owner));
+    ASSERT_EQ(owner_buffer, owner_moved.data());
+    ASSERT_TRUE(owner.empty());
+
+    owner = view;
+    ASSERT_TRUE(owner.is_view());
+    ASSERT_EQ(buffer, owner.data());
+}
@@ -0,0 +1,318 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "parallel/execution_context.hpp"
+#include "parallel/parallel.hpp"
+#include "parallel/work_stealing_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+
+using namespace ccore::parallel;
+
+
+static std::set<std::thread::id> collect_loop_threads(const std::size_t p_length) {
+    std::set<std::thread::id> threads;
+    std::mutex threads_lock;
+
+    parallel_for(std::size_t(0), p_length, [&threads, &threads_lock](const std::size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        std::lock_guard<std::mutex> guard(threads_lock);
+        threads.insert(std::this_thread::get_id());
+    });
+
+    return threads;
+}
+
+
+TEST(utest_execution_context, default_context) {
+    const execution_context context;
+    ASSERT_FALSE(context.is_serial());
+    ASSERT_TRUE(context.get_affinity().empty());
+    ASSERT_EQ(execution_context::get_hardware_thread_count(), context.get_thread_count());
+
+    ASSERT_EQ(nullptr, execution_context::get_active());
+    ASSERT_EQ(execution_context::get_default().get_thread_count(), execution_context::get_current_thread_count());
+}
+
+
+TEST(utest_execution_context, serial_context) {
+    const execution_context context(8, true);
+    ASSERT_EQ(1U, context.get_thread_count());
+
+    execution_context_scope scope(context);
+    ASSERT_EQ(&context, execution_context::get_active());
+
+    const std::set<std::thread::id> threads = collect_loop_threads(200);
+    ASSERT_EQ(1U, threads.size());
+    ASSERT_EQ(std::this_thread::get_id(), *threads.begin());
+}
+
+
+TEST(utest_execution_context, limited_thread_count) {
+    const execution_context context(2);
+    execution_context_scope scope(context);
+
+    ASSERT_GE(2U, collect_loop_threads(200).size());
+}
+
+
+TEST(utest_execution_context, nested_loops_use_context) {
+    const execution_context outer_context(2);
+    const execution_context serial_context(0, true);
+
+    execution_context_scope outer_scope(outer_context);
+
+    std::mutex lock;
+    std::size_t amount_inner_threads = 0;
+
+    parallel_for(std::size_t(0), std::size_t(4), [&](const std::size_t) {
+        ASSERT_EQ(&outer_context, execution_context::get_active());
+
+        execution_context_scope inner_scope(serial_context);
+        const std::size_t amount_threads = collect_loop_threads(20).size();
+
+        std::lock_guard<std::mutex> guard(lock);
+        amount_inner_threads = std::max(amount_inner_threads, amount_threads);
+    });
+
+    ASSERT_EQ(1U, amount_inner_threads);
+    ASSERT_EQ(&outer_context, execution_context::get_active());
+}
+
+
+TEST(utest_execution_context, scope_restores_context) {
+    const execution_context context1(2), context2(3);
+    {
+        execution_context_scope scope1(context1);
+        {
+            execution_context_scope scope2(context2);
+            ASSERT_EQ(3U, execution_context::get_current_thread_count());
+        }
+
+        ASSERT_EQ(2U, execution_context::get_current_thread_count());
+    }
+
+    ASSERT_EQ(nullptr, execution_context::get_active());
+}
+
+
+TEST(utest_execution_context, change_default_context) {
+    const execution_context previous = execution_context::get_default();
+
+    execution_context::set_default(execution_context(2));
+    ASSERT_EQ(2U, execution_context::get_current_thread_count());
+    ASSERT_EQ(1U, work_stealing_pool::get_instance()->size());
+    ASSERT_GE(2U, collect_loop_threads(100).size());
+
+    execution_context::set_default(execution_context(0, true));
+    ASSERT_EQ(1U, execution_context::get_current_thread_count());
+    ASSERT_EQ(0U, work_stealing_pool::get_instance()->size());
+    ASSERT_EQ(1U, collect_loop_threads(100).size());
+
+    execution_context::set_default(previous);
+    ASSERT_EQ(previous.get_thread_count(), execution_context::get_current_thread_count());
+    ASSERT_EQ(previous.get_thread_count() - 1, work_stealing_pool::get_instance()->size());
+}
+
+
+TEST(utest_execution_context, change_default_context_during_loop) {
+    const execution_context previous = execution_context::get_default();
+    execution_context::set_default(execution_context(4));
+
+    std::atomic<std::size_t> processed(0);
+    std::atomic<bool> started(false);
+
+    std::thread loop_thread([&processed, &started]() {
+        parallel_for(std::size_t(0), std::size_t(200), [&processed, &started](const std::size_t) {
+            started.store(true);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            processed.fetch_add(1);
+        });
+    });
+
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+
+    /* the pool that executes the loop is replaced, the loop is completed by the previous one */
+    execution_context::set_default(execution_context(2));
+    loop_thread.join();
+
+    ASSERT_EQ(200U, processed.load());
+    ASSERT_EQ(1U, work_stealing_pool::get_instance()->size());
+
+    execution_context::set_default(previous);
+}
+
+
+TEST(utest_execution_context, unsupported_affinity) {
+    execution_context context;
+    context.set_affinity({ 0, 1000000 });
+
+    ASSERT_THROW(execution_context::set_default(context), std::invalid_argument);
+    ASSERT_TRUE(execution_context::get_default().get_affinity().empty());
+}
+
+
+#if defined(__linux__)
+TEST(utest_execution_context, worker_affinity) {
+    const execution_context previous = execution_context::get_default();
+
+    execution_context context(3);
+    context.set_affinity({ 0 });
+    execution_context::set_default(context);
+
+    ASSERT_EQ(std::vector<std::size_t>({ 0 }), work_stealing_pool::get_instance()->get_affinity());
+
+    /* the caller is not a worker, therefore it is not bound */
+    const std::thread::id caller = std::this_thread::get_id();
+
+    std::mutex lock;
+    bool bound = true;
+    parallel_for(std::size_t(0), std::size_t(100), [caller, &lock, &bound](const std::size_t) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        if (std::this_thread::get_id() != caller) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            sched_getaffinity(0, sizeof(cpu_set_t), &cpus);
+
+            std::lock_guard<std::mutex> guard(lock);
+            bound &= (CPU_COUNT(&cpus) == 1) && CPU_ISSET(0, &cpus);
+        }
+    });
+
+    ASSERT_TRUE(bound);
+
+    execution_context::set_default(previous);
+    ASSERT_TRUE(work_stealing_pool::get_instance()->get_affinity().empty());
+}
+#endif
+
+
+TEST(utest_execution_context, cancellation_token_shared_state) {
+    cancellation_token token;
+    cancellation_token copy = token;
+
+    ASSERT_FALSE(token.is_cancelled());
+    copy.cancel();
+
+    ASSERT_TRUE(token.is_cancelled());
+    ASSERT_TRUE(copy.is_cancelled());
+}
+
+
+TEST(utest_execution_context, cancellation_token_deadline) {
+    cancellation_token token;
+
+    token.set_timeout(3600.0);
+    ASSERT_FALSE(token.is_cancelled());
+
+    token.set_deadline(cancellation_token::clock::now() - std::chrono::seconds(1));
+    ASSERT_TRUE(token.is_cancelled());
+}
+
+
+TEST(utest_execution_context, cancellation_token_huge_timeout) {
+    for (const double timeout : { 1e20, std::numeric_limits<double>::max(), std::numeric_limits<double>::infinity() }) {
+        cancellation_token token;
+
+        token.set_timeout(timeout);
+        ASSERT_FALSE(token.is_cancelled());
+    }
+
+    cancellation_token token;
+    token.set_timeout(0.0);
+    ASSERT_TRUE(token.is_cancelled());
+}
+
+
+TEST(utest_execution_context, cancellation_token_wrong_timeout) {
+    cancellation_token token;
+
+    ASSERT_THROW(token.set_timeout(-1.0), std::invalid_argument);
+    ASSERT_THROW(token.set_timeout(-std::numeric_limits<double>::infinity()), std::invalid_argument);
+    ASSERT_THROW(token.set_timeout(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+    ASSERT_FALSE(token.is_cancelled());
+}
+
+
+TEST(utest_execution_context, cancellation_requires_scope) {
+    cancellation_token token;
+    token.cancel();
+
+    execution_context context;
+    context.set_cancellation_token(token);
+
+    ASSERT_FALSE(execution_context::is_cancellation_requested());
+
+    execution_context_scope scope(context);
+    ASSERT_TRUE(execution_context::is_cancellation_requested());
+
+    std::size_t counter = 0;
+    parallel_for(std::size_t(0), std::size_t(100), [&counter](const std::size_t) { counter++; }, schedule(schedule_policy::STATIC, 100));
+    ASSERT_EQ(100U, counter);
+
+    cancellation_scope cancellation;
+    ASSERT_THROW(parallel_for(std::size_t(0), std::size_t(100), [](const std::size_t) { }), operation_cancelled);
+}
+
+
+TEST(utest_execution_context, cancel_running_loop) {
+    cancellation_token token;
+
+    execution_context context(4);
+    context.set_cancellation_token(token);
+
+    execution_context_scope scope(context);
+    cancellation_scope cancellation;
+
+    std::atomic<std::size_t> executed(0);
+    for (const auto policy : { schedule_policy::STATIC, schedule_policy::DYNAMIC, schedule_policy::GUIDED }) {
+        executed = 0;
+
+        ASSERT_THROW(parallel_for(std::size_t(0), std::size_t(10000), [&token, &executed](const std::size_t p_index) {
+            if (p_index == 0) {
+                token.cancel();
+            }
+
+            executed++;
+        }, schedule(policy)), operation_cancelled);
+
+        ASSERT_LT(executed.load(), 10000U);
+    }
+}
@@ -22,9 +22,11 @@
 #include "gtest/gtest.h"
 
 #include "cluster/hsyncnet.hpp"
+#include "parallel/execution_context.hpp"
 
 
 using namespace ccore::clst;
+using namespace ccore::parallel;
 
 
 static void template_cluster_allocation(const unsigned int number_clusters) {
@@ -66,3 +68,23 @@ TEST(utest_hsyncnet, allocation_2_clusters) {
 TEST(utest_hsyncnet, allocation_1_clusters) {
     template_cluster_allocation(1);
 }
+
+
+TEST(utest_hsyncnet, cancelled_processing) {
+    std::vector<std::vector<double> > sample = { { 0.1, 0.1 }, { 1.2, 1.1 }, { 5.0, 5.0 }, { 10.2, 10.1 }, { 11.3, 11.0 }, { 15.1, 15.4 } };
+
+    cancellation_token token;
+    token.cancel();
+
+    execution_context context;
+    context.set_cancellation_token(token);
+    execution_context_scope scope(context);
+
+    hsyncnet network(&sample, 1, initial_type::EQUIPARTITION);
+
+    hsyncnet_analyser analyser;
+    network.process(0.998, solve_type::FORWARD_EULER, true, analyser);
+
+    ASSERT_FALSE(analyser.empty());
+    ASSERT_EQ(sample.size(), analyser.back().m_phase.size());
+}
@@ -23,6 +23,8 @@
 #include "interface/dbscan_interface.h"
 #include "interface/pyclustering_package.hpp"
 
+#include "utils/metric.hpp"
+
 #include "utenv_utils.hpp"
 
 #include <memory>
@@ -35,4 +37,27 @@ TEST(utest_interface_dbscan, dbscan_algorithm) {
     ASSERT_EQ(3U, result->size); /* allocated clustes + noise */
 
     delete result;
+}
+
+TEST(utest_interface_dbscan, dbscan_algorithm_distance_matrix) {
+    const dataset points = { { 1.0, 1.0 }, { 1.1, 1.0 }, { 1.2, 1.4 }, { 10.0, 10.3 }, { 10.1, 10.2 }, { 10.2, 10.4 } };
+
+    dataset matrix;
+    ccore::utils::metric::distance_matrix(points, matrix);
+
+    std::vector<double> condensed;
+    for (std::size_t i = 0; i < matrix.size(); i++) {
+        condensed.insert(condensed.end(), matrix[i].begin() + i + 1, matrix[i].end());
+    }
+
+    for (const auto & sample : { pack(matrix), std::shared_ptr<pyclustering_package>(create_matrix_package(&matrix)), pack(condensed) }) {
+        pyclustering_package * result = dbscan_algorithm(sample.get(), 4, 2, 1);
+        ASSERT_EQ(3U, result->size); /* allocated clustes + noise */
+
+        std::vector<std::vector<std::size_t>> clusters;
+        result->extract(clusters);
+        ASSERT_EQ(std::vector<std::vector<std::size_t>>({ { 0, 1, 2 }, { 3, 4, 5 }, { } }), clusters);
+
+        delete result;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "interface/execution_context_interface.h"
+#include "interface/pyclustering_package.hpp"
+
+#include "parallel/execution_context.hpp"
+
+#include "utenv_utils.hpp"
+
+#include <limits>
+#include <memory>
+
+
+using namespace ccore::parallel;
+
+
+TEST(utest_interface_execution_context, set_thread_count) {
+    const std::size_t previous = ccore_get_thread_count();
+
+    ccore_set_thread_count(1);
+    ASSERT_EQ(1U, ccore_get_thread_count());
+
+    ccore_set_thread_count(3);
+    ASSERT_EQ(3U, ccore_get_thread_count());
+
+    ccore_set_thread_count(0);
+    ASSERT_EQ(execution_context::get_hardware_thread_count(), ccore_get_thread_count());
+
+    ccore_set_thread_count(previous);
+    ASSERT_EQ(previous, ccore_get_thread_count());
+}
+
+
+TEST(utest_interface_execution_context, set_thread_affinity) {
+    std::shared_ptr<pyclustering_package> cpus = pack(std::vector<std::size_t>({ 0 }));
+    ASSERT_TRUE(ccore_set_thread_affinity(cpus.get()));
+    ASSERT_EQ(std::vector<std::size_t>({ 0 }), execution_context::get_default().get_affinity());
+
+    cpus = pack(std::vector<std::size_t>({ 1000000 }));
+    ASSERT_FALSE(ccore_set_thread_affinity(cpus.get()));
+    ASSERT_FALSE(ccore_set_thread_affinity(nullptr));
+    ASSERT_EQ(std::vector<std::size_t>({ 0 }), execution_context::get_default().get_affinity());
+
+    cpus = pack(std::vector<std::size_t>());
+    ASSERT_TRUE(ccore_set_thread_affinity(cpus.get()));
+    ASSERT_TRUE(execution_context::get_default().get_affinity().empty());
+}
+
+
+TEST(utest_interface_execution_context, activate_context) {
+    void * context = execution_context_create(0, true);
+
+    execution_context_activate(context);
+    ASSERT_EQ(context, execution_context::get_active());
+    ASSERT_EQ(1U, execution_context::get_current_thread_count());
+
+    ASSERT_TRUE(execution_context_deactivate(context));
+    ASSERT_EQ(nullptr, execution_context::get_active());
+
+    ASSERT_FALSE(execution_context_deactivate(context));
+
+    execution_context_destroy(context);
+}
+
+
+TEST(utest_interface_execution_context, activate_nested_context) {
+    void * outer = execution_context_create(0, true);
+    void * inner = execution_context_create(2, false);
+
+    execution_context_activate(outer);
+    execution_context_activate(inner);
+    ASSERT_EQ(inner, execution_context::get_active());
+
+    ASSERT_FALSE(execution_context_deactivate(outer));
+    ASSERT_EQ(inner, execution_context::get_active());
+
+    ASSERT_TRUE(execution_context_deactivate(inner));
+    ASSERT_EQ(outer, execution_context::get_active());
+
+    execution_context_activate(nullptr);
+    ASSERT_EQ(nullptr, execution_context::get_active());
+
+    ASSERT_TRUE(execution_context_deactivate(nullptr));
+    ASSERT_EQ(outer, execution_context::get_active());
+
+    ASSERT_TRUE(execution_context_deactivate(outer));
+    ASSERT_EQ(nullptr, execution_context::get_active());
+
+    execution_context_destroy(inner);
+    execution_context_destroy(outer);
+}
+
+
+TEST(utest_interface_execution_context, destroy_active_context) {
+    void * outer = execution_context_create(0, true);
+    void * middle = execution_context_create(0, false);
+    void * inner = execution_context_create(2, false);
+
+    execution_context_activate(outer);
+    execution_context_activate(middle);
+    execution_context_activate(inner);
+
+    execution_context_destroy(middle);
+    ASSERT_EQ(outer, execution_context::get_active());
+
+    ASSERT_FALSE(execution_context_deactivate(inner));
+    execution_context_destroy(inner);
+
+    execution_context_destroy(outer);
+    ASSERT_EQ(nullptr, execution_context::get_active());
+}
+
+
+TEST(utest_interface_execution_context, cancellation_token) {
+    void * token = cancellation_token_create();
+    ASSERT_FALSE(cancellation_token_is_cancelled(token));
+
+    void * context = execution_context_create(0, false);
+    execution_context_set_cancellation_token(context, token);
+
+    execution_context_activate(context);
+    ASSERT_FALSE(execution_context::is_cancellation_requested());
+
+    cancellation_token_cancel(token);
+    ASSERT_TRUE(cancellation_token_is_cancelled(token));
+    ASSERT_TRUE(execution_context::is_cancellation_requested());
+
+    ASSERT_TRUE(execution_context_deactivate(context));
+    ASSERT_FALSE(execution_context::is_cancellation_requested());
+
+    cancellation_token_destroy(token);
+    execution_context_destroy(context);
+}
+
+
+TEST(utest_interface_execution_context, cancellation_token_timeout) {
+    void * token = cancellation_token_create();
+
+    ASSERT_TRUE(cancellation_token_set_timeout(token, 3600.0));
+    ASSERT_FALSE(cancellation_token_is_cancelled(token));
+
+    ASSERT_TRUE(cancellation_token_set_timeout(token, std::numeric_limits<double>::infinity()));
+    ASSERT_FALSE(cancellation_token_is_cancelled(token));
+
+    ASSERT_FALSE(cancellation_token_set_timeout(token, -1.0));
+    ASSERT_FALSE(cancellation_token_set_timeout(token, std::numeric_limits<double>::quiet_NaN()));
+    ASSERT_FALSE(cancellation_token_is_cancelled(token));
+
+    ASSERT_TRUE(cancellation_token_set_timeout(token, 0.0));
+    ASSERT_TRUE(cancellation_token_is_cancelled(token));
+
+    cancellation_token_destroy(token);
+}
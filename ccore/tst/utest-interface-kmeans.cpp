@@ -49,4 +49,28 @@ TEST(utest_interface_kmeans, kmeans_api) {
     ASSERT_NE(nullptr, kmeans_result);
 
     delete kmeans_result;
-}
\ No newline at end of file
+}
+
+
+TEST(utest_interface_kmeans, kmeans_api_matrix_package) {
+    double buffer[] = { 1.0, 2.0, 3.0, 10.0, 11.0, 12.0 };
+
+    pyclustering_package sample(PYCLUSTERING_TYPE_MATRIX);
+    sample.size = 6;
+    sample.columns = 1;
+    sample.stride = 1;
+    sample.element_type = PYCLUSTERING_TYPE_DOUBLE;
+    sample.data = buffer;
+
+    std::shared_ptr<pyclustering_package> centers = pack(dataset({ { 1 }, { 10 } }));
+
+    pyclustering_package * kmeans_result = kmeans_algorithm(&sample, centers.get(), 0.1, false, nullptr);
+    ASSERT_NE(nullptr, kmeans_result);
+
+    std::vector<std::vector<std::size_t>> clusters;
+    kmeans_result->at<pyclustering_package *>(KMEANS_PACKAGE_INDEX_CLUSTERS)->extract(clusters);
+    ASSERT_EQ(std::vector<std::vector<std::size_t>>({ { 0, 1, 2 }, { 3, 4, 5 } }), clusters);
+
+    delete kmeans_result;
+    sample.data = nullptr;     /* buffer is not owned by the package */
+}
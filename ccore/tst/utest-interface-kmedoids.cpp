@@ -50,6 +50,31 @@ TEST(utest_interface_kmedoids, kmedoids_api) {
 }
 
 
+TEST(utest_interface_kmedoids, kmedoids_api_distance_matrix) {
+    const dataset points = { { 1 }, { 2 }, { 3 }, { 10 }, { 11 }, { 12 } };
+    std::shared_ptr<pyclustering_package> medoids = pack(medoid_sequence({ 2, 4 }));
+
+    dataset matrix;
+    distance_matrix(points, matrix);
+
+    std::vector<double> condensed;
+    for (std::size_t i = 0; i < matrix.size(); i++) {
+        condensed.insert(condensed.end(), matrix[i].begin() + i + 1, matrix[i].end());
+    }
+
+    for (const auto & sample : { std::shared_ptr<pyclustering_package>(create_matrix_package(&matrix)), pack(condensed) }) {
+        pyclustering_package * kmedoids_result = kmedoids_algorithm(sample.get(), medoids.get(), 0.1, nullptr, 1);
+        ASSERT_NE(nullptr, kmedoids_result);
+
+        medoid_sequence result_medoids;
+        ((pyclustering_package **) kmedoids_result->data)[KMEDOIDS_PACKAGE_INDEX_MEDOIDS]->extract(result_medoids);
+        ASSERT_EQ(medoid_sequence({ 1, 4 }), result_medoids);
+
+        delete kmedoids_result;
+    }
+}
+
+
 TEST(utest_interface_kmedoids, kmedoids_api_null_metric) {
     std::shared_ptr<pyclustering_package> sample = pack(dataset({ { 1 }, { 2 }, { 3 }, { 10 }, { 11 }, { 12 } }));
     std::shared_ptr<pyclustering_package> medoids = pack(medoid_sequence({ 2, 4 }));
@@ -0,0 +1,52 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "interface/memory_interface.h"
+#include "interface/pyclustering_package.hpp"
+
+#include "utenv_utils.hpp"
+
+#include <memory>
+#include <vector>
+
+
+TEST(utest_interface_memory, estimate_memory) {
+    std::vector<double> parameters = { 1.0 };
+    std::shared_ptr<pyclustering_package> weights(create_package(&parameters));
+
+    const std::size_t syncnet = memory_estimate("syncnet", nullptr, 500, 2);
+    const std::size_t syncnet_weights = memory_estimate("syncnet", weights.get(), 500, 2);
+
+    ASSERT_GT(syncnet, 0U);
+    ASSERT_GT(syncnet_weights, syncnet);
+}
+
+
+TEST(utest_interface_memory, estimate_unknown_algorithm) {
+    ASSERT_EQ(0U, memory_estimate("unknown", nullptr, 500, 2));
+}
+
+
+TEST(utest_interface_memory, current_and_peak) {
+    ASSERT_GE(memory_get_peak(), memory_get_current());
+}
@@ -27,6 +27,7 @@
 
 #include "utenv_utils.hpp"
 
+#include <cmath>
 #include <memory>
 
 
@@ -51,3 +52,140 @@ TEST(utest_interface_dbscan, metric_algorithm) {
 
     metric_destroy(metric_pointer);
 }
+
+
+TEST(utest_interface_metric, metric_calculate_batch) {
+    std::shared_ptr<pyclustering_package> arguments = pack(std::vector<double>());
+    void * metric_pointer = metric_create(metric_t::MANHATTAN, arguments.get(), nullptr);
+
+    const dataset points = { { 1.0, 1.0 }, { 2.0, 1.0 }, { -1.0, 3.0 } };
+    std::shared_ptr<pyclustering_package> point_package = pack(point({ 1.0, 2.0 }));
+    std::shared_ptr<pyclustering_package> points_package = pack(points);
+
+    std::shared_ptr<pyclustering_package> result(metric_calculate_batch(metric_pointer, point_package.get(), points_package.get()));
+    ASSERT_NE(nullptr, result);
+    ASSERT_EQ(points.size(), result->size);
+
+    const std::vector<double> expected = { 1.0, 2.0, 3.0 };
+    for (std::size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], result->at<double>(i));
+    }
+
+    metric_destroy(metric_pointer);
+}
+
+
+TEST(utest_interface_metric, metric_calculate_batch_wrong_dimension) {
+    std::shared_ptr<pyclustering_package> arguments = pack(std::vector<double>());
+    void * metric_pointer = metric_create(metric_t::EUCLIDEAN, arguments.get(), nullptr);
+
+    std::shared_ptr<pyclustering_package> point_package = pack(point({ 1.0, 2.0, 3.0 }));
+    std::shared_ptr<pyclustering_package> points_package = pack(dataset({ { 1.0, 1.0 } }));
+
+    ASSERT_EQ(nullptr, metric_calculate_batch(metric_pointer, point_package.get(), points_package.get()));
+
+    metric_destroy(metric_pointer);
+}
+
+
+static double
+metric_interface_user_solver(const void * p_point1, const void * p_point2) {
+    point point1, point2;
+    ((const pyclustering_package *) p_point1)->extract(point1);
+    ((const pyclustering_package *) p_point2)->extract(point2);
+
+    return std::abs(point1[0] - point2[0]);
+}
+
+
+static void
+template_metric_calculate_pairwise(const metric_t p_type, const std::vector<double> & p_arguments, double (*p_solver)(const void *, const void *)) {
+    std::shared_ptr<pyclustering_package> arguments = pack(p_arguments);
+    void * metric_pointer = metric_create(p_type, arguments.get(), p_solver);
+    const distance_metric<point> & metric = *((distance_metric<point> *) metric_pointer);
+
+    const dataset block1 = { { 1.0, 1.0 }, { 2.0, 1.0 }, { -1.0, 3.0 } };
+    const dataset block2 = { { 0.0, 0.0 }, { 5.0, -1.0 } };
+
+    std::shared_ptr<pyclustering_package> package1 = pack(block1);
+    std::shared_ptr<pyclustering_package> package2 = pack(block2);
+
+    std::shared_ptr<pyclustering_package> result(metric_calculate_pairwise(metric_pointer, package1.get(), package2.get()));
+    ASSERT_NE(nullptr, result);
+    ASSERT_EQ((unsigned int) pyclustering_data_t::PYCLUSTERING_TYPE_MATRIX, result->type);
+    ASSERT_EQ(block1.size(), result->size);
+    ASSERT_EQ(block2.size(), result->columns);
+
+    for (std::size_t i = 0; i < block1.size(); i++) {
+        for (std::size_t j = 0; j < block2.size(); j++) {
+            ASSERT_DOUBLE_EQ(metric(block1[i], block2[j]), result->at<double>(i, j));
+        }
+    }
+
+    metric_destroy(metric_pointer);
+}
+
+
+TEST(utest_interface_metric, metric_calculate_pairwise_euclidean) {
+    template_metric_calculate_pairwise(metric_t::EUCLIDEAN, { }, nullptr);
+}
+
+
+TEST(utest_interface_metric, metric_calculate_pairwise_minkowski) {
+    template_metric_calculate_pairwise(metric_t::MINKOWSKI, { 4.0 }, nullptr);
+}
+
+
+TEST(utest_interface_metric, metric_calculate_pairwise_user_defined) {
+    template_metric_calculate_pairwise(metric_t::USER_DEFINED, { }, metric_interface_user_solver);
+}
+
+
+TEST(utest_interface_metric, metric_calculate_pairwise_native) {
+    template_metric_calculate_pairwise(metric_t::COSINE, { }, nullptr);
+    template_metric_calculate_pairwise(metric_t::CANBERRA, { }, nullptr);
+    template_metric_calculate_pairwise(metric_t::WEIGHTED_EUCLIDEAN, { 0.5, 2.0 }, nullptr);
+    template_metric_calculate_pairwise(metric_t::GOWER, { 6.0, 4.0 }, nullptr);
+    template_metric_calculate_pairwise(metric_t::MAHALANOBIS, { 2.0, 0.5, 0.5, 1.0 }, nullptr);
+}
+
+
+TEST(utest_interface_metric, metric_create_mahalanobis_incorrect) {
+    std::shared_ptr<pyclustering_package> arguments = pack(std::vector<double>({ 1.0, 2.0, 3.0 }));
+    ASSERT_EQ(nullptr, metric_create(metric_t::MAHALANOBIS, arguments.get(), nullptr));
+
+    arguments = pack(std::vector<double>({ 1.0, 2.0, 2.0, 1.0 }));
+    ASSERT_EQ(nullptr, metric_create(metric_t::MAHALANOBIS, arguments.get(), nullptr));
+}
+
+
+TEST(utest_interface_metric, metric_create_empty_arguments) {
+    std::shared_ptr<pyclustering_package> arguments = pack(std::vector<double>());
+
+    ASSERT_EQ(nullptr, metric_create(metric_t::MINKOWSKI, arguments.get(), nullptr));
+    ASSERT_EQ(nullptr, metric_create(metric_t::WEIGHTED_EUCLIDEAN, arguments.get(), nullptr));
+    ASSERT_EQ(nullptr, metric_create(metric_t::GOWER, arguments.get(), nullptr));
+    ASSERT_EQ(nullptr, metric_create(metric_t::MAHALANOBIS, arguments.get(), nullptr));
+
+    ASSERT_EQ(nullptr, metric_create(metric_t::MINKOWSKI, nullptr, nullptr));
+    ASSERT_EQ(nullptr, metric_create(metric_t::WEIGHTED_EUCLIDEAN, nullptr, nullptr));
+}
+
+
+TEST(utest_interface_metric, metric_arguments_dimension_mismatch) {
+    std::shared_ptr<pyclustering_package> arguments = pack(std::vector<double>({ 1.0, 0.5, 2.0 }));
+
+    for (const auto type : { metric_t::WEIGHTED_EUCLIDEAN, metric_t::GOWER }) {
+        void * metric_pointer = metric_create(type, arguments.get(), nullptr);
+        ASSERT_NE(nullptr, metric_pointer);
+
+        std::shared_ptr<pyclustering_package> point_package = pack(point({ 1.0, 2.0 }));
+        std::shared_ptr<pyclustering_package> points_package = pack(dataset({ { 1.0, 1.0 }, { 2.0, 2.0 } }));
+
+        ASSERT_TRUE(std::isnan(metric_calculate(metric_pointer, point_package.get(), point_package.get())));
+        ASSERT_EQ(nullptr, metric_calculate_batch(metric_pointer, point_package.get(), points_package.get()));
+        ASSERT_EQ(nullptr, metric_calculate_pairwise(metric_pointer, points_package.get(), points_package.get()));
+
+        metric_destroy(metric_pointer);
+    }
+}
@@ -0,0 +1,71 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "interface/kmeans_interface.h"
+#include "interface/pyclustering_package.hpp"
+#include "interface/statistics_interface.h"
+
+#include "utils/statistics.hpp"
+
+#include "samples.hpp"
+#include "utenv_utils.hpp"
+
+#include <memory>
+
+
+using namespace ccore::utils::statistics;
+
+
+TEST(utest_interface_statistics, last_kmeans_statistics) {
+    ASSERT_FALSE(statistics_is_enabled());
+
+    statistics_enable(true);
+    ASSERT_TRUE(statistics_is_enabled());
+
+    std::shared_ptr<pyclustering_package> sample = pack(*simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01));
+    std::shared_ptr<pyclustering_package> centers = pack(dataset({ { 3.7, 5.5 }, { 6.7, 7.5 } }));
+
+    pyclustering_package * result = kmeans_algorithm(sample.get(), centers.get(), 0.001, false, nullptr);
+    delete result;
+
+    statistics_enable(false);
+
+    pyclustering_package * statistics = statistics_get_last();
+    ASSERT_EQ((std::size_t) STATISTICS_PACKAGE_SIZE, statistics->size);
+
+    pyclustering_package * counters = ((pyclustering_package **) statistics->data)[STATISTICS_PACKAGE_INDEX_COUNTERS];
+    pyclustering_package * phases = ((pyclustering_package **) statistics->data)[STATISTICS_PACKAGE_INDEX_PHASES];
+    pyclustering_package * memory = ((pyclustering_package **) statistics->data)[STATISTICS_PACKAGE_INDEX_MEMORY];
+
+    ASSERT_EQ(performance_statistics::AMOUNT_COUNTERS, counters->size);
+    ASSERT_EQ(performance_statistics::AMOUNT_PHASES, phases->size);
+
+    ASSERT_GT(counters->at<std::size_t>((std::size_t) counter_t::ITERATIONS), 0U);
+    ASSERT_GT(counters->at<std::size_t>((std::size_t) counter_t::DISTANCE_CALCULATIONS), 0U);
+    ASSERT_GT(phases->at<double>((std::size_t) phase_t::PROCESS), 0.0);
+
+    ASSERT_EQ(2U, memory->size);
+    ASSERT_LE(memory->at<std::size_t>(1), memory->at<std::size_t>(0));
+
+    delete statistics;
+}
@@ -0,0 +1,199 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "samples.hpp"
+
+#include "container/kdtree_static.hpp"
+
+#include "utils/metric.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+
+using namespace ccore::container;
+using namespace ccore::utils::metric;
+
+
+static void template_radius_search(const dataset & p_data, const double p_radius, const std::size_t p_leaf_size) {
+    const kdtree_static tree(dense_dataset(p_data), p_leaf_size);
+    ASSERT_EQ(p_data.size(), tree.size());
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        std::vector<std::size_t> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < p_data.size(); index_neighbor++) {
+            if (euclidean_distance_square(p_data[index], p_data[index_neighbor]) <= p_radius * p_radius) {
+                expected.push_back(index_neighbor);
+            }
+        }
+
+        std::vector<std::size_t> actual;
+        std::vector<double> distances;
+        tree.find_nearest(p_data[index], p_radius, actual, distances);
+
+        ASSERT_EQ(actual.size(), distances.size());
+        for (std::size_t position = 0; position < actual.size(); position++) {
+            ASSERT_DOUBLE_EQ(euclidean_distance_square(p_data[index], p_data[actual[position]]), distances[position]);
+        }
+
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+
+static void template_k_nearest_search(const dataset & p_data, const std::size_t p_k, const double p_radius, const std::size_t p_leaf_size) {
+    const kdtree_static tree(dense_dataset(p_data), p_leaf_size);
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        std::vector<std::pair<double, std::size_t>> candidates;
+        for (std::size_t index_neighbor = 0; index_neighbor < p_data.size(); index_neighbor++) {
+            const double distance = euclidean_distance_square(p_data[index], p_data[index_neighbor]);
+            if (distance <= p_radius * p_radius) {
+                candidates.emplace_back(distance, index_neighbor);
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        candidates.resize(std::min(candidates.size(), p_k));
+
+        std::vector<std::size_t> actual;
+        std::vector<double> distances;
+        tree.find_k_nearest(p_data[index], p_k, p_radius, actual, distances);
+
+        ASSERT_EQ(candidates.size(), actual.size());
+        for (std::size_t position = 0; position < actual.size(); position++) {
+            ASSERT_EQ(candidates[position].second, actual[position]);
+            ASSERT_DOUBLE_EQ(candidates[position].first, distances[position]);
+        }
+    }
+}
+
+
+TEST(utest_kdtree_static, radius_search_simple_01) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    template_radius_search(*sample, 0.5, 2);
+}
+
+
+TEST(utest_kdtree_static, radius_search_simple_03) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    template_radius_search(*sample, 0.7, 4);
+}
+
+
+TEST(utest_kdtree_static, radius_search_identical_simple_09) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09);
+    template_radius_search(*sample, 1.0, 1);
+}
+
+
+TEST(utest_kdtree_static, radius_search_lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    template_radius_search(*sample, 0.3, kdtree_static::DEFAULT_LEAF_SIZE);
+}
+
+
+TEST(utest_kdtree_static, radius_search_hepta) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::HEPTA);
+    template_radius_search(*sample, 1.0, 16);
+}
+
+
+TEST(utest_kdtree_static, radius_search_identical_points) {
+    const dataset data(100, { 1.0, 2.0 });
+
+    const kdtree_static tree(dense_dataset(data), 8);
+    ASSERT_EQ(1U, tree.get_amount_nodes());
+
+    template_radius_search(data, 0.0, 8);
+}
+
+
+TEST(utest_kdtree_static, k_nearest_search_simple_09) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09);
+    template_k_nearest_search(*sample, 3, std::numeric_limits<double>::max(), 1);
+}
+
+
+TEST(utest_kdtree_static, k_nearest_search_hepta) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::HEPTA);
+    template_k_nearest_search(*sample, 5, std::numeric_limits<double>::max(), 8);
+    template_k_nearest_search(*sample, 5, 0.5, 8);
+}
+
+
+TEST(utest_kdtree_static, k_nearest_search_identical_points) {
+    const dataset data(50, { 1.0, 2.0 });
+    template_k_nearest_search(data, 4, 1.0, 8);
+}
+
+
+TEST(utest_kdtree_static, sorted_data_depth) {
+    const std::size_t size = 20000;
+    const std::size_t leaf_size = 16;
+
+    dataset data;
+    for (std::size_t i = 0; i < size; i++) {
+        data.push_back({ (double) i, 0.0 });
+    }
+
+    const kdtree_static tree(dense_dataset(data), leaf_size);
+    ASSERT_LE(tree.get_depth(), (std::size_t) std::ceil(std::log2((double) size / leaf_size)) + 1);
+
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    tree.find_nearest(data[size / 2], 2.0, indexes, distances);
+
+    std::sort(indexes.begin(), indexes.end());
+    ASSERT_EQ(std::vector<std::size_t>({ size / 2 - 2, size / 2 - 1, size / 2, size / 2 + 1, size / 2 + 2 }), indexes);
+}
+
+
+TEST(utest_kdtree_static, empty_tree) {
+    const dense_dataset data { dataset() };
+    const kdtree_static tree(data);
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(0U, tree.get_depth());
+
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    tree.find_nearest(std::vector<double>({ 0.0, 0.0 }), 1.0, indexes, distances);
+    ASSERT_TRUE(indexes.empty());
+}
+
+
+TEST(utest_kdtree_static, radius_search_high_dimension) {
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    dataset data(1500, point(16));
+    for (auto & object : data) {
+        std::generate(object.begin(), object.end(), [&generator, &distribution]() { return distribution(generator); });
+    }
+
+    template_radius_search(data, 0.8, 8);
+}
@@ -26,13 +26,19 @@
 #include "container/kdtree.hpp"
 
 #include "utils/metric.hpp"
+#include "utils/statistics.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
+#include <random>
+#include <stdexcept>
 
 
 using namespace ccore::container;
 using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
 
 
 class utest_kdtree : public ::testing::Test {
@@ -120,6 +126,76 @@ protected:
         }
     }
 
+    virtual void TemplateBulkCreationSearchRemove(const dataset & p_data, const double radius_search) {
+        std::vector<void *> payloads(p_data.size());
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            payloads[index] = (void *) index;
+        }
+
+        tree = kdtree(p_data, payloads);
+        ASSERT_EQ(p_data.size(), tree.get_size());
+        ASSERT_EQ(p_data.size(), tree.traverse(tree.get_root()));
+
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            ASSERT_NE(nullptr, tree.find_node(p_data[index], (void *) index));
+
+            std::vector<std::size_t> expected;
+            for (std::size_t index_neighbor = 0; index_neighbor < p_data.size(); index_neighbor++) {
+                if (euclidean_distance(p_data[index], p_data[index_neighbor]) <= radius_search) {
+                    expected.push_back(index_neighbor);
+                }
+            }
+
+            std::vector<std::size_t> actual;
+            kdtree_searcher(p_data[index], tree.get_root(), radius_search).find_nearest([&actual](const kdnode::ptr & p_node, const double) {
+                actual.push_back((std::size_t) p_node->get_payload());
+            });
+
+            std::sort(actual.begin(), actual.end());
+            ASSERT_EQ(expected, actual);
+        }
+
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            tree.remove(p_data[index], (void *) index);
+            ASSERT_EQ(p_data.size() - index - 1, tree.get_size());
+        }
+
+        ASSERT_EQ(nullptr, tree.get_root());
+    }
+
+    static void TemplateKNearest(const kdnode::ptr & p_root, const dataset & p_data, const std::size_t p_k, const double p_radius) {
+        for (std::size_t index = 0; index < p_data.size(); index++) {
+            std::vector<double> expected;
+            for (const auto & candidate : p_data) {
+                const double distance = euclidean_distance_square(p_data[index], candidate);
+                if (distance <= p_radius * p_radius) {
+                    expected.push_back(distance);
+                }
+            }
+
+            std::sort(expected.begin(), expected.end());
+            expected.resize(std::min(p_k, expected.size()));
+
+            std::vector<double> distances;
+            std::vector<kdnode::ptr> nodes;
+            kdtree_searcher(p_data[index], p_root, p_radius).find_k_nearest_nodes(p_k, distances, nodes);
+
+            ASSERT_EQ(expected, distances);
+            ASSERT_EQ(distances.size(), nodes.size());
+            for (std::size_t position = 0; position < nodes.size(); position++) {
+                ASSERT_DOUBLE_EQ(distances[position], euclidean_distance_square(p_data[index], nodes[position]->get_data()));
+            }
+        }
+    }
+
+    static std::size_t GetDepth(const kdnode::ptr & p_node) {
+        if (p_node == nullptr) {
+            return 0;
+        }
+
+        return 1 + std::max(GetDepth(p_node->get_left()), GetDepth(p_node->get_right()));
+    }
+
 private:
     void FindNearestNode(const dataset & p_data, const std::size_t p_index) {
         kdnode::ptr nearest_node = searcher.find_nearest_node();
@@ -406,4 +482,263 @@ TEST_F(utest_kdtree, insert_search_remove_with_payload_identical_simple_12) {
     std::iota(payloads.begin(), payloads.end(), 0);
 
     TemplateInsertFindRemoveByCoordinatesAndPayload(*data, payloads);
-}
\ No newline at end of file
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_search_remove_simple_01) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    TemplateBulkCreationSearchRemove(*sample, 0.5);
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_search_remove_lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    TemplateBulkCreationSearchRemove(*sample, 0.3);
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_search_remove_identical_simple_09) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09);
+    TemplateBulkCreationSearchRemove(*sample, 1.0);
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_search_remove_identical_data) {
+    dataset data = { {75, 75}, {75, 75}, {75, 75}, {75, 75}, {75, 76}, {75, 76}, {74, 75}, {75, 75} };
+    TemplateBulkCreationSearchRemove(data, 1.0);
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_search_remove_grid) {
+    dataset data;
+    for (std::size_t i = 0; i < 30; i++) {
+        for (std::size_t j = 0; j < 30; j++) {
+            data.push_back({ (double) i, (double) (j % 10) });
+        }
+    }
+
+    TemplateBulkCreationSearchRemove(data, 1.5);
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_sorted_depth) {
+    const std::size_t size = 20000;
+
+    dataset data;
+    for (std::size_t i = 0; i < size; i++) {
+        data.push_back({ (double) i, (double) (i / 100) });
+    }
+
+    tree = kdtree(data);
+    ASSERT_EQ(size, tree.get_size());
+    ASSERT_LE(GetDepth(tree.get_root()), 2 * (std::size_t) std::log2(size) + 2);
+
+    /* tree is still consistent for incremental changes */
+    tree.insert({ 5.5, 0.0 }, (void *) size);
+    ASSERT_NE(nullptr, tree.find_node({ 5.5, 0.0 }, (void *) size));
+
+    tree.remove(data[size / 2]);
+    ASSERT_EQ(nullptr, tree.find_node(data[size / 2]));
+    ASSERT_EQ(size, tree.traverse(tree.get_root()));
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_dense_dataset) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+
+    tree = kdtree(dense_dataset(*sample));
+    ASSERT_EQ(sample->size(), tree.get_size());
+
+    for (std::size_t index = 0; index < sample->size(); index++) {
+        ASSERT_NE(nullptr, tree.find_node((*sample)[index], (void *) index));
+    }
+}
+
+
+TEST_F(utest_kdtree, bulk_creation_empty_and_wrong_payloads) {
+    tree = kdtree(dataset());
+    ASSERT_EQ(nullptr, tree.get_root());
+    ASSERT_EQ(0U, tree.get_size());
+
+    ASSERT_THROW(kdtree(dataset({ { 1.0 }, { 2.0 } }), std::vector<void *>(1, nullptr)), std::invalid_argument);
+}
+
+
+TEST_F(utest_kdtree, k_nearest_simple_01) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    InitTestObject(*sample);
+    TemplateKNearest(tree.get_root(), *sample, 3, std::numeric_limits<double>::max());
+}
+
+
+TEST_F(utest_kdtree, k_nearest_radius_simple_03) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    InitTestObject(*sample);
+    TemplateKNearest(tree.get_root(), *sample, 10, 0.5);
+}
+
+
+TEST_F(utest_kdtree, k_nearest_identical_simple_09) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09);
+    tree = kdtree(*sample);
+    TemplateKNearest(tree.get_root(), *sample, 5, std::numeric_limits<double>::max());
+}
+
+
+TEST_F(utest_kdtree, k_nearest_bulk_lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    tree = kdtree(*sample);
+    TemplateKNearest(tree.get_root(), *sample, 7, std::numeric_limits<double>::max());
+}
+
+
+TEST_F(utest_kdtree, k_nearest_more_than_size) {
+    const dataset data = { { 0.0 }, { 1.0 }, { 3.0 } };
+    InitTestObject(data);
+    TemplateKNearest(tree.get_root(), data, 10, std::numeric_limits<double>::max());
+
+    std::vector<double> distances;
+    std::vector<kdnode::ptr> nodes;
+    kdtree_searcher(data[0], tree.get_root(), 10.0).find_k_nearest_nodes(0, distances, nodes);
+    ASSERT_TRUE(nodes.empty());
+}
+
+
+TEST_F(utest_kdtree, k_nearest_neighbors_batch) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::HEPTA);
+    const std::size_t k = 4;
+
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    kdtree_searcher::find_k_nearest_neighbors(dense_dataset(*sample), k, indexes, distances);
+
+    ASSERT_EQ(sample->size() * k, indexes.size());
+    ASSERT_EQ(sample->size() * k, distances.size());
+
+    for (std::size_t index = 0; index < sample->size(); index++) {
+        std::vector<double> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < sample->size(); index_neighbor++) {
+            if (index_neighbor != index) {
+                expected.push_back(euclidean_distance((*sample)[index], (*sample)[index_neighbor]));
+            }
+        }
+
+        std::sort(expected.begin(), expected.end());
+
+        for (std::size_t position = 0; position < k; position++) {
+            const std::size_t index_neighbor = indexes[index * k + position];
+            ASSERT_NE(index, index_neighbor);
+            ASSERT_DOUBLE_EQ(expected[position], distances[index * k + position]);
+            ASSERT_DOUBLE_EQ(expected[position], euclidean_distance((*sample)[index], (*sample)[index_neighbor]));
+        }
+    }
+}
+
+
+TEST_F(utest_kdtree, k_nearest_neighbors_batch_prebuilt_tree) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    const dense_dataset data(*sample);
+
+    std::vector<std::size_t> expected_indexes, actual_indexes;
+    std::vector<double> expected_distances, actual_distances;
+    kdtree_searcher::find_k_nearest_neighbors(data, 3, expected_indexes, expected_distances, 0.5);
+    kdtree_searcher::find_k_nearest_neighbors(kdtree_static(data, 4), data, 3, actual_indexes, actual_distances, 0.5);
+
+    ASSERT_EQ(expected_indexes, actual_indexes);
+    ASSERT_EQ(expected_distances, actual_distances);
+}
+
+
+TEST_F(utest_kdtree, k_nearest_neighbors_batch_radius) {
+    const dataset data = { { 0.0 }, { 1.0 }, { 1.5 }, { 10.0 } };
+
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    kdtree_searcher::find_k_nearest_neighbors(dense_dataset(data), 2, indexes, distances, 1.0);
+
+    const std::size_t none = kdtree_searcher::INVALID_INDEX;
+    ASSERT_EQ(std::vector<std::size_t>({ 1, none, 2, 0, 1, none, none, none }), indexes);
+    ASSERT_EQ(1.0, distances[0]);
+    ASSERT_EQ(std::numeric_limits<double>::max(), distances[1]);
+    ASSERT_EQ(0.5, distances[2]);
+    ASSERT_EQ(1.0, distances[3]);
+}
+
+
+TEST_F(utest_kdtree, search_high_dimension) {
+    const std::size_t size = 2000;
+    const std::size_t dimension = 12;
+
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    dataset data(size, point(dimension));
+    for (auto & object : data) {
+        std::generate(object.begin(), object.end(), [&generator, &distribution]() { return distribution(generator); });
+    }
+
+    tree = kdtree(data);
+
+    const double radius = 0.6;
+    for (std::size_t index = 0; index < size; index += 40) {
+        std::vector<double> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < size; index_neighbor++) {
+            const double distance = euclidean_distance_square(data[index], data[index_neighbor]);
+            if (distance <= radius * radius) {
+                expected.push_back(distance);
+            }
+        }
+
+        std::vector<double> distances;
+        std::vector<kdnode::ptr> nodes;
+        kdtree_searcher(data[index], tree.get_root(), radius).find_nearest_nodes(distances, nodes);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(distances.begin(), distances.end());
+        ASSERT_EQ(expected, distances);
+
+        point query = data[index];
+        query[0] += 1e-3;
+
+        double expected_nearest = std::numeric_limits<double>::max();
+        for (const auto & object : data) {
+            expected_nearest = std::min(expected_nearest, euclidean_distance_square(query, object));
+        }
+
+        const kdnode::ptr nearest = kdtree_searcher(query, tree.get_root(), 10.0).find_nearest_node();
+        ASSERT_EQ(data[index], nearest->get_data());
+        ASSERT_DOUBLE_EQ(expected_nearest, euclidean_distance_square(query, nearest->get_data()));
+    }
+}
+
+
+TEST_F(utest_kdtree, search_cell_pruning) {
+    const std::size_t size = 4000;
+    const std::size_t dimension = 12;
+
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    dataset data(size, point(dimension));
+    for (auto & object : data) {
+        std::generate(object.begin(), object.end(), [&generator, &distribution]() { return distribution(generator); });
+    }
+
+    tree = kdtree(data);
+
+    /* each coordinate is close to the data, but the point is far from all of them */
+    const point query(dimension, 1.5);
+
+    performance_statistics statistics;
+    {
+        statistics_collector collector(statistics, true);
+
+        std::vector<double> distances;
+        std::vector<kdnode::ptr> nodes;
+        kdtree_searcher(query, tree.get_root(), 1.2).find_nearest_nodes(distances, nodes);
+        ASSERT_TRUE(nodes.empty());
+    }
+
+    ASSERT_GT(statistics.get_counter(counter_t::KDTREE_NODES_VISITED), 0U);
+    ASSERT_LT(statistics.get_counter(counter_t::KDTREE_NODES_VISITED), size / 4);
+}
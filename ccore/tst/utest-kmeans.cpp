@@ -278,6 +278,22 @@ TEST(utest_kmeans, collect_evolution_sample_simple_02) {
 }
 
 
+TEST(utest_kmeans, allocation_sample_simple_01_dense_dataset) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    dataset start_centers = { { 3.7, 5.5 },{ 6.7, 7.5 } };
+
+    kmeans_data expected_result;
+    kmeans(start_centers, 0.0001).process(*data, expected_result);
+
+    kmeans_data actual_result;
+    kmeans(start_centers, 0.0001).process(ccore::container::dense_dataset(*data), actual_result);
+
+    ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+    ASSERT_EQ(expected_result.centers(), actual_result.centers());
+    ASSERT_DOUBLE_EQ(expected_result.wce(), actual_result.wce());
+}
+
+
 #ifdef UT_PERFORMANCE_SESSION
 TEST(performance_kmeans, big_data) {
     auto points = simple_sample_factory::create_random_sample(100000, 10);
@@ -323,3 +323,29 @@ TEST(utest_kmeans_plus_plus, indexes_less_than_centers) {
     dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
     ASSERT_THROW(template_kmeans_plus_plus_initialization_range(data, 2, kmeans_plus_plus::FARTHEST_CENTER_CANDIDATE, range), std::invalid_argument);
 }
+
+
+TEST(utest_kmeans_plus_plus, dense_dataset_range) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    const ccore::container::dense_dataset dense_data(*data);
+    const index_sequence range = { 1, 5, 10, 21, 35, 50 };
+
+    for (const auto & initializer : { kmeans_plus_plus(2, kmeans_plus_plus::FARTHEST_CENTER_CANDIDATE),
+                                      kmeans_plus_plus(2, kmeans_plus_plus::FARTHEST_CENTER_CANDIDATE, manhattan_distance<point>) })
+    {
+        dataset actual_centers;
+        initializer.initialize(dense_data, range, actual_centers);
+
+        ASSERT_EQ(2U, actual_centers.size());
+        for (auto & center : actual_centers) {
+            auto object = std::find_if(range.begin(), range.end(), [&data, &center](const std::size_t p_index) { return (*data)[p_index] == center; });
+            ASSERT_NE(range.end(), object);
+        }
+
+        /* the first center is random, the second one is the farthest from the first */
+        ASSERT_NE(actual_centers[0], actual_centers[1]);
+    }
+
+    dataset centers;
+    ASSERT_THROW(kmeans_plus_plus(7).initialize(dense_data, range, centers), std::invalid_argument);
+}
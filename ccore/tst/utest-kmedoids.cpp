@@ -282,6 +282,64 @@ TEST(utest_kmedoids, totally_similar_data) {
 
 
 //#define UT_PERFORMANCE_SESSION
+TEST(utest_kmedoids, allocation_sample_simple_01_dense_dataset) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    const medoid_sequence start_medoids = { 1, 5 };
+
+    kmedoids_data expected_result;
+    kmedoids(start_medoids, 0.0001).process(*data, expected_result);
+
+    kmedoids_data actual_result;
+    kmedoids(start_medoids, 0.0001).process(ccore::container::dense_dataset(*data), actual_result);
+
+    ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+    ASSERT_EQ(expected_result.medoids(), actual_result.medoids());
+}
+
+
+template <typename TypeValue>
+static void
+template_kmedoids_length_process_pairwise_matrix(const dataset_ptr p_data,
+        const medoid_sequence & p_start_medians,
+        const std::vector<size_t> & p_expected_cluster_length,
+        const distance_metric<point> & p_metric,
+        const ccore::container::distance_matrix_layout p_layout) {
+
+    const ccore::container::dense_dataset points(*p_data);
+    const auto matrix = ccore::container::pairwise_distance_matrix<TypeValue>::create(points, p_metric, p_layout);
+
+    kmedoids_data output_result;
+    kmedoids solver(p_start_medians, 0.0001);
+    solver.process(matrix, output_result);
+
+    const cluster_sequence & actual_clusters = output_result.clusters();
+
+    ASSERT_EQ(p_start_medians.size(), actual_clusters.size());
+    ASSERT_CLUSTER_SIZES(*p_data, actual_clusters, p_expected_cluster_length);
+}
+
+
+TEST(utest_kmedoids, allocation_sample_simple_01_condensed_matrix) {
+    const medoid_sequence start_medoids = { 1, 5 };
+    const std::vector<size_t> expected_clusters_length = { 5, 5 };
+    template_kmedoids_length_process_pairwise_matrix<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01), start_medoids, expected_clusters_length, distance_metric_factory<point>::euclidean_square(), ccore::container::distance_matrix_layout::CONDENSED);
+}
+
+
+TEST(utest_kmedoids, allocation_sample_simple_02_condensed_float_matrix) {
+    const medoid_sequence start_medoids = { 3, 12, 20 };
+    const std::vector<size_t> expected_clusters_length = { 10, 5, 8 };
+    template_kmedoids_length_process_pairwise_matrix<float>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), start_medoids, expected_clusters_length, distance_metric_factory<point>::manhattan(), ccore::container::distance_matrix_layout::CONDENSED);
+}
+
+
+TEST(utest_kmedoids, allocation_sample_simple_02_square_matrix) {
+    const medoid_sequence start_medoids = { 3, 12, 20 };
+    const std::vector<size_t> expected_clusters_length = { 10, 5, 8 };
+    template_kmedoids_length_process_pairwise_matrix<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), start_medoids, expected_clusters_length, distance_metric_factory<point>::euclidean(), ccore::container::distance_matrix_layout::SQUARE);
+}
+
+
 #ifdef UT_PERFORMANCE_SESSION
 
 #include <chrono>
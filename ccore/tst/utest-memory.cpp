@@ -0,0 +1,184 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "cluster/rock.hpp"
+
+#include "container/adjacency_bit_matrix.hpp"
+#include "container/adjacency_matrix.hpp"
+#include "container/dense_dataset.hpp"
+
+#include "nnet/sync.hpp"
+
+#include "utils/memory.hpp"
+
+#include "samples.hpp"
+
+#include <stdexcept>
+
+
+using namespace ccore::clst;
+using namespace ccore::container;
+using namespace ccore::nnet;
+using namespace ccore::utils::memory;
+
+
+TEST(utest_memory, reservation_copy_move) {
+    const std::size_t initial = memory_usage::get_current();
+    {
+        memory_reservation reservation(1000);
+        ASSERT_EQ(initial + 1000, memory_usage::get_current());
+
+        memory_reservation copy(reservation);
+        ASSERT_EQ(initial + 2000, memory_usage::get_current());
+
+        memory_reservation moved(std::move(copy));
+        ASSERT_EQ(initial + 2000, memory_usage::get_current());
+        ASSERT_EQ(0U, copy.get_bytes());
+
+        reservation.reset(500);
+        ASSERT_EQ(initial + 1500, memory_usage::get_current());
+
+        reservation = std::move(moved);
+        ASSERT_EQ(initial + 1000, memory_usage::get_current());
+    }
+
+    ASSERT_EQ(initial, memory_usage::get_current());
+}
+
+
+TEST(utest_memory, peak_tracker) {
+    const std::size_t initial = memory_usage::get_current();
+
+    memory_peak_tracker outer_tracker;
+    ASSERT_EQ(initial, outer_tracker.get_peak());
+
+    {
+        memory_reservation reservation(4096);
+        ASSERT_GE(memory_usage::get_peak(), memory_usage::get_current());
+    }
+
+    {
+        /* the second tracker does not reset the peak of the first one */
+        memory_peak_tracker inner_tracker;
+        ASSERT_EQ(initial, inner_tracker.get_peak());
+
+        memory_reservation reservation(1024);
+        ASSERT_EQ(initial + 1024, inner_tracker.get_peak());
+    }
+
+    ASSERT_EQ(initial + 4096, outer_tracker.get_peak());
+    ASSERT_GE(memory_usage::get_peak(), initial + 4096);
+}
+
+
+TEST(utest_memory, tracked_containers) {
+    const std::size_t initial = memory_usage::get_current();
+    {
+        adjacency_matrix matrix(100);
+        ASSERT_GE(memory_usage::get_current(), initial + 100 * 100 * sizeof(double));
+
+        matrix.clear();
+        ASSERT_EQ(initial, memory_usage::get_current());
+
+        dense_dataset data(1000, 4);
+        ASSERT_EQ(initial + 1000 * 4 * sizeof(double), memory_usage::get_current());
+    }
+
+    ASSERT_EQ(initial, memory_usage::get_current());
+}
+
+
+TEST(utest_memory, bit_matrix_is_compact) {
+    const std::size_t size = 1000;
+    const std::size_t initial = memory_usage::get_current();
+
+    adjacency_bit_matrix matrix(size);
+    const std::size_t used = memory_usage::get_current() - initial;
+    ASSERT_LT(used, size * size / 4);
+
+    matrix.set_connection(3, size - 1);
+    matrix.set_connection(size - 1, 64);
+    ASSERT_TRUE(matrix.has_connection(3, size - 1));
+    ASSERT_TRUE(matrix.has_connection(size - 1, 64));
+    ASSERT_FALSE(matrix.has_connection(3, size - 2));
+    ASSERT_THROW(matrix.set_connection(0, size), std::out_of_range);
+}
+
+
+TEST(utest_memory, rock_statistics) {
+    dataset_ptr sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    rock_data result;
+    result.enable_statistics(true);
+    rock(1.0, 2, 0.5).process(*sample, result);
+
+    const std::size_t matrix_size = sample->size() * sample->size() * sizeof(double);
+    ASSERT_GE(result.statistics().get_peak_memory(), matrix_size);
+    ASSERT_LT(result.statistics().get_current_memory(), result.statistics().get_peak_memory());
+    ASSERT_TRUE(result.is_statistics_enabled());
+}
+
+
+TEST(utest_memory, sync_dynamic_statistics) {
+    sync_network network(20, 1.0, 0.0, connection_t::CONNECTION_ALL_TO_ALL, initial_type::EQUIPARTITION);
+
+    sync_dynamic output_dynamic;
+    output_dynamic.enable_statistics(true);
+    network.simulate_static(10, 1.0, solve_type::FORWARD_EULER, true, output_dynamic);
+
+    ASSERT_GE(output_dynamic.statistics().get_current_memory(), output_dynamic.size() * 20 * sizeof(double));
+    ASSERT_GE(output_dynamic.statistics().get_peak_memory(), output_dynamic.statistics().get_current_memory());
+}
+
+
+TEST(utest_memory, estimate_quadratic_algorithms) {
+    const std::size_t rock_small = estimate_memory("rock", { }, 1000, 2);
+    const std::size_t rock_large = estimate_memory("rock", { }, 2000, 2);
+
+    ASSERT_GE(rock_small, 1000 * 1000 * sizeof(double));
+    ASSERT_GT(rock_large, 3 * rock_small);
+
+    const std::size_t syncnet = estimate_memory("syncnet", { 0.0 }, 1000, 2);
+    const std::size_t syncnet_weights = estimate_memory("syncnet", { 1.0 }, 1000, 2);
+    ASSERT_GE(syncnet_weights, syncnet + 1000 * 1000 * sizeof(double));
+
+    const std::size_t som = estimate_memory("som", { 10, 10 }, 1000, 2);
+    ASSERT_GE(som, 100 * 100 * sizeof(double));
+}
+
+
+TEST(utest_memory, estimate_linear_algorithms) {
+    const std::size_t kmeans = estimate_memory("kmeans", { 10 }, 100000, 8);
+    ASSERT_GE(kmeans, 2 * 100000 * 8 * sizeof(double));
+    ASSERT_LT(kmeans, estimate_memory("kmeans", { 10 }, 200000, 8));
+
+    ASSERT_GT(estimate_memory("sync", { 100 }, 1000, 0), estimate_memory("sync", { 1 }, 1000, 0));
+    ASSERT_GT(estimate_memory("dbscan", { }, 1000, 2), 0U);
+    ASSERT_GT(estimate_memory("optics", { }, 1000, 2), estimate_memory("dbscan", { }, 1000, 2));
+    ASSERT_GT(estimate_memory("dbscan", { 100 }, 1000, 2), estimate_memory("dbscan", { 10 }, 1000, 2));
+}
+
+
+TEST(utest_memory, estimate_unknown_algorithm) {
+    ASSERT_THROW(estimate_memory("unknown", { }, 10, 2), std::invalid_argument);
+}
@@ -0,0 +1,131 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "parallel/mpmc_queue.hpp"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using namespace ccore::parallel;
+
+
+TEST(utest_mpmc_queue, incorrect_capacity) {
+    ASSERT_THROW(mpmc_queue<int>(0), std::invalid_argument);
+    ASSERT_THROW(mpmc_queue<int>(1), std::invalid_argument);
+    ASSERT_THROW(mpmc_queue<int>(12), std::invalid_argument);
+}
+
+
+TEST(utest_mpmc_queue, fifo_order) {
+    mpmc_queue<int> queue(8);
+    ASSERT_EQ(8U, queue.capacity());
+
+    int value = 0;
+    ASSERT_FALSE(queue.try_pop(value));
+
+    for (int lap = 0; lap < 3; lap++) {
+        for (int i = 0; i < 8; i++) {
+            int element = lap * 10 + i;
+            ASSERT_TRUE(queue.try_push(element));
+        }
+
+        int overflow = -1;
+        ASSERT_FALSE(queue.try_push(overflow));
+        ASSERT_EQ(-1, overflow);
+
+        for (int i = 0; i < 8; i++) {
+            ASSERT_TRUE(queue.try_pop(value));
+            ASSERT_EQ(lap * 10 + i, value);
+        }
+
+        ASSERT_FALSE(queue.try_pop(value));
+    }
+}
+
+
+TEST(utest_mpmc_queue, move_only_values) {
+    mpmc_queue<std::unique_ptr<int>> queue(4);
+
+    std::unique_ptr<int> value(new int(5));
+    ASSERT_TRUE(queue.try_push(value));
+    ASSERT_EQ(nullptr, value);
+
+    std::unique_ptr<int> result;
+    ASSERT_TRUE(queue.try_pop(result));
+    ASSERT_EQ(5, *result);
+}
+
+
+TEST(utest_mpmc_queue, multiple_producers_consumers) {
+    const std::size_t amount_producers = 4;
+    const std::size_t amount_consumers = 4;
+    const std::size_t amount_values = 20000;
+
+    mpmc_queue<std::size_t> queue(64);
+
+    std::vector<std::atomic<std::size_t>> visits(amount_producers * amount_values);
+    for (auto & counter : visits) {
+        counter.store(0);
+    }
+
+    std::atomic<std::size_t> consumed(0);
+    std::vector<std::thread> threads;
+
+    for (std::size_t index_producer = 0; index_producer < amount_producers; index_producer++) {
+        threads.emplace_back([&queue, index_producer, amount_values]() {
+            for (std::size_t i = 0; i < amount_values; i++) {
+                std::size_t value = index_producer * amount_values + i;
+                while (!queue.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::size_t index_consumer = 0; index_consumer < amount_consumers; index_consumer++) {
+        threads.emplace_back([&queue, &visits, &consumed]() {
+            while (consumed.load() < visits.size()) {
+                std::size_t value = 0;
+                if (queue.try_pop(value)) {
+                    visits[value]++;
+                    consumed++;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto & thread : threads) {
+        thread.join();
+    }
+
+    for (const auto & counter : visits) {
+        ASSERT_EQ(1U, counter.load());
+    }
+}
@@ -0,0 +1,175 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "samples.hpp"
+
+#include "container/neighbor_graph.hpp"
+
+#include "utils/metric.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+using namespace ccore::container;
+using namespace ccore::utils::metric;
+
+
+static void template_neighbor_graph(const dataset & p_data, const double p_radius, const bool p_distances, const spatial_index_t p_index) {
+    const neighbor_graph graph(dense_dataset(p_data), p_radius, p_distances, p_index);
+
+    ASSERT_EQ(p_data.size(), graph.size());
+    ASSERT_EQ(p_data.size() + 1, graph.get_offsets().size());
+    ASSERT_EQ(p_radius, graph.get_radius());
+    ASSERT_EQ(p_distances, graph.has_distances());
+    ASSERT_EQ(graph.get_amount_edges(), graph.get_indexes().size());
+    ASSERT_EQ(p_distances ? graph.get_amount_edges() : 0U, graph.get_distances().size());
+
+    const auto & offsets = graph.get_offsets();
+    const auto & indexes = graph.get_indexes();
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        std::vector<std::size_t> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < p_data.size(); index_neighbor++) {
+            if ( (index_neighbor != index) && (euclidean_distance_square(p_data[index], p_data[index_neighbor]) <= p_radius * p_radius) ) {
+                expected.push_back(index_neighbor);
+            }
+        }
+
+        ASSERT_EQ(expected.size(), graph.get_amount_neighbors(index));
+
+        std::vector<std::size_t> actual(indexes.begin() + offsets[index], indexes.begin() + offsets[index + 1]);
+        for (std::size_t position = offsets[index]; p_distances && (position < offsets[index + 1]); position++) {
+            ASSERT_DOUBLE_EQ(euclidean_distance(p_data[index], p_data[indexes[position]]), graph.get_distances()[position]);
+        }
+
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+
+TEST(utest_neighbor_graph, simple_01_static) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    template_neighbor_graph(*sample, 0.5, true, spatial_index_t::KDTREE_STATIC);
+}
+
+
+TEST(utest_neighbor_graph, simple_01_kdtree) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    template_neighbor_graph(*sample, 0.5, true, spatial_index_t::KDTREE);
+}
+
+
+TEST(utest_neighbor_graph, identical_simple_09_without_distances) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09);
+    template_neighbor_graph(*sample, 1.0, false, spatial_index_t::KDTREE_STATIC);
+    template_neighbor_graph(*sample, 1.0, false, spatial_index_t::KDTREE);
+}
+
+
+TEST(utest_neighbor_graph, lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    template_neighbor_graph(*sample, 0.5, true, spatial_index_t::KDTREE_STATIC);
+    template_neighbor_graph(*sample, 0.5, false, spatial_index_t::KDTREE);
+}
+
+
+TEST(utest_neighbor_graph, empty_and_isolated) {
+    template_neighbor_graph(dataset(), 1.0, true, spatial_index_t::KDTREE_STATIC);
+    template_neighbor_graph({ { 0.0 }, { 10.0 }, { 20.0 } }, 1.0, true, spatial_index_t::KDTREE_STATIC);
+
+    const neighbor_graph graph;
+    ASSERT_TRUE(graph.empty());
+    ASSERT_EQ(0U, graph.get_amount_edges());
+}
+
+
+TEST(utest_neighbor_graph, lsun_vptree) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    template_neighbor_graph(*sample, 0.5, true, spatial_index_t::VPTREE);
+}
+
+
+TEST(utest_neighbor_graph, manhattan_vptree) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    const auto metric = distance_metric_factory<point>::manhattan();
+    const double radius = 0.8;
+
+    const neighbor_graph graph(dense_dataset(*sample), radius, true, spatial_index_t::VPTREE, metric);
+
+    const auto & offsets = graph.get_offsets();
+    const auto & indexes = graph.get_indexes();
+    for (std::size_t index = 0; index < sample->size(); index++) {
+        std::vector<std::size_t> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < sample->size(); index_neighbor++) {
+            if ( (index_neighbor != index) && (metric((*sample)[index], (*sample)[index_neighbor]) <= radius) ) {
+                expected.push_back(index_neighbor);
+            }
+        }
+
+        for (std::size_t position = offsets[index]; position < offsets[index + 1]; position++) {
+            ASSERT_DOUBLE_EQ(metric((*sample)[index], (*sample)[indexes[position]]), graph.get_distances()[position]);
+        }
+
+        std::vector<std::size_t> actual(indexes.begin() + offsets[index], indexes.begin() + offsets[index + 1]);
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+
+TEST(utest_neighbor_graph, kdtree_non_euclidean_metric) {
+    const dense_dataset data { dataset({ { 0.0 }, { 1.0 } }) };
+    const auto metric = distance_metric_factory<point>::chebyshev();
+
+    ASSERT_THROW(neighbor_graph(data, 1.0, false, spatial_index_t::KDTREE_STATIC, metric), std::invalid_argument);
+    ASSERT_THROW(neighbor_graph(data, 1.0, false, spatial_index_t::KDTREE, metric), std::invalid_argument);
+    ASSERT_THROW(neighbor_searcher(data, spatial_index_t::KDTREE_STATIC, metric), std::invalid_argument);
+}
+
+
+TEST(utest_neighbor_graph, searcher_same_as_graph) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    const dense_dataset data(*sample);
+    const double radius = 0.5;
+
+    for (const auto index_type : { spatial_index_t::KDTREE_STATIC, spatial_index_t::KDTREE, spatial_index_t::VPTREE }) {
+        const neighbor_searcher searcher(data, index_type);
+        const neighbor_graph graph(data, radius, true, index_type);
+        ASSERT_EQ(data.size(), searcher.size());
+
+        const auto & offsets = graph.get_offsets();
+        for (std::size_t index = 0; index < data.size(); index++) {
+            std::vector<std::size_t> indexes;
+            std::vector<double> distances;
+            searcher.find_neighbors(index, radius, [&indexes, &distances](const std::size_t p_neighbor, const double p_distance) {
+                indexes.push_back(p_neighbor);
+                distances.push_back(p_distance);
+            });
+
+            ASSERT_EQ(std::vector<std::size_t>(graph.get_indexes().begin() + offsets[index], graph.get_indexes().begin() + offsets[index + 1]), indexes);
+            ASSERT_EQ(std::vector<double>(graph.get_distances().begin() + offsets[index], graph.get_distances().begin() + offsets[index + 1]), distances);
+        }
+    }
+}
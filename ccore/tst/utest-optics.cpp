@@ -28,6 +28,8 @@
 
 #include "samples.hpp"
 #include "utenv_check.hpp"
+
+#include <algorithm>
 
 
 using namespace ccore::clst;
@@ -300,3 +302,97 @@ TEST(utest_optics, noise_cluster_allocation_sample_simple_02_distance_matrix) {
     const std::vector<size_t> expected_clusters_length = { 10 };
     template_optics_noise_allocation_distance_matrix(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), 2.0, 9, 0, expected_clusters_length, 13);
 }
+
+
+TEST(utest_optics, allocation_sample_simple_02_dense_dataset) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02);
+
+    optics_data expected_result;
+    optics(1.0, 2).process(*data, expected_result);
+
+    optics_data actual_result;
+    optics(1.0, 2).process(ccore::container::dense_dataset(*data), actual_result);
+
+    ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+    ASSERT_EQ(expected_result.noise(), actual_result.noise());
+    ASSERT_EQ(expected_result.cluster_ordering(), actual_result.cluster_ordering());
+}
+
+
+TEST(utest_optics, spatial_index_identical_results) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+
+    optics_data result_static, result_dynamic;
+
+    optics solver(0.5, 3);
+    ASSERT_EQ(ccore::container::spatial_index_t::KDTREE_STATIC, solver.get_spatial_index());
+    solver.process(*sample, result_static);
+
+    solver.set_spatial_index(ccore::container::spatial_index_t::KDTREE);
+    solver.process(*sample, result_dynamic);
+
+    ASSERT_EQ(result_dynamic.clusters(), result_static.clusters());
+    ASSERT_EQ(result_dynamic.noise(), result_static.noise());
+    ASSERT_EQ(result_dynamic.cluster_ordering(), result_static.cluster_ordering());
+}
+
+
+TEST(utest_optics, neighbor_graph_reuse) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    const ccore::container::neighbor_graph graph(ccore::container::dense_dataset(*sample), 1.0, true);
+
+    for (const double radius : { 0.5, 1.0 }) {
+        optics_data expected_result, actual_result;
+        optics(radius, 3).process(*sample, expected_result);
+        optics(radius, 3).process(graph, actual_result);
+
+        ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+        ASSERT_EQ(expected_result.noise(), actual_result.noise());
+        ASSERT_EQ(expected_result.cluster_ordering(), actual_result.cluster_ordering());
+    }
+}
+
+
+TEST(utest_optics, neighbor_graph_wrong_arguments) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    const ccore::container::dense_dataset data(*sample);
+
+    optics_data result;
+    ASSERT_THROW(optics(0.5, 3).process(ccore::container::neighbor_graph(data, 0.5, false), result), std::invalid_argument);
+    ASSERT_THROW(optics(0.5, 3).process(ccore::container::neighbor_graph(data, 0.4, true), result), std::invalid_argument);
+}
+
+
+TEST(utest_optics, vptree_non_euclidean_metric) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+
+    for (const auto & metric : { distance_metric_factory<point>::manhattan(), distance_metric_factory<point>::chebyshev() }) {
+        dataset matrix(sample->size(), point(sample->size()));
+        for (std::size_t i = 0; i < sample->size(); i++) {
+            for (std::size_t j = 0; j < sample->size(); j++) {
+                matrix[i][j] = metric((*sample)[i], (*sample)[j]);
+            }
+        }
+
+        optics_data expected_result, actual_result;
+
+        optics solver(0.5, 3);
+        solver.set_metric(metric);
+        ASSERT_EQ(metric.get_type(), solver.get_metric().get_type());
+        ASSERT_THROW(solver.process(*sample, actual_result), std::invalid_argument);
+
+        solver.process(matrix, optics_data_t::DISTANCE_MATRIX, expected_result);
+
+        solver.set_spatial_index(ccore::container::spatial_index_t::VPTREE);
+        solver.process(*sample, actual_result);
+
+        for (auto result : { &expected_result, &actual_result }) {
+            for (auto & cluster : result->clusters()) {
+                std::sort(cluster.begin(), cluster.end());
+            }
+        }
+
+        ASSERT_EQ(expected_result.clusters(), actual_result.clusters());
+        ASSERT_EQ(expected_result.noise(), actual_result.noise());
+    }
+}
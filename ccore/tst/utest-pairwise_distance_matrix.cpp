@@ -0,0 +1,213 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "container/pairwise_distance_matrix.hpp"
+
+#include "utils/metric.hpp"
+
+#include "samples.hpp"
+
+
+using namespace ccore::container;
+using namespace ccore::utils::metric;
+
+
+template <typename TypeValue>
+static void
+template_compare_with_metric(const dataset_ptr & p_sample,
+        const distance_metric<point> & p_metric,
+        const distance_matrix_layout p_layout,
+        const double p_tolerance)
+{
+    const dense_dataset data(*p_sample);
+    const pairwise_distance_matrix<TypeValue> matrix = pairwise_distance_matrix<TypeValue>::create(data, p_metric, p_layout);
+
+    ASSERT_EQ(data.size(), matrix.size());
+    ASSERT_EQ(p_layout, matrix.layout());
+    ASSERT_EQ(pairwise_distance_matrix<TypeValue>::get_storage_size(data.size(), p_layout), matrix.storage_size());
+
+    for (std::size_t i = 0; i < data.size(); i++) {
+        for (std::size_t j = 0; j < data.size(); j++) {
+            const double expected = (i == j) ? 0.0 : p_metric(p_sample->at(i), p_sample->at(j));
+            ASSERT_NEAR(expected, (double) matrix(i, j), p_tolerance);
+            ASSERT_EQ(matrix(i, j), matrix(j, i));
+        }
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, create_empty) {
+    pairwise_distance_matrix<double> matrix;
+
+    ASSERT_TRUE(matrix.empty());
+    ASSERT_EQ(0U, matrix.size());
+    ASSERT_EQ(0U, matrix.storage_size());
+}
+
+
+TEST(utest_pairwise_distance_matrix, storage_size) {
+    ASSERT_EQ(0U, pairwise_distance_matrix<double>::get_storage_size(0, distance_matrix_layout::CONDENSED));
+    ASSERT_EQ(0U, pairwise_distance_matrix<double>::get_storage_size(1, distance_matrix_layout::CONDENSED));
+    ASSERT_EQ(10U, pairwise_distance_matrix<double>::get_storage_size(5, distance_matrix_layout::CONDENSED));
+    ASSERT_EQ(25U, pairwise_distance_matrix<double>::get_storage_size(5, distance_matrix_layout::SQUARE));
+}
+
+
+TEST(utest_pairwise_distance_matrix, condensed_index) {
+    const std::size_t size = 5;
+
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < size; i++) {
+        for (std::size_t j = i + 1; j < size; j++) {
+            ASSERT_EQ(expected, pairwise_distance_matrix<double>::get_condensed_index(i, j, size));
+            expected++;
+        }
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, set_and_at) {
+    for (const auto layout : { distance_matrix_layout::CONDENSED, distance_matrix_layout::SQUARE }) {
+        pairwise_distance_matrix<float> matrix(3, layout);
+        matrix.set(0, 2, 1.5f);
+        matrix.set(2, 1, 2.5f);
+
+        ASSERT_EQ(1.5f, matrix.at(0, 2));
+        ASSERT_EQ(1.5f, matrix.at(2, 0));
+        ASSERT_EQ(2.5f, matrix.at(1, 2));
+        ASSERT_EQ(0.0f, matrix.at(0, 1));
+        ASSERT_EQ(0.0f, matrix.at(1, 1));
+
+        ASSERT_THROW(matrix.at(3, 0), std::out_of_range);
+        ASSERT_THROW(matrix.at(0, 3), std::out_of_range);
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, for_each_distance) {
+    const dense_dataset data(*simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02));
+
+    for (const auto layout : { distance_matrix_layout::CONDENSED, distance_matrix_layout::SQUARE }) {
+        const auto matrix = pairwise_distance_matrix<double>::create(data, distance_metric_factory<point>::euclidean(), layout);
+
+        for (std::size_t i = 0; i < matrix.size(); i++) {
+            std::vector<std::size_t> visited;
+            matrix.for_each_distance(i, [&matrix, &visited, i](const std::size_t p_neighbor, const double p_distance) {
+                ASSERT_EQ(matrix(i, p_neighbor), p_distance);
+                visited.push_back(p_neighbor);
+            });
+
+            ASSERT_EQ(matrix.size() - 1, visited.size());
+            for (std::size_t j = 0, k = 0; j < matrix.size(); j++) {
+                if (j != i) {
+                    ASSERT_EQ(j, visited[k++]);
+                }
+            }
+        }
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, euclidean_condensed) {
+    template_compare_with_metric<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), distance_metric_factory<point>::euclidean(), distance_matrix_layout::CONDENSED, 0.0);
+}
+
+
+TEST(utest_pairwise_distance_matrix, euclidean_square) {
+    template_compare_with_metric<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), distance_metric_factory<point>::euclidean(), distance_matrix_layout::SQUARE, 0.0);
+}
+
+
+TEST(utest_pairwise_distance_matrix, manhattan_float_condensed) {
+    template_compare_with_metric<float>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03), distance_metric_factory<point>::manhattan(), distance_matrix_layout::CONDENSED, 0.00001);
+}
+
+
+TEST(utest_pairwise_distance_matrix, minkowski_square) {
+    template_compare_with_metric<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_04), distance_metric_factory<point>::minkowski(4.0), distance_matrix_layout::SQUARE, 0.0000001);
+}
+
+
+TEST(utest_pairwise_distance_matrix, user_defined_condensed) {
+    auto user_metric = [](const point & p1, const point & p2) { return std::abs(p1[0] - p2[0]); };
+    template_compare_with_metric<double>(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02), distance_metric_factory<point>::user_defined(user_metric), distance_matrix_layout::CONDENSED, 0.0);
+}
+
+
+TEST(utest_pairwise_distance_matrix, several_tiles_condensed) {
+    template_compare_with_metric<double>(fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN), distance_metric_factory<point>::euclidean_square(), distance_matrix_layout::CONDENSED, 0.0);
+}
+
+
+TEST(utest_pairwise_distance_matrix, several_tiles_square) {
+    template_compare_with_metric<float>(fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN), distance_metric_factory<point>::chebyshev(), distance_matrix_layout::SQUARE, 0.00001);
+}
+
+
+TEST(utest_pairwise_distance_matrix, callable_metric) {
+    const dense_dataset data(*simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01));
+    const auto matrix = pairwise_distance_matrix<double>::create(data, manhattan_distance_policy());
+
+    for (std::size_t i = 0; i < data.size(); i++) {
+        for (std::size_t j = i + 1; j < data.size(); j++) {
+            ASSERT_EQ(manhattan_distance(data.row(i), data.row(j)), matrix(i, j));
+        }
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, square_views) {
+    const dataset rows = { { 0.0, 1.0, 2.0 }, { 1.0, 0.0, 3.0 }, { 2.0, 3.0, 0.0 } };
+    const dense_dataset dense_rows(rows);
+
+    const pairwise_distance_matrix<double> row_view(rows);
+    const pairwise_distance_matrix<double> dense_view(dense_rows);
+
+    for (const auto * matrix : { &row_view, &dense_view }) {
+        ASSERT_TRUE(matrix->is_view());
+        ASSERT_EQ(distance_matrix_layout::SQUARE, matrix->layout());
+        ASSERT_EQ(3U, matrix->size());
+        ASSERT_EQ(0U, matrix->storage_size());
+
+        for (std::size_t i = 0; i < rows.size(); i++) {
+            std::size_t visited = 0;
+            matrix->for_each_distance(i, [&rows, &visited, i](const std::size_t p_neighbor, const double p_distance) {
+                ASSERT_NE(i, p_neighbor);
+                ASSERT_EQ(rows[i][p_neighbor], p_distance);
+                visited++;
+            });
+
+            ASSERT_EQ(2U, visited);
+            for (std::size_t j = 0; j < rows.size(); j++) {
+                ASSERT_EQ(rows[i][j], (*matrix)(i, j));
+            }
+        }
+    }
+}
+
+
+TEST(utest_pairwise_distance_matrix, square_view_wrong_size) {
+    const dataset rows = { { 0.0, 1.0 }, { 1.0, 0.0 }, { 2.0, 3.0 } };
+    ASSERT_THROW(pairwise_distance_matrix<double> { rows }, std::invalid_argument);
+    ASSERT_THROW(pairwise_distance_matrix<double> { dense_dataset(rows) }, std::invalid_argument);
+}
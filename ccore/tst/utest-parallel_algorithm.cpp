@@ -0,0 +1,162 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "parallel/execution_context.hpp"
+#include "parallel/parallel_algorithm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+
+using namespace ccore::parallel;
+
+
+static std::vector<double> generate_values(const std::size_t p_length) {
+    std::mt19937 generator(static_cast<unsigned int>(p_length));
+    std::uniform_real_distribution<double> distribution(-100.0, 100.0);
+
+    std::vector<double> values(p_length);
+    for (auto & value : values) {
+        value = distribution(generator);
+    }
+
+    return values;
+}
+
+
+TEST(utest_parallel_algorithm, reduce_empty) {
+    const std::vector<int> values;
+    ASSERT_EQ(5, parallel_reduce(values.begin(), values.end(), 5, std::plus<int>()));
+    ASSERT_EQ(7, parallel_transform_reduce(10, 3, 7, std::plus<int>(), [](const int p_index) { return p_index; }));
+}
+
+
+TEST(utest_parallel_algorithm, reduce_integers) {
+    for (const std::size_t length : { 1, 2, 17, 1000, 100000 }) {
+        std::vector<long long> values(length);
+        std::iota(values.begin(), values.end(), 1);
+
+        const long long expected = (long long) length * ((long long) length + 1) / 2 + 3;
+        ASSERT_EQ(expected, parallel_reduce(values.begin(), values.end(), 3LL, std::plus<long long>()));
+        ASSERT_EQ(expected, parallel_reduce(values.begin(), values.end(), 3LL, std::plus<long long>(), 100));
+    }
+}
+
+
+TEST(utest_parallel_algorithm, transform_reduce_maximum) {
+    const std::vector<double> values = generate_values(12345);
+    const auto maximum = [](const double p_value1, const double p_value2) { return std::max(p_value1, p_value2); };
+
+    const double result = parallel_transform_reduce(std::size_t(0), values.size(), 0.0, maximum,
+        [&values](const std::size_t p_index) { return std::abs(values[p_index]); });
+
+    double expected = 0.0;
+    for (const double value : values) {
+        expected = std::max(expected, std::abs(value));
+    }
+
+    ASSERT_EQ(expected, result);
+}
+
+
+TEST(utest_parallel_algorithm, transform_reduce_deterministic) {
+    const std::vector<double> values = generate_values(100003);
+    const auto transform = [&values](const std::size_t p_index) { return values[p_index] * 1.000001; };
+
+    double expected = 0.0;
+    {
+        const execution_context serial(0, true);
+        execution_context_scope scope(serial);
+        expected = parallel_transform_reduce(std::size_t(0), values.size(), 0.0, std::plus<double>(), transform, 64);
+    }
+
+    for (const std::size_t amount_threads : { 2, 3, 4, 8 }) {
+        const execution_context context(amount_threads);
+        execution_context_scope scope(context);
+
+        for (std::size_t attempt = 0; attempt < 5; attempt++) {
+            ASSERT_EQ(expected, parallel_transform_reduce(std::size_t(0), values.size(), 0.0, std::plus<double>(), transform, 64));
+        }
+    }
+}
+
+
+TEST(utest_parallel_algorithm, inclusive_scan) {
+    for (const std::size_t length : { 0, 1, 2, 255, 256, 257, 1000, 65537 }) {
+        std::vector<long long> values(length);
+        std::iota(values.begin(), values.end(), -10);
+
+        std::vector<long long> expected(length);
+        std::partial_sum(values.begin(), values.end(), expected.begin());
+
+        std::vector<long long> result(length, 0);
+        ASSERT_EQ(result.end(), parallel_inclusive_scan(values.begin(), values.end(), result.begin()));
+        ASSERT_EQ(expected, result);
+
+        parallel_inclusive_scan(values.begin(), values.end(), values.begin(), std::plus<long long>(), 100);
+        ASSERT_EQ(expected, values);
+    }
+}
+
+
+TEST(utest_parallel_algorithm, inclusive_scan_maximum) {
+    const std::vector<double> values = generate_values(5000);
+
+    std::vector<double> result(values.size());
+    parallel_inclusive_scan(values.begin(), values.end(), result.begin(),
+        [](const double p_value1, const double p_value2) { return std::max(p_value1, p_value2); });
+
+    double running_maximum = values.front();
+    for (std::size_t i = 0; i < values.size(); i++) {
+        running_maximum = std::max(running_maximum, values[i]);
+        ASSERT_EQ(running_maximum, result[i]);
+    }
+}
+
+
+TEST(utest_parallel_algorithm, sort) {
+    for (const std::size_t length : { 0, 1, 2, 100, 8191, 8192, 20000, 100001 }) {
+        std::vector<double> values = generate_values(length);
+
+        std::vector<double> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        parallel_sort(values.begin(), values.end());
+        ASSERT_EQ(expected, values);
+    }
+}
+
+
+TEST(utest_parallel_algorithm, sort_comparator) {
+    std::vector<int> values(50000);
+    for (std::size_t i = 0; i < values.size(); i++) {
+        values[i] = (int) ((i * 7919) % 1000);
+    }
+
+    parallel_sort(values.begin(), values.end(), std::greater<int>());
+    ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<int>()));
+}
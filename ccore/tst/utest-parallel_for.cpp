@@ -24,6 +24,8 @@
 #include "parallel/parallel.hpp"
 
 #include <numeric>
+#include <stdexcept>
+#include <vector>
 
 
 using namespace ccore::parallel;
@@ -56,4 +58,132 @@ TEST(utest_parallel_for, square_10_elements) {
 
 TEST(utest_parallel_for, square_10000_elements) {
     template_parallel_square(10000);
-}
\ No newline at end of file
+}
+
+
+TEST(utest_parallel_for, nested_loops) {
+    const std::size_t amount_rows = 37, amount_columns = 101;
+    std::vector<std::vector<std::size_t>> results(amount_rows, std::vector<std::size_t>(amount_columns, 0));
+
+    parallel_for(std::size_t(0), amount_rows, [&results, amount_columns](const std::size_t p_row) {
+        parallel_for(std::size_t(0), amount_columns, [&results, p_row](const std::size_t p_column) {
+            results[p_row][p_column] = p_row * p_column;
+        });
+    });
+
+    for (std::size_t i = 0; i < amount_rows; i++) {
+        for (std::size_t j = 0; j < amount_columns; j++) {
+            ASSERT_EQ(i * j, results[i][j]);
+        }
+    }
+}
+
+
+TEST(utest_parallel_for, for_each_elements) {
+    std::vector<std::size_t> indexes(1000);
+    std::iota(indexes.begin(), indexes.end(), 0);
+
+    std::vector<std::size_t> results(indexes.size(), 0);
+    parallel_for_each(indexes, [&results](const std::size_t p_index) {
+        results[p_index] = p_index + 1;
+    });
+
+    for (std::size_t i = 0; i < indexes.size(); i++) {
+        ASSERT_EQ(i + 1, results[i]);
+    }
+}
+
+
+TEST(utest_parallel_for, empty_range) {
+    std::size_t counter = 0;
+    parallel_for(std::size_t(5), std::size_t(5), [&counter](const std::size_t) { counter++; });
+    parallel_for(10, 5, [&counter](const int) { counter++; });
+
+    ASSERT_EQ(0U, counter);
+}
+
+
+TEST(utest_parallel_for, exception_propagation) {
+    ASSERT_THROW(parallel_for(std::size_t(0), std::size_t(1000), [](const std::size_t p_index) {
+        if (p_index == 777) {
+            throw std::invalid_argument("failure");
+        }
+    }), std::invalid_argument);
+}
+
+
+static void template_parallel_schedule(const std::size_t p_start, const std::size_t p_end, const schedule & p_schedule) {
+    std::vector<std::size_t> visits(p_end, 0);
+    parallel_for(p_start, p_end, [&visits](const std::size_t p_index) {
+        visits[p_index]++;
+    }, p_schedule);
+
+    for (std::size_t i = 0; i < p_end; i++) {
+        ASSERT_EQ((i < p_start) ? 0U : 1U, visits[i]);
+    }
+}
+
+
+TEST(utest_parallel_for, schedule_static) {
+    for (const std::size_t grain : { 0, 1, 3, 100, 5000 }) {
+        template_parallel_schedule(0, 1, schedule(schedule_policy::STATIC, grain));
+        template_parallel_schedule(7, 1000, schedule(schedule_policy::STATIC, grain));
+        template_parallel_schedule(0, 10001, schedule(schedule_policy::STATIC, grain));
+    }
+}
+
+
+TEST(utest_parallel_for, schedule_dynamic) {
+    for (const std::size_t grain : { 0, 1, 3, 100, 5000 }) {
+        template_parallel_schedule(0, 1, schedule(schedule_policy::DYNAMIC, grain));
+        template_parallel_schedule(7, 1000, schedule(schedule_policy::DYNAMIC, grain));
+        template_parallel_schedule(0, 10001, schedule(schedule_policy::DYNAMIC, grain));
+    }
+}
+
+
+TEST(utest_parallel_for, schedule_guided) {
+    for (const std::size_t grain : { 0, 1, 3, 100, 5000 }) {
+        template_parallel_schedule(0, 1, schedule(schedule_policy::GUIDED, grain));
+        template_parallel_schedule(7, 1000, schedule(schedule_policy::GUIDED, grain));
+        template_parallel_schedule(0, 10001, schedule(schedule_policy::GUIDED, grain));
+    }
+}
+
+
+TEST(utest_parallel_for, schedule_empty_range) {
+    std::size_t counter = 0;
+    parallel_for(std::size_t(10), std::size_t(10), [&counter](const std::size_t) { counter++; }, schedule(schedule_policy::GUIDED));
+    parallel_for(std::size_t(10), std::size_t(5), [&counter](const std::size_t) { counter++; }, schedule(schedule_policy::DYNAMIC));
+    ASSERT_EQ(0U, counter);
+}
+
+
+TEST(utest_parallel_for, schedule_imbalanced_load) {
+    const std::size_t length = 64;
+
+    std::vector<double> results(length, 0.0);
+    parallel_for(std::size_t(0), length, [&results](const std::size_t p_index) {
+        const std::size_t amount_iterations = (p_index == 0) ? 200000 : 10;
+
+        double value = 0.0;
+        for (std::size_t i = 0; i < amount_iterations; i++) {
+            value += 1.0;
+        }
+        results[p_index] = value;
+    }, schedule(schedule_policy::GUIDED));
+
+    ASSERT_EQ(200000.0, results[0]);
+    for (std::size_t i = 1; i < length; i++) {
+        ASSERT_EQ(10.0, results[i]);
+    }
+}
+
+
+TEST(utest_parallel_for, schedule_exception) {
+    ASSERT_THROW(parallel_for(std::size_t(0), std::size_t(1000), [](const std::size_t p_index) {
+        if (p_index == 500) {
+            throw std::invalid_argument("failure");
+        }
+    }, schedule(schedule_policy::GUIDED, 2)), std::invalid_argument);
+}
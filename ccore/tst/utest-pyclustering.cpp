@@ -163,4 +163,219 @@ TEST(utest_pyclustering, package_unpack_empty) {
 
 TEST(utest_pyclustering, package_unpack_two_dimension) {
     template_pack_unpack(std::vector<std::vector<double>>({ { 1.2, 2.4 }, { 3.6, 4.8, 5.0 }, { 6.0 } }));
-}
\ No newline at end of file
+}
+
+
+TEST(utest_pyclustering, package_matrix_to_dense_view) {
+    double buffer[] = { 1.0, 2.0, 0.0, 3.0, 4.0, 0.0 };
+
+    pyclustering_package package(PYCLUSTERING_TYPE_MATRIX);
+    package.size = 2;
+    package.columns = 2;
+    package.stride = 3;
+    package.element_type = PYCLUSTERING_TYPE_DOUBLE;
+    package.data = buffer;
+
+    ccore::container::dense_dataset data;
+    package.extract(data);
+
+    ASSERT_TRUE(data.is_view());
+    ASSERT_EQ(buffer, data.data());
+    ASSERT_EQ(2U, data.size());
+    ASSERT_EQ(2U, data.dimension());
+    ASSERT_EQ(4.0, data.at(1, 1));
+
+    std::vector<std::vector<double>> unpack_container;
+    package.extract(unpack_container);
+    ASSERT_EQ(std::vector<std::vector<double>>({ { 1.0, 2.0 }, { 3.0, 4.0 } }), unpack_container);
+
+    package.data = nullptr;     /* buffer is not owned by the package */
+}
+
+
+TEST(utest_pyclustering, package_matrix_to_dense_conversion) {
+    long buffer[] = { 1, 2, 3, 4, 5, 6 };
+
+    pyclustering_package package(PYCLUSTERING_TYPE_MATRIX);
+    package.size = 3;
+    package.columns = 2;
+    package.stride = 2;
+    package.element_type = PYCLUSTERING_TYPE_LONG;
+    package.data = buffer;
+
+    ccore::container::dense_dataset data;
+    package.extract(data);
+
+    ASSERT_FALSE(data.is_view());
+
+    std::vector<std::vector<double>> unpack_container;
+    data.extract(unpack_container);
+    ASSERT_EQ(std::vector<std::vector<double>>({ { 1.0, 2.0 }, { 3.0, 4.0 }, { 5.0, 6.0 } }), unpack_container);
+
+    package.data = nullptr;     /* buffer is not owned by the package */
+}
+
+
+TEST(utest_pyclustering, package_list_to_dense) {
+    std::vector<std::vector<double>> container = { { 1.0, 2.0 }, { 3.0, 4.0 }, { 5.0, 6.0 } };
+    pyclustering_package * package = create_package(&container);
+
+    ccore::container::dense_dataset data;
+    package->extract(data);
+
+    std::vector<std::vector<double>> unpack_container;
+    data.extract(unpack_container);
+    ASSERT_EQ(container, unpack_container);
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_irregular_list_to_dense) {
+    std::vector<std::vector<double>> container = { { 1.0, 2.0 }, { 3.0 } };
+    pyclustering_package * package = create_package(&container);
+
+    ccore::container::dense_dataset data;
+    ASSERT_THROW(package->extract(data), std::invalid_argument);
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_matrix_to_distance_matrix_view) {
+    double buffer[] = { 0.0, 1.0, 2.0, -1.0, 1.0, 0.0, 3.0, -1.0, 2.0, 3.0, 0.0, -1.0 };
+
+    pyclustering_package package(PYCLUSTERING_TYPE_MATRIX);
+    package.size = 3;
+    package.columns = 3;
+    package.stride = 4;
+    package.element_type = PYCLUSTERING_TYPE_DOUBLE;
+    package.data = buffer;
+
+    ccore::container::pairwise_distance_matrix<double> matrix;
+    package.extract(matrix);
+
+    ASSERT_TRUE(matrix.is_view());
+    ASSERT_EQ(3U, matrix.size());
+    ASSERT_EQ(2.0, matrix(0, 2));
+    ASSERT_EQ(3.0, matrix(2, 1));
+
+    package.columns = 2;
+    ASSERT_THROW(package.extract(matrix), std::invalid_argument);
+
+    package.data = nullptr;     /* buffer is not owned by the package */
+}
+
+
+TEST(utest_pyclustering, package_list_to_distance_matrix) {
+    std::vector<std::vector<double>> container = { { 0.0, 1.0, 2.0 }, { 1.0, 0.0, 3.0 }, { 2.0, 3.0, 0.0 } };
+    pyclustering_package * package = create_package(&container);
+
+    ccore::container::pairwise_distance_matrix<double> matrix;
+    package->extract(matrix);
+
+    ASSERT_FALSE(matrix.is_view());
+    ASSERT_EQ(ccore::container::distance_matrix_layout::SQUARE, matrix.layout());
+    for (std::size_t i = 0; i < container.size(); i++) {
+        for (std::size_t j = 0; j < container.size(); j++) {
+            ASSERT_EQ(container[i][j], matrix(i, j));
+        }
+    }
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_condensed_distance_matrix) {
+    std::vector<double> container = { 1.0, 2.0, 3.0 };
+    pyclustering_package * package = create_package(&container);
+
+    ccore::container::pairwise_distance_matrix<double> matrix;
+    package->extract(matrix);
+
+    ASSERT_EQ(ccore::container::distance_matrix_layout::CONDENSED, matrix.layout());
+    ASSERT_EQ(3U, matrix.size());
+    ASSERT_EQ(1.0, matrix(1, 0));
+    ASSERT_EQ(2.0, matrix(0, 2));
+    ASSERT_EQ(3.0, matrix(2, 1));
+    ASSERT_EQ(0.0, matrix(1, 1));
+
+    delete package;
+
+    container = { 1.0, 2.0 };
+    package = create_package(&container);
+    ASSERT_THROW(package->extract(matrix), std::invalid_argument);
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_matrix_rectangular) {
+    std::vector<std::vector<double>> container = { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 } };
+    pyclustering_package * package = create_matrix_package(&container);
+
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_MATRIX, package->type);
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_DOUBLE, package->element_type);
+    ASSERT_EQ(2U, package->size);
+    ASSERT_EQ(3U, package->columns);
+    ASSERT_EQ(3U, package->stride);
+
+    for (std::size_t i = 0; i < container.size(); i++) {
+        for (std::size_t j = 0; j < container[i].size(); j++) {
+            ASSERT_EQ(container[i][j], package->at<double>(i, j));
+        }
+    }
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_matrix_irregular_is_list) {
+    std::vector<std::vector<std::size_t>> container = { { 1, 2 }, { 3 } };
+    pyclustering_package * package = create_matrix_package(&container);
+
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_LIST, package->type);
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_rectangular_clusters_are_list) {
+    std::vector<std::vector<std::size_t>> container = { { 0, 1 }, { 2, 3 } };
+    pyclustering_package * package = create_package(&container);
+
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_LIST, package->type);
+    ASSERT_EQ(2U, package->size);
+    ASSERT_EQ(3U, package->at<std::size_t>(1, 1));
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_matrix_create) {
+    pyclustering_package * package = create_matrix_package<int>(3, 2);
+
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_MATRIX, package->type);
+    ASSERT_EQ((unsigned int) PYCLUSTERING_TYPE_INT, package->element_type);
+    ASSERT_EQ(3U, package->size);
+    ASSERT_EQ(2U, package->columns);
+
+    package->at<int>(2, 1) = 10;
+    ASSERT_EQ(10, ((int *) package->data)[5]);
+    ASSERT_THROW(package->at<int>(2, 2), std::out_of_range);
+
+    delete package;
+}
+
+
+TEST(utest_pyclustering, package_unpack_matrix) {
+    std::vector<std::vector<double>> container = { { 1.2, 2.4 }, { 3.6, 4.8 }, { 5.0, 6.0 } };
+    pyclustering_package * package = create_matrix_package(&container);
+
+    std::vector<std::vector<double>> unpack_container;
+    package->extract(unpack_container);
+
+    ASSERT_EQ(container, unpack_container);
+
+    delete package;
+}
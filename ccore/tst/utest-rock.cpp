@@ -22,12 +22,14 @@
 #include "gtest/gtest.h"
 
 #include "cluster/rock.hpp"
+#include "parallel/execution_context.hpp"
 
 #include "samples.hpp"
 #include "utenv_check.hpp"
 
 
 using namespace ccore::clst;
+using namespace ccore::parallel;
 
 
 static void
@@ -110,3 +112,22 @@ TEST(utest_rock, allocation_sample_simple_08) {
     const std::vector<size_t> expected_clusters_length = { 15, 30, 20, 80 };
     template_length_process_data(simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_08), 1.0, 4, 0.5, expected_clusters_length);
 }
+
+
+TEST(utest_rock, cancelled_processing) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    cancellation_token token;
+    token.cancel();
+
+    execution_context context;
+    context.set_cancellation_token(token);
+    execution_context_scope scope(context);
+
+    rock solver(1.0, 2, 0.5);
+
+    rock_data output_result;
+    solver.process(*sample, output_result);
+
+    ASSERT_CLUSTER_SIZES(*sample, output_result.clusters(), std::vector<size_t>(sample->size(), 1));
+}
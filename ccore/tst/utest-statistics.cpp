@@ -0,0 +1,179 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "cluster/dbscan.hpp"
+#include "cluster/kmeans.hpp"
+
+#include "nnet/sync.hpp"
+
+#include "parallel/execution_context.hpp"
+#include "parallel/parallel.hpp"
+
+#include "utils/memory.hpp"
+#include "utils/statistics.hpp"
+
+#include "samples.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+
+using namespace ccore::clst;
+using namespace ccore::nnet;
+using namespace ccore::parallel;
+using namespace ccore::utils::statistics;
+
+
+TEST(utest_statistics, disabled_collector) {
+    performance_statistics statistics;
+    {
+        statistics_collector collector(statistics, false);
+        ASSERT_EQ(nullptr, statistics_collector::get_active());
+
+        statistics_collector::increment(counter_t::ITERATIONS, 10);
+    }
+
+    ASSERT_EQ(0U, statistics.get_counter(counter_t::ITERATIONS));
+    ASSERT_EQ(0.0, statistics.get_phase_time(phase_t::PROCESS));
+}
+
+
+TEST(utest_statistics, collect_parallel_counters) {
+    const execution_context context(4);
+    execution_context_scope scope(context);
+
+    performance_statistics statistics;
+    {
+        statistics_collector collector(statistics, true);
+        parallel_for(std::size_t(0), std::size_t(1000), [](const std::size_t) {
+            statistics_collector::increment(counter_t::DISTANCE_CALCULATIONS, 2);
+        }, schedule(schedule_policy::DYNAMIC, 10));
+
+        phase_timer timer(phase_t::UPDATE_CLUSTERS);
+    }
+
+    ASSERT_EQ(2000U, statistics.get_counter(counter_t::DISTANCE_CALCULATIONS));
+    ASSERT_LE(statistics.get_phase_time(phase_t::UPDATE_CLUSTERS), statistics.get_phase_time(phase_t::PROCESS));
+    ASSERT_EQ(2000U, performance_statistics::get_last().get_counter(counter_t::DISTANCE_CALCULATIONS));
+    ASSERT_EQ(nullptr, statistics_collector::get_active());
+}
+
+
+TEST(utest_statistics, nested_collectors) {
+    performance_statistics outer, inner;
+    {
+        statistics_collector outer_collector(outer, true);
+        statistics_collector::increment(counter_t::ITERATIONS);
+        {
+            statistics_collector inner_collector(inner, true);
+            statistics_collector::increment(counter_t::ITERATIONS, 5);
+        }
+
+        ASSERT_EQ(&outer_collector, statistics_collector::get_active());
+    }
+
+    ASSERT_EQ(5U, inner.get_counter(counter_t::ITERATIONS));
+    ASSERT_EQ(6U, outer.get_counter(counter_t::ITERATIONS));
+}
+
+
+TEST(utest_statistics, concurrent_collectors_memory) {
+    using namespace ccore::utils::memory;
+
+    const std::size_t initial = memory_usage::get_current();
+
+    performance_statistics first;
+    std::unique_ptr<statistics_collector> first_collector(new statistics_collector(first, true));
+    {
+        memory_reservation reservation(4096);
+    }
+
+    /* collector of another thread is started and completed while the first one is active */
+    std::atomic<bool> started(false), release(false);
+    std::thread second_thread([&started, &release]() {
+        performance_statistics second;
+        statistics_collector second_collector(second, true);
+
+        started = true;
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+
+    while (!started.load()) {
+        std::this_thread::yield();
+    }
+
+    first_collector.reset();
+    release = true;
+    second_thread.join();
+
+    ASSERT_GE(first.get_peak_memory(), initial + 4096);
+}
+
+
+TEST(utest_statistics, kmeans_statistics) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    kmeans_data result;
+    ASSERT_FALSE(result.is_statistics_enabled());
+
+    result.enable_statistics(true);
+    kmeans({ { 3.7, 5.5 }, { 6.7, 7.5 } }, 0.0001).process(*data, result);
+
+    const performance_statistics & statistics = result.statistics();
+    const std::uint64_t iterations = statistics.get_counter(counter_t::ITERATIONS);
+
+    ASSERT_GT(iterations, 0U);
+    ASSERT_GE(statistics.get_counter(counter_t::DISTANCE_CALCULATIONS), iterations * data->size() * 2);
+    ASSERT_GT(statistics.get_phase_time(phase_t::PROCESS), 0.0);
+
+    /* the next run starts collection from scratch */
+    kmeans({ { 3.7, 5.5 }, { 6.7, 7.5 } }, 0.0001).process(*data, result);
+    ASSERT_EQ(iterations, result.statistics().get_counter(counter_t::ITERATIONS));
+}
+
+
+TEST(utest_statistics, dbscan_statistics) {
+    dataset_ptr data = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+
+    dbscan_data result;
+    result.enable_statistics(true);
+    dbscan(0.5, 2).process(*data, result);
+
+    ASSERT_EQ(data->size(), result.statistics().get_counter(counter_t::NEIGHBOR_QUERIES));
+    ASSERT_GE(result.statistics().get_counter(counter_t::KDTREE_NODES_VISITED), data->size());
+}
+
+
+TEST(utest_statistics, sync_statistics) {
+    sync_network network(10, 1.0, 0.0, connection_t::CONNECTION_ALL_TO_ALL, initial_type::EQUIPARTITION);
+
+    sync_dynamic dynamic;
+    dynamic.enable_statistics(true);
+    network.simulate_static(20, 2.0, solve_type::FORWARD_EULER, false, dynamic);
+
+    ASSERT_EQ(20U, dynamic.statistics().get_counter(counter_t::SIMULATION_STEPS));
+    ASSERT_GT(dynamic.statistics().get_phase_time(phase_t::SIMULATION), 0.0);
+}
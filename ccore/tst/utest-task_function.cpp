@@ -0,0 +1,111 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "parallel/task_function.hpp"
+
+#include <array>
+#include <functional>
+#include <memory>
+
+
+using namespace ccore::parallel;
+
+
+TEST(utest_task_function, empty) {
+    task_function function;
+    ASSERT_FALSE(static_cast<bool>(function));
+    ASSERT_THROW(function(), std::bad_function_call);
+
+    task_function null_function = nullptr;
+    ASSERT_FALSE(static_cast<bool>(null_function));
+}
+
+
+TEST(utest_task_function, small_callable) {
+    int counter = 0;
+    task_function function = [&counter]() { counter++; };
+
+    ASSERT_TRUE(static_cast<bool>(function));
+    function();
+    function();
+    ASSERT_EQ(2, counter);
+
+    task_function copy = function;
+    copy();
+    ASSERT_EQ(3, counter);
+
+    task_function moved = std::move(function);
+    ASSERT_FALSE(static_cast<bool>(function));
+    moved();
+    ASSERT_EQ(4, counter);
+}
+
+
+TEST(utest_task_function, large_callable) {
+    std::array<double, 32> values;
+    values.fill(1.0);
+
+    double result = 0.0;
+    task_function function = [values, &result]() {
+        for (const double value : values) {
+            result += value;
+        }
+    };
+
+    task_function copy = function;
+    task_function moved = std::move(function);
+
+    copy();
+    moved();
+    ASSERT_EQ(64.0, result);
+}
+
+
+TEST(utest_task_function, move_only_callable) {
+    std::unique_ptr<int> value(new int(10));
+
+    int result = 0;
+    task_function function = std::bind([&result](const std::unique_ptr<int> & p_value) { result = *p_value; }, std::move(value));
+
+    task_function moved = std::move(function);
+    moved();
+    ASSERT_EQ(10, result);
+
+    ASSERT_THROW(task_function copy = moved, std::bad_function_call);
+}
+
+
+TEST(utest_task_function, destroy_callable) {
+    std::shared_ptr<int> value = std::make_shared<int>(1);
+
+    {
+        task_function function = [value]() { };
+        task_function copy = function;
+        ASSERT_EQ(3, value.use_count());
+
+        function = nullptr;
+        ASSERT_EQ(2, value.use_count());
+    }
+
+    ASSERT_EQ(1, value.use_count());
+}
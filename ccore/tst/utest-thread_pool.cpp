@@ -24,9 +24,12 @@
 #include "parallel/thread_pool.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <limits>
 #include <numeric>
 #include <map>
+#include <thread>
 #include <vector>
 
 
@@ -207,4 +210,70 @@ TEST(utest_thread_pool, pool_auto_size_50_tasks) {
 
 TEST(utest_thread_pool, pool_auto_size_100_tasks) {
     template_add_task_test(AUTO_POOL_SIZE, 20);
-}
\ No newline at end of file
+}
+
+
+TEST(utest_thread_pool, wait_blocked_task) {
+    thread_pool pool(2);
+
+    std::atomic<bool> release(false);
+    task::ptr client_task = pool.add_task([&release]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        release = true;
+    });
+
+    ASSERT_FALSE(client_task->is_ready());
+
+    client_task->wait_ready();
+    ASSERT_TRUE(client_task->is_ready());
+    ASSERT_TRUE(release.load());
+
+    client_task->wait_ready();
+}
+
+
+TEST(utest_thread_pool, add_task_if_free) {
+    thread_pool pool(1);
+
+    std::atomic<bool> release(false);
+    task::ptr blocking_task = nullptr;
+    while (!blocking_task) {
+        blocking_task = pool.add_task_if_free([&release]() {
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    ASSERT_EQ(nullptr, pool.add_task_if_free([]() { }));
+
+    release = true;
+    blocking_task->wait_ready();
+}
+
+
+TEST(utest_thread_pool, add_tasks_to_full_queue) {
+    thread_pool pool(1);
+
+    std::atomic<bool> release(false);
+    task::ptr blocking_task = pool.add_task([&release]() {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+
+    /* the only thread is blocked, therefore the queue is overflowed */
+    std::atomic<std::size_t> amount_executed(0);
+    std::vector<task::ptr> tasks;
+    for (std::size_t i = 0; i < 2 * thread_pool::QUEUE_CAPACITY; i++) {
+        tasks.push_back(pool.add_task([&amount_executed]() { amount_executed.fetch_add(1); }));
+    }
+
+    release = true;
+    for (auto & client_task : tasks) {
+        client_task->wait_ready();
+    }
+
+    blocking_task->wait_ready();
+    ASSERT_EQ(2 * thread_pool::QUEUE_CAPACITY, amount_executed.load());
+}
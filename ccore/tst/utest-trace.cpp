@@ -0,0 +1,118 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "interface/trace_interface.h"
+
+#include "nnet/sync.hpp"
+
+#include "parallel/execution_context.hpp"
+#include "parallel/parallel.hpp"
+
+#include "utils/trace.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+
+using namespace ccore::nnet;
+using namespace ccore::parallel;
+using namespace ccore::utils::trace;
+
+
+static std::size_t count_substring(const std::string & p_text, const std::string & p_pattern) {
+    std::size_t amount = 0;
+    for (std::size_t position = p_text.find(p_pattern); position != std::string::npos; position = p_text.find(p_pattern, position + 1)) {
+        amount++;
+    }
+
+    return amount;
+}
+
+
+TEST(utest_trace, disabled_by_default) {
+    ASSERT_FALSE(tracer::is_enabled());
+    ASSERT_FALSE(tracer::stop());
+}
+
+
+TEST(utest_trace, parallel_chunks) {
+    const std::string path = "utest_trace_parallel.json";
+
+    const execution_context context(4);
+    execution_context_scope scope(context);
+
+    tracer::start(path);
+    ASSERT_TRUE(tracer::is_enabled());
+
+    parallel_for(std::size_t(0), std::size_t(100), [](const std::size_t) { }, schedule(schedule_policy::DYNAMIC, 10));
+    {
+        trace_scope trace("test scope", "test");
+    }
+
+    ASSERT_TRUE(tracer::stop());
+    ASSERT_FALSE(tracer::is_enabled());
+
+    std::ifstream stream(path);
+    std::stringstream content;
+    content << stream.rdbuf();
+    stream.close();
+    std::remove(path.c_str());
+
+    const std::string trace = content.str();
+    ASSERT_EQ(0U, trace.find("{\"displayTimeUnit\": \"ms\", \"traceEvents\": ["));
+    ASSERT_EQ(10U, count_substring(trace, "\"name\": \"parallel_for chunk\", \"cat\": \"parallel\", \"ph\": \"B\""));
+    ASSERT_EQ(10U, count_substring(trace, "\"name\": \"parallel_for chunk\", \"cat\": \"parallel\", \"ph\": \"E\""));
+    ASSERT_EQ(1U, count_substring(trace, "\"name\": \"test scope\", \"cat\": \"test\", \"ph\": \"B\""));
+}
+
+
+TEST(utest_trace, simulation_phases) {
+    const std::string path = "utest_trace_sync.json";
+
+    trace_start(path.c_str());
+
+    sync_network network(5, 1.0, 0.0, connection_t::CONNECTION_ALL_TO_ALL, initial_type::EQUIPARTITION);
+    sync_dynamic dynamic;
+    network.simulate_static(4, 1.0, solve_type::RUNGE_KUTTA_4, false, dynamic);
+
+    ASSERT_TRUE(trace_stop());
+
+    std::ifstream stream(path);
+    std::stringstream content;
+    content << stream.rdbuf();
+    stream.close();
+    std::remove(path.c_str());
+
+    const std::string trace = content.str();
+    ASSERT_EQ(4U, count_substring(trace, "\"name\": \"simulation\", \"cat\": \"phase\", \"ph\": \"B\""));
+    ASSERT_EQ(20U, count_substring(trace, "\"name\": \"runge_kutta_4\", \"cat\": \"ode\", \"ph\": \"E\""));
+
+    /* events are not recorded after stop */
+    network.simulate_static(4, 1.0, solve_type::RUNGE_KUTTA_4, false, dynamic);
+
+    std::stringstream empty;
+    tracer::write(empty);
+    ASSERT_EQ(20U, count_substring(empty.str(), "\"name\": \"runge_kutta_4\", \"cat\": \"ode\", \"ph\": \"E\""));
+}
@@ -21,9 +21,13 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <limits>
+
 #include "definitions.hpp"
 
 #include "utils/metric.hpp"
+#include "utils/metric_batch.hpp"
 
 #include "utenv_check.hpp"
 
@@ -67,4 +71,282 @@ TEST(utest_metric, calculate_distance_matrix_01) {
     dataset distance_matrix_expected = { { 0.0, 2.0, 4.0 }, { 2.0, 0.0, 2.0 }, { 4.0, 2.0, 0.0 } };
 
     ASSERT_EQ(distance_matrix, distance_matrix_expected);
-}
\ No newline at end of file
+}
+
+
+TEST(utest_metric, simd_kernels) {
+    const simd::simd_level supported_level = simd::get_supported_level();
+    ASSERT_EQ(supported_level, simd::get_level());
+
+    std::vector<double> point1, point2;
+    for (std::size_t i = 0; i < 37; i++) {
+        point1.push_back(std::sin((double) i) * 10.0);
+        point2.push_back(std::cos((double) i * 0.7) * 5.0);
+    }
+
+    for (int level = (int) simd::simd_level::SCALAR; level <= (int) supported_level; level++) {
+        ASSERT_EQ((simd::simd_level) level, simd::set_level((simd::simd_level) level));
+
+        for (std::size_t dimension = 0; dimension <= point1.size(); dimension++) {
+            const std::vector<double> subpoint1(point1.begin(), point1.begin() + dimension);
+            const std::vector<double> subpoint2(point2.begin(), point2.begin() + dimension);
+
+            double expected_euclidean = 0.0, expected_manhattan = 0.0, expected_chebyshev = 0.0;
+            for (std::size_t i = 0; i < dimension; i++) {
+                const double difference = subpoint1[i] - subpoint2[i];
+                expected_euclidean += difference * difference;
+                expected_manhattan += std::abs(difference);
+                expected_chebyshev = std::max(expected_chebyshev, std::abs(difference));
+            }
+
+            ASSERT_NEAR(expected_euclidean, euclidean_distance_square(subpoint1, subpoint2), 1e-9);
+            ASSERT_NEAR(expected_manhattan, manhattan_distance(subpoint1, subpoint2), 1e-9);
+            ASSERT_EQ(expected_chebyshev, chebyshev_distance(subpoint1, subpoint2));
+        }
+    }
+
+    ASSERT_EQ(supported_level, simd::set_level(simd::simd_level::AVX512));
+}
+
+
+TEST(utest_metric, visit_metric_policy) {
+    const point point1 = { 1.0, -2.0, 3.5 };
+    const point point2 = { -1.5, 4.0, 0.5 };
+
+    const std::vector<std::pair<distance_metric<point>, metric_type>> metrics = {
+        { distance_metric_factory<point>::euclidean(), metric_type::EUCLIDEAN },
+        { distance_metric_factory<point>::euclidean_square(), metric_type::EUCLIDEAN_SQUARE },
+        { distance_metric_factory<point>::manhattan(), metric_type::MANHATTAN },
+        { distance_metric_factory<point>::chebyshev(), metric_type::CHEBYSHEV },
+        { distance_metric_factory<point>::minkowski(4.0), metric_type::MINKOWSKI },
+        { distance_metric_factory<point>::minkowski(2.5), metric_type::MINKOWSKI },
+        { distance_metric_factory<point>::cosine(), metric_type::COSINE },
+        { distance_metric_factory<point>::canberra(), metric_type::CANBERRA },
+        { distance_metric_factory<point>::weighted_euclidean({ 1.0, 0.5, 2.0 }), metric_type::WEIGHTED_EUCLIDEAN },
+        { distance_metric_factory<point>::gower({ 2.5, 6.0, 3.0 }), metric_type::GOWER },
+        { distance_metric_factory<point>::mahalanobis({ { 2.0, 0.5, 0.0 }, { 0.5, 1.0, 0.2 }, { 0.0, 0.2, 3.0 } }), metric_type::MAHALANOBIS },
+        { distance_metric_factory<point>::user_defined([](const point &, const point &) { return -5.0; }), metric_type::USER_DEFINED }
+    };
+
+    for (const auto & metric : metrics) {
+        ASSERT_EQ(metric.second, metric.first.get_type());
+
+        double distance = 0.0;
+        visit_metric(metric.first, [&point1, &point2, &distance](const auto & p_policy) {
+            distance = p_policy(point1, point2);
+        });
+
+        ASSERT_EQ(metric.first(point1, point2), distance);
+    }
+}
+
+
+TEST(utest_metric, minkowski_integer_degree) {
+    const point point1 = { 1.0, -2.0, 3.5, 0.25 };
+    const point point2 = { -1.5, 4.0, 0.5, 0.75 };
+
+    for (const double degree : { 1.0, 2.0, 3.0, 4.0, 7.0, 2.5, 40.0 }) {
+        double expected = 0.0;
+        for (std::size_t i = 0; i < point1.size(); i++) {
+            expected += std::pow(std::abs(point1[i] - point2[i]), degree);
+        }
+        expected = std::pow(expected, 1.0 / degree);
+
+        ASSERT_NEAR(expected, minkowski_distance(point1, point2, degree), 1e-9);
+        ASSERT_NEAR(expected, minkowski_distance(point2, point1, degree), 1e-9);
+    }
+}
+
+
+TEST(utest_metric, native_metrics) {
+    distance_metric<point> metric = distance_metric_factory<point>::cosine();
+    ASSERT_NEAR(0.0, metric({ 1.0, 1.0 }, { 2.0, 2.0 }), 1e-12);
+    ASSERT_NEAR(1.0, metric({ 1.0, 0.0 }, { 0.0, 3.0 }), 1e-12);
+    ASSERT_NEAR(2.0, metric({ 1.0, 0.0 }, { -1.0, 0.0 }), 1e-12);
+    ASSERT_EQ(1.0, metric({ 0.0, 0.0 }, { 1.0, 0.0 }));
+    ASSERT_EQ(0.0, metric({ 0.0, 0.0 }, { 0.0, 0.0 }));
+
+    metric = distance_metric_factory<point>::canberra();
+    ASSERT_DOUBLE_EQ(1.0 / 3.0 + 1.0, metric({ 1.0, 0.0, 0.0 }, { 2.0, 5.0, 0.0 }));
+
+    metric = distance_metric_factory<point>::weighted_euclidean({ 4.0, 0.0 });
+    ASSERT_DOUBLE_EQ(2.0, metric({ 0.0, 0.0 }, { 1.0, 10.0 }));
+
+    metric = distance_metric_factory<point>::gower({ 2.0, 0.0, 4.0 });
+    ASSERT_DOUBLE_EQ((0.5 + 0.0 + 1.0) / 3.0, metric({ 0.0, 5.0, 1.0 }, { 1.0, 3.0, 5.0 }));
+
+    metric = distance_metric_factory<point>::mahalanobis({ { 4.0, 0.0 }, { 0.0, 1.0 } });
+    ASSERT_DOUBLE_EQ(std::sqrt(4.0 * 9.0 + 16.0), metric({ 0.0, 0.0 }, { 3.0, 4.0 }));
+
+    const std::vector<std::vector<double>> inverse_covariance = { { 2.0, 0.5 }, { 0.5, 1.0 } };
+    metric = distance_metric_factory<point>::mahalanobis(inverse_covariance);
+
+    const point point1 = { 1.0, 2.5 }, point2 = { -1.2, 3.4 };
+    const double difference[2] = { point1[0] - point2[0], point1[1] - point2[1] };
+
+    double expected = 0.0;
+    for (std::size_t i = 0; i < 2; i++) {
+        for (std::size_t j = 0; j < 2; j++) {
+            expected += difference[i] * inverse_covariance[i][j] * difference[j];
+        }
+    }
+
+    ASSERT_NEAR(std::sqrt(expected), metric(point1, point2), 1e-12);
+
+    const distance_metric<point> copy = metric;
+    ASSERT_EQ(&metric.get_arguments(), &copy.get_arguments());
+    ASSERT_EQ(metric(point1, point2), copy(point1, point2));
+}
+
+
+TEST(utest_metric, mahalanobis_incorrect_matrix) {
+    ASSERT_THROW(distance_metric_factory<point>::mahalanobis({ { 1.0, 2.0 }, { 2.0, 1.0 } }), std::invalid_argument);
+    ASSERT_THROW(distance_metric_factory<point>::mahalanobis({ { 1.0, 0.5 }, { 0.0, 1.0 } }), std::invalid_argument);
+    ASSERT_THROW(distance_metric_factory<point>::mahalanobis({ { 1.0, 0.0 }, { 0.0 } }), std::invalid_argument);
+    ASSERT_THROW(distance_metric_factory<point>::mahalanobis({ }), std::invalid_argument);
+}
+
+
+TEST(utest_metric, arguments_dimension_mismatch) {
+    const point point1 = { 1.0, 2.0, 3.0 }, point2 = { 2.0, 0.0, 1.0 };
+    const point short_point = { 1.0, 2.0 };
+
+    const std::vector<distance_metric<point>> metrics = {
+        distance_metric_factory<point>::weighted_euclidean({ 1.0, 0.5, 2.0 }),
+        distance_metric_factory<point>::gower({ 2.5, 6.0, 3.0 }),
+        distance_metric_factory<point>::mahalanobis({ { 2.0, 0.5, 0.0 }, { 0.5, 1.0, 0.2 }, { 0.0, 0.2, 3.0 } })
+    };
+
+    const ccore::container::dense_dataset data({ point1, point2 });
+
+    for (const auto & metric : metrics) {
+        ASSERT_EQ(3U, metric.get_dimension());
+        ASSERT_NO_THROW(metric(point1, point2));
+
+        ASSERT_THROW(metric(point1, short_point), std::invalid_argument);
+        ASSERT_THROW(metric(short_point, point2), std::invalid_argument);
+        ASSERT_THROW(metric(data.row(0), short_point), std::invalid_argument);
+
+        visit_metric(metric, [&short_point, &data](const auto & p_metric) {
+            ASSERT_THROW(p_metric(short_point, data.row(1)), std::invalid_argument);
+        });
+    }
+
+    ASSERT_EQ(0U, distance_metric_factory<point>::euclidean().get_dimension());
+    ASSERT_EQ(0U, distance_metric_factory<point>::minkowski(3.0).get_dimension());
+}
+
+
+TEST(utest_metric, arguments_empty) {
+    ASSERT_THROW(distance_metric_factory<point>::weighted_euclidean({ }), std::invalid_argument);
+    ASSERT_THROW(distance_metric_factory<point>::gower({ }), std::invalid_argument);
+}
+
+
+static void
+template_find_nearest_centers(const std::size_t p_amount_points, const std::size_t p_amount_centers, const std::size_t p_dimension) {
+    ccore::container::dense_dataset data(p_amount_points, p_dimension);
+    dataset centers(p_amount_centers, point(p_dimension, 0.0));
+
+    for (std::size_t i = 0; i < p_amount_points; i++) {
+        for (std::size_t j = 0; j < p_dimension; j++) {
+            data.at(i, j) = std::sin((double) (i * p_dimension + j)) * 10.0;
+        }
+    }
+
+    for (std::size_t i = 0; i < p_amount_centers; i++) {
+        for (std::size_t j = 0; j < p_dimension; j++) {
+            centers[i][j] = std::cos((double) (i * p_dimension + j) * 0.3) * 10.0;
+        }
+    }
+
+    std::vector<std::size_t> expected(p_amount_points, 0);
+    for (std::size_t i = 0; i < p_amount_points; i++) {
+        double distance_optimum = std::numeric_limits<double>::max();
+        for (std::size_t j = 0; j < p_amount_centers; j++) {
+            const double distance = euclidean_distance_square(data.row(i), centers[j]);
+            if (distance < distance_optimum) {
+                distance_optimum = distance;
+                expected[i] = j;
+            }
+        }
+    }
+
+    std::vector<std::size_t> indexes;
+    for (std::size_t i = 0; i < p_amount_points; i += 3) {
+        indexes.push_back(i);
+    }
+
+    const simd::simd_level supported_level = simd::get_supported_level();
+    for (int level = (int) simd::simd_level::SCALAR; level <= (int) supported_level; level++) {
+        simd::set_level((simd::simd_level) level);
+
+        std::vector<std::size_t> labels;
+        find_nearest_centers(data, centers, labels);
+        ASSERT_EQ(expected, labels);
+
+        std::vector<std::size_t> subset_labels(p_amount_points, p_amount_centers);
+        find_nearest_centers(data, indexes, centers, subset_labels);
+
+        for (std::size_t i = 0; i < p_amount_points; i++) {
+            ASSERT_EQ((i % 3 == 0) ? expected[i] : p_amount_centers, subset_labels[i]);
+        }
+    }
+
+    simd::set_level(supported_level);
+}
+
+
+TEST(utest_metric, find_nearest_centers_one_center) {
+    template_find_nearest_centers(100, 1, 2);
+}
+
+
+TEST(utest_metric, find_nearest_centers_several_tiles) {
+    template_find_nearest_centers(1000, 10, 2);
+}
+
+
+TEST(utest_metric, find_nearest_centers_several_blocks) {
+    template_find_nearest_centers(300, 700, 31);
+}
+
+
+TEST(utest_metric, find_nearest_centers_ties) {
+    const ccore::container::dense_dataset data({ { 0.0, 0.0 }, { 1.0e8, 1.0e8 }, { 1.0e8 + 1.0, 1.0e8 } });
+    const dataset centers = { { 1.0, 0.0 }, { -1.0, 0.0 }, { 1.0e8 + 1.0, 1.0e8 + 1.0 }, { 1.0e8, 1.0e8 + 1.0 } };
+
+    std::vector<std::size_t> labels;
+    find_nearest_centers(data, centers, labels);
+
+    const std::vector<std::size_t> expected = { 0, 3, 2 };
+    ASSERT_EQ(expected, labels);
+}
+
+
+TEST(utest_metric, find_nearest_centers_wrong_dimension) {
+    const ccore::container::dense_dataset data({ { 0.0, 0.0 }, { 1.0, 1.0 } });
+    const dataset centers = { { 1.0, 0.0 }, { 1.0 } };
+
+    std::vector<std::size_t> labels;
+    ASSERT_THROW(find_nearest_centers(data, centers, labels), std::invalid_argument);
+}
+
+
+TEST(utest_metric, batch_assignment_supported) {
+    ASSERT_TRUE(is_batch_assignment_supported(distance_metric_factory<point>::euclidean()));
+    ASSERT_TRUE(is_batch_assignment_supported(distance_metric_factory<point>::euclidean_square()));
+    ASSERT_FALSE(is_batch_assignment_supported(distance_metric_factory<point>::manhattan()));
+    ASSERT_FALSE(is_batch_assignment_supported(distance_metric_factory<point>::minkowski(2.0)));
+}
+
+
+TEST(utest_metric, average_neighbor_distance) {
+    const dataset points = { { 0.0, 0.0 }, { 1.0, 0.0 }, { 3.0, 0.0 }, { 3.0, 4.0 } };
+
+    /* nearest neighbors: 1, 1, 2, 4; second neighbors: 3, 2, 3, 4.47... */
+    ASSERT_DOUBLE_EQ(2.0, average_neighbor_distance(&points, 1));
+    ASSERT_DOUBLE_EQ((1.0 + 1.0 + 2.0 + 4.0 + 3.0 + 2.0 + 3.0 + std::sqrt(20.0)) / 8.0, average_neighbor_distance(&points, 2));
+
+    ASSERT_THROW(average_neighbor_distance(&points, 4), std::invalid_argument);
+}
@@ -0,0 +1,210 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "samples.hpp"
+
+#include "container/vptree.hpp"
+
+#include "utils/metric.hpp"
+#include "utils/statistics.hpp"
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+
+using namespace ccore::container;
+using namespace ccore::utils::metric;
+using namespace ccore::utils::statistics;
+
+
+static void template_radius_search(const dataset & p_data, const double p_radius, const distance_metric<point> & p_metric, const std::size_t p_leaf_size) {
+    const dense_dataset data(p_data);
+    const vptree tree(data, p_metric, p_leaf_size);
+    ASSERT_EQ(p_data.size(), tree.size());
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        std::vector<std::size_t> expected;
+        for (std::size_t index_neighbor = 0; index_neighbor < p_data.size(); index_neighbor++) {
+            if (p_metric(p_data[index], p_data[index_neighbor]) <= p_radius) {
+                expected.push_back(index_neighbor);
+            }
+        }
+
+        std::vector<std::size_t> actual;
+        std::vector<double> distances;
+        tree.find_nearest(data.row(index), p_radius, actual, distances);
+
+        ASSERT_EQ(actual.size(), distances.size());
+        for (std::size_t position = 0; position < actual.size(); position++) {
+            ASSERT_DOUBLE_EQ(p_metric(p_data[index], p_data[actual[position]]), distances[position]);
+        }
+
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+
+static void template_k_nearest_search(const dataset & p_data, const std::size_t p_amount, const distance_metric<point> & p_metric, const std::size_t p_leaf_size) {
+    const vptree tree(dense_dataset(p_data), p_metric, p_leaf_size);
+
+    for (std::size_t index = 0; index < p_data.size(); index++) {
+        std::vector<double> expected;
+        for (const auto & other : p_data) {
+            expected.push_back(p_metric(p_data[index], other));
+        }
+
+        std::sort(expected.begin(), expected.end());
+        expected.resize(std::min(p_amount, expected.size()));
+
+        std::vector<std::size_t> indexes;
+        std::vector<double> distances;
+        tree.find_k_nearest(p_data[index], p_amount, indexes, distances);
+
+        ASSERT_EQ(expected.size(), indexes.size());
+        for (std::size_t position = 0; position < indexes.size(); position++) {
+            ASSERT_DOUBLE_EQ(expected[position], distances[position]);
+            ASSERT_DOUBLE_EQ(distances[position], p_metric(p_data[index], p_data[indexes[position]]));
+        }
+    }
+}
+
+
+TEST(utest_vptree, radius_search_euclidean_simple_01) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    template_radius_search(*sample, 0.5, distance_metric_factory<point>::euclidean(), 1);
+}
+
+
+TEST(utest_vptree, radius_search_manhattan_simple_03) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    template_radius_search(*sample, 0.9, distance_metric_factory<point>::manhattan(), 2);
+}
+
+
+TEST(utest_vptree, radius_search_chebyshev_lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    template_radius_search(*sample, 0.3, distance_metric_factory<point>::chebyshev(), vptree::DEFAULT_LEAF_SIZE);
+}
+
+
+TEST(utest_vptree, radius_search_minkowski_hepta) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::HEPTA);
+    template_radius_search(*sample, 1.0, distance_metric_factory<point>::minkowski(3.0), 4);
+}
+
+
+TEST(utest_vptree, radius_search_user_defined_simple_02) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_02);
+    auto metric = distance_metric_factory<point>::user_defined([](const point & p1, const point & p2) {
+        return manhattan_distance(p1, p2) / 2.0;
+    });
+
+    template_radius_search(*sample, 0.5, metric, 3);
+}
+
+
+TEST(utest_vptree, radius_search_identical_points) {
+    template_radius_search(dataset(50, { 1.0, 2.0 }), 0.0, distance_metric_factory<point>::manhattan(), 4);
+    template_radius_search(*simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_09), 1.0, distance_metric_factory<point>::chebyshev(), 1);
+}
+
+
+TEST(utest_vptree, k_nearest_manhattan_lsun) {
+    auto sample = fcps_sample_factory::create_sample(FCPS_SAMPLE::LSUN);
+    template_k_nearest_search(*sample, 5, distance_metric_factory<point>::manhattan(), 8);
+}
+
+
+TEST(utest_vptree, k_nearest_chebyshev_simple_03) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_03);
+    template_k_nearest_search(*sample, 1, distance_metric_factory<point>::chebyshev(), 1);
+    template_k_nearest_search(*sample, 12, distance_metric_factory<point>::chebyshev(), 2);
+}
+
+
+TEST(utest_vptree, k_nearest_more_than_size) {
+    auto sample = simple_sample_factory::create_sample(SAMPLE_SIMPLE::SAMPLE_SIMPLE_01);
+    template_k_nearest_search(*sample, sample->size() + 5, distance_metric_factory<point>::euclidean(), 2);
+}
+
+
+TEST(utest_vptree, empty_tree) {
+    const dense_dataset data { dataset() };
+    const vptree tree(data, distance_metric_factory<point>::manhattan());
+    ASSERT_TRUE(tree.empty());
+    ASSERT_EQ(0U, tree.get_depth());
+
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    tree.find_nearest(point({ 0.0, 0.0 }), 1.0, indexes, distances);
+    ASSERT_TRUE(indexes.empty());
+
+    tree.find_k_nearest(point({ 0.0, 0.0 }), 3, indexes, distances);
+    ASSERT_TRUE(indexes.empty());
+}
+
+
+TEST(utest_vptree, wrong_metric) {
+    const dense_dataset data { dataset({ { 1.0 }, { 2.0 } }) };
+    ASSERT_THROW(vptree(data, distance_metric_factory<point>::euclidean_square()), std::invalid_argument);
+    ASSERT_THROW(vptree(data, distance_metric_factory<point>::cosine()), std::invalid_argument);
+    ASSERT_THROW(vptree(data, distance_metric_factory<point>::minkowski(0.5)), std::invalid_argument);
+    ASSERT_THROW(vptree(data, distance_metric<point>()), std::invalid_argument);
+}
+
+
+TEST(utest_vptree, radius_search_pruning) {
+    const std::size_t size = 4000;
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(0.0, 100.0);
+
+    dataset points(size, point(3));
+    for (auto & current : points) {
+        for (auto & coordinate : current) {
+            coordinate = distribution(generator);
+        }
+    }
+
+    const auto metric = distance_metric_factory<point>::manhattan();
+    const vptree tree(dense_dataset(points), metric);
+    ASSERT_LE(tree.get_depth(), 12U);
+
+    performance_statistics statistics;
+    std::vector<std::size_t> indexes;
+    std::vector<double> distances;
+    {
+        statistics_collector collector(statistics, true);
+        tree.find_nearest(points[0], 5.0, indexes, distances);
+    }
+
+    for (std::size_t index = 0; index < size; index++) {
+        const bool expected = metric(points[0], points[index]) <= 5.0;
+        ASSERT_EQ(expected, std::find(indexes.begin(), indexes.end(), index) != indexes.end());
+    }
+
+    ASSERT_GT(statistics.get_counter(counter_t::DISTANCE_CALCULATIONS), 0U);
+    ASSERT_LT(statistics.get_counter(counter_t::DISTANCE_CALCULATIONS), size / 2);
+}
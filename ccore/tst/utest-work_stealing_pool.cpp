@@ -0,0 +1,139 @@
+/**
+*
+* Copyright (C) 2014-2018    Andrei Novikov (pyclustering@yandex.ru)
+*
+* GNU_PUBLIC_LICENSE
+*   pyclustering is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   pyclustering is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*
+*/
+
+
+#include "gtest/gtest.h"
+
+#include "parallel/work_stealing_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using namespace ccore::parallel;
+
+
+static void template_execute_tasks(const std::size_t p_pool_size, const std::size_t p_amount_tasks) {
+    work_stealing_pool pool(p_pool_size);
+    ASSERT_EQ(p_pool_size, pool.size());
+
+    std::vector<std::size_t> results(p_amount_tasks, 0);
+
+    work_stealing_pool::task_group group;
+    for (std::size_t i = 0; i < p_amount_tasks; i++) {
+        pool.submit(group, [i, &results]() { results[i] = i * i; });
+    }
+
+    pool.wait(group);
+
+    for (std::size_t i = 0; i < p_amount_tasks; i++) {
+        ASSERT_EQ(i * i, results[i]);
+    }
+}
+
+
+TEST(utest_work_stealing_pool, empty_pool) {
+    template_execute_tasks(0, 10);
+}
+
+
+TEST(utest_work_stealing_pool, one_worker) {
+    template_execute_tasks(1, 100);
+}
+
+
+TEST(utest_work_stealing_pool, several_workers) {
+    template_execute_tasks(4, 1000);
+}
+
+
+TEST(utest_work_stealing_pool, wait_empty_group) {
+    work_stealing_pool pool(2);
+    work_stealing_pool::task_group group;
+    pool.wait(group);
+}
+
+
+TEST(utest_work_stealing_pool, nested_tasks) {
+    work_stealing_pool pool(3);
+
+    const std::size_t amount_outer = 20, amount_inner = 50;
+    std::atomic<std::size_t> counter(0);
+
+    work_stealing_pool::task_group outer_group;
+    for (std::size_t i = 0; i < amount_outer; i++) {
+        pool.submit(outer_group, [&pool, &counter, amount_inner]() {
+            work_stealing_pool::task_group inner_group;
+            for (std::size_t j = 0; j < amount_inner; j++) {
+                pool.submit(inner_group, [&counter]() { counter++; });
+            }
+
+            pool.wait(inner_group);
+        });
+    }
+
+    pool.wait(outer_group);
+    ASSERT_EQ(amount_outer * amount_inner, counter.load());
+}
+
+
+TEST(utest_work_stealing_pool, wait_long_tasks) {
+    work_stealing_pool pool(2);
+
+    for (std::size_t attempt = 0; attempt < 10; attempt++) {
+        std::atomic<std::size_t> counter(0);
+
+        /* caller runs out of pending tasks before workers complete theirs, therefore it sleeps on the group */
+        work_stealing_pool::task_group group;
+        for (std::size_t i = 0; i < 3; i++) {
+            pool.submit(group, [&counter]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                counter++;
+            });
+        }
+
+        pool.wait(group);
+        ASSERT_EQ(3U, counter.load());
+    }
+}
+
+
+TEST(utest_work_stealing_pool, exception_propagation) {
+    work_stealing_pool pool(2);
+    std::atomic<std::size_t> counter(0);
+
+    work_stealing_pool::task_group group;
+    for (std::size_t i = 0; i < 10; i++) {
+        pool.submit(group, [i, &counter]() {
+            counter++;
+            if (i == 5) {
+                throw std::runtime_error("task failure");
+            }
+        });
+    }
+
+    ASSERT_THROW(pool.wait(group), std::runtime_error);
+    ASSERT_EQ(10U, counter.load());
+
+    pool.wait(group);
+}
@@ -0,0 +1,190 @@
+"""!
+
+@brief CCORE Wrapper for execution context that defines amount of threads and their affinity.
+
+@authors Andrei Novikov (pyclustering@yandex.ru)
+@date 2014-2018
+@copyright GNU Public License
+
+@cond GNU_PUBLIC_LICENSE
+    PyClustering is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PyClustering is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+@endcond
+
+"""
+
+
+from pyclustering.core.wrapper import ccore_library
+
+from pyclustering.core.pyclustering_package import package_builder
+
+from ctypes import c_bool, c_double, c_size_t, c_void_p, POINTER
+
+
+def set_thread_count(thread_count):
+    """!
+    @brief Sets amount of threads that are used by algorithms of the core by default.
+
+    @param[in] thread_count (uint): Amount of threads including caller, 0 means amount of hardware threads.
+
+    """
+    ccore = ccore_library.get()
+    ccore.ccore_set_thread_count(c_size_t(thread_count))
+
+
+def get_thread_count():
+    """!
+    @brief Returns amount of threads that are used by algorithms of the core by default.
+
+    """
+    ccore = ccore_library.get()
+    ccore.ccore_get_thread_count.restype = c_size_t
+    return ccore.ccore_get_thread_count()
+
+
+def set_thread_affinity(cpus):
+    """!
+    @brief Binds worker threads of the core to specified CPUs, empty list means that threads are not bound.
+
+    @param[in] cpus (list): Indexes of CPUs.
+
+    """
+    package_cpus = package_builder(list(cpus), c_size_t).create()
+
+    ccore = ccore_library.get()
+    ccore.ccore_set_thread_affinity.restype = c_bool
+    if not ccore.ccore_set_thread_affinity(package_cpus):
+        raise ValueError("Some of CPUs '%s' are not supported by the system." % str(cpus))
+
+
+class cancellation_token:
+    """!
+    @brief Token that is used to stop long-running algorithms of the core (agglomerative, ROCK, CURE, HSyncNet).
+
+    @details The token can be cancelled from another thread or by deadline. Cancelled algorithm returns clusters that
+              have been allocated before cancellation.
+
+    """
+    def __init__(self, timeout=None):
+        """!
+        @brief Creates cancellation token.
+
+        @param[in] timeout (double): Time in seconds after that the token is cancelled, None means no deadline.
+
+        """
+        ccore = ccore_library.get()
+
+        ccore.cancellation_token_create.restype = POINTER(c_void_p)
+        self.__pointer = ccore.cancellation_token_create()
+
+        if timeout is not None:
+            self.set_timeout(timeout)
+
+
+    def __del__(self):
+        if self.__pointer:
+            ccore = ccore_library.get()
+            ccore.cancellation_token_destroy(self.__pointer)
+
+
+    def cancel(self):
+        """!
+        @brief Requests cancellation of algorithms that are executed in contexts with the token.
+
+        """
+        ccore = ccore_library.get()
+        ccore.cancellation_token_cancel(self.__pointer)
+
+
+    def set_timeout(self, timeout):
+        """!
+        @brief Sets deadline of the token in seconds from the current time.
+
+        @param[in] timeout (double): Time in seconds, timeout that exceeds range of the clock (for example, infinity)
+                    means no deadline.
+
+        """
+        ccore = ccore_library.get()
+        ccore.cancellation_token_set_timeout.restype = c_bool
+        if not ccore.cancellation_token_set_timeout(self.__pointer, c_double(timeout)):
+            raise ValueError("Timeout of cancellation token should be non-negative, '%s' is specified." % str(timeout))
+
+
+    def is_cancelled(self):
+        """!
+        @brief Returns True if cancellation has been requested or deadline has expired, in this case results of
+                algorithms that have been executed with the token are partial.
+
+        """
+        ccore = ccore_library.get()
+        ccore.cancellation_token_is_cancelled.restype = c_bool
+        return ccore.cancellation_token_is_cancelled(self.__pointer)
+
+
+    def get_pointer(self):
+        """!
+        @brief Returns pointer to the token in the core.
+
+        """
+        return self.__pointer
+
+
+class execution_context:
+    """!
+    @brief Execution context that is used by algorithms of the core that are called inside 'with' statement.
+
+    @details Example of serial execution of K-Means:
+    @code
+        with execution_context(serial=True):
+            kmeans_instance.process()
+    @endcode
+
+    Example of agglomerative algorithm that is stopped after 10 seconds:
+    @code
+        token = cancellation_token(timeout=10.0)
+        with execution_context(token=token):
+            agglomerative_instance.process()
+
+        if token.is_cancelled():
+            print("Clustering result is partial.")
+    @endcode
+
+    Contexts can be nested, previous context is restored when the nested 'with' statement is finished.
+
+    """
+    def __init__(self, thread_count=0, serial=False, token=None):
+        ccore = ccore_library.get()
+
+        ccore.execution_context_create.restype = POINTER(c_void_p)
+        self.__pointer = ccore.execution_context_create(c_size_t(thread_count), c_bool(serial))
+
+        if token is not None:
+            ccore.execution_context_set_cancellation_token(self.__pointer, token.get_pointer())
+
+
+    def __del__(self):
+        if self.__pointer:
+            ccore = ccore_library.get()
+            ccore.execution_context_destroy(self.__pointer)
+
+
+    def __enter__(self):
+        ccore = ccore_library.get()
+        ccore.execution_context_activate(self.__pointer)
+        return self
+
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        ccore = ccore_library.get()
+        ccore.execution_context_deactivate(self.__pointer)
+        return False
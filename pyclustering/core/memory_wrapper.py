@@ -0,0 +1,81 @@
+"""!
+
+@brief CCORE Wrapper for accounting and estimation of memory that is used by algorithms.
+
+@authors Andrei Novikov (pyclustering@yandex.ru)
+@date 2014-2018
+@copyright GNU Public License
+
+@cond GNU_PUBLIC_LICENSE
+    PyClustering is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PyClustering is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+@endcond
+
+"""
+
+
+from pyclustering.core.wrapper import ccore_library
+
+from pyclustering.core.pyclustering_package import package_builder
+
+from ctypes import c_char_p, c_double, c_size_t
+
+
+def get_current_memory():
+    """!
+    @brief Returns amount of bytes that is used by tracked containers of the core at the moment.
+
+    @details Tracked containers are adjacency matrices, datasets, matrices of networks and output dynamics.
+
+    """
+    ccore = ccore_library.get()
+    ccore.memory_get_current.restype = c_size_t
+    return ccore.memory_get_current()
+
+
+def get_peak_memory():
+    """!
+    @brief Returns maximum amount of bytes that has been used by tracked containers of the core.
+
+    """
+    ccore = ccore_library.get()
+    ccore.memory_get_peak.restype = c_size_t
+    return ccore.memory_get_peak()
+
+
+def estimate_memory(algorithm, size, dimension, parameters = None):
+    """!
+    @brief Estimates amount of memory in bytes that is required by an algorithm of the core to process data.
+
+    @details The estimation can be used to reject tasks that do not fit into available memory before they are started.
+              Parameters that affect memory: 'kmeans', 'kmedoids' - [amount of clusters]; 'xmeans' - [maximum amount of
+              clusters]; 'cure' - [amount of clusters, amount of representatives]; 'som' - [rows, columns];
+              'syncnet' - [connection weights (0 or 1), amount of stored steps]; 'hsyncnet' - [amount of clusters,
+              amount of stored steps]; 'sync', 'pcnn', 'legion' - [amount of stored steps]; 'dbscan', 'optics' -
+              [average amount of neighbors in connectivity radius]; 'agglomerative', 'rock' do not have parameters.
+
+    @param[in] algorithm (string): Name of the algorithm, for example, 'rock'.
+    @param[in] size (uint): Amount of points in input data or amount of oscillators in a network.
+    @param[in] dimension (uint): Dimension of input data.
+    @param[in] parameters (list): Parameters of the algorithm that affect required memory.
+
+    @return (uint) Estimated amount of bytes or 0 if the algorithm is not supported.
+
+    """
+    pointer_parameters = None
+    if parameters is not None and len(parameters) > 0:
+        pointer_parameters = package_builder([float(value) for value in parameters], c_double).create()
+
+    ccore = ccore_library.get()
+    ccore.memory_estimate.restype = c_size_t
+    return ccore.memory_estimate(c_char_p(algorithm.encode('utf-8')), pointer_parameters, c_size_t(size), c_size_t(dimension))
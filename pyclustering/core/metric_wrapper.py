@@ -47,6 +47,8 @@ class metric_wrapper:
         ccore.metric_create.restype = POINTER(c_void_p)
 
         self.__pointer = ccore.metric_create(c_size_t(type_metric_code), package_arguments, metric_callback(self.__func))
+        if not self.__pointer:
+            raise ValueError("Impossible to create metric '%d' with specified arguments." % type_metric_code)
 
 
     def __del__(self):
@@ -65,10 +67,63 @@ class metric_wrapper:
         return ccore.metric_calculate(self.__pointer, point_package1, point_package2)
 
 
+    def calculate_batch(self, point, points):
+        """!
+        @brief Calculates distances between the point and each point of the collection by one call.
+
+        @param[in] point (list): Point that is used for calculation.
+        @param[in] points (array_like): Collection of points.
+
+        @return (list) Distance to each point of the collection.
+
+        """
+        point_package = package_builder(point, c_double).create()
+        points_package = package_builder(points, c_double).create()
+
+        ccore = ccore_library.get()
+
+        ccore.metric_calculate_batch.restype = POINTER(pyclustering_package)
+        package = ccore.metric_calculate_batch(self.__pointer, point_package, points_package)
+
+        return metric_wrapper.__extract_result(ccore, package)
+
+
+    def calculate_pairwise(self, block1, block2):
+        """!
+        @brief Calculates distances between each point of the first block and each point of the second block by one call.
+
+        @param[in] block1 (array_like): The first collection of points.
+        @param[in] block2 (array_like): The second collection of points.
+
+        @return (list) Distance matrix where element [i][j] is distance between block1[i] and block2[j].
+
+        """
+        package1 = package_builder(block1, c_double).create()
+        package2 = package_builder(block2, c_double).create()
+
+        ccore = ccore_library.get()
+
+        ccore.metric_calculate_pairwise.restype = POINTER(pyclustering_package)
+        package = ccore.metric_calculate_pairwise(self.__pointer, package1, package2)
+
+        return metric_wrapper.__extract_result(ccore, package)
+
+
     def get_pointer(self):
         return self.__pointer
 
 
+    @staticmethod
+    def __extract_result(ccore, package):
+        if not package:
+            raise ValueError("Dimension of points should be the same.")
+
+        result = package_extractor(package).extract()
+        ccore.free_pyclustering_package(package)
+
+        return result
+
+
     @staticmethod
     def create_instance(metric):
         mtype = metric.get_type()
@@ -77,4 +132,13 @@ class metric_wrapper:
         if mtype == type_metric.MINKOWSKI:
             arguments = [ metric.get_arguments().get('degree') ]
 
+        elif mtype == type_metric.WEIGHTED_EUCLIDEAN:
+            arguments = list(metric.get_arguments().get('weights'))
+
+        elif mtype == type_metric.GOWER:
+            arguments = list(metric.get_arguments().get('max_range'))
+
+        elif mtype == type_metric.MAHALANOBIS:
+            arguments = [ value for row in metric.get_arguments().get('inverse_covariance') for value in row ]
+
         return metric_wrapper(mtype, arguments, metric.get_function())
\ No newline at end of file
@@ -41,12 +41,21 @@ class pyclustering_package(Structure):
                 std::size_t      size;
                 unsigned int     type;
                 void *           data;
+                std::size_t      columns;
+                std::size_t      stride;
+                unsigned int     element_type;
             }
+    
+            Fields 'columns', 'stride' and 'element_type' are used only by packages with type 'PYCLUSTERING_TYPE_MATRIX'
+            where two-dimensional data is stored in one contiguous row-major buffer.
     """
     
     _fields_ = [ ("size", c_size_t),
                  ("type", c_uint),
-                 ("data", POINTER(c_void_p)) ]
+                 ("data", POINTER(c_void_p)),
+                 ("columns", c_size_t),
+                 ("stride", c_size_t),
+                 ("element_type", c_uint) ]
 
 
 
@@ -65,6 +74,7 @@ class pyclustering_type_data:
     PYCLUSTERING_TYPE_LIST              = 0x06
     PYCLUSTERING_TYPE_SIZE_T            = 0x07
     PYCLUSTERING_TYPE_UNDEFINED         = 0x08
+    PYCLUSTERING_TYPE_MATRIX            = 0x09
 
     __CTYPE_PYCLUSTERING_MAP = { 
         c_int                           : PYCLUSTERING_TYPE_INT,
@@ -131,6 +141,9 @@ class package_builder:
         @return (pointer) ctype-pointer to pyclustering package.
         
         """
+        if self.__is_matrix(self.__dataset):
+            return self.__create_package_matrix(self.__dataset)
+        
         return self.__create_package(self.__dataset)
 
 
@@ -138,6 +151,59 @@ class package_builder:
         return isinstance(value, collections.Iterable)
 
 
+    def __is_matrix(self, dataset):
+        if self.__c_data_type is None:
+            return False
+        
+        if isinstance(dataset, numpy.ndarray):
+            return len(dataset.shape) == 2
+        
+        if not isinstance(dataset, list) or len(dataset) == 0 or not self.__is_container_type(dataset[0]):
+            return False
+        
+        columns = len(dataset[0])
+        for row in dataset:
+            if not self.__is_container_type(row) or len(row) != columns:
+                return False
+            
+            for value in row:
+                if self.__is_container_type(value):
+                    return False
+        
+        return True
+
+
+    def __create_package_matrix(self, dataset):
+        dataset_package = pyclustering_package()
+        
+        if isinstance(dataset, numpy.ndarray):
+            (rows, cols) = dataset.shape
+        else:
+            (rows, cols) = (len(dataset), len(dataset[0]))
+        
+        dataset_package.size = rows
+        dataset_package.type = pyclustering_type_data.PYCLUSTERING_TYPE_MATRIX
+        dataset_package.columns = cols
+        dataset_package.stride = cols
+        dataset_package.element_type = pyclustering_type_data.get_pyclustering_type(self.__c_data_type)
+        
+        if isinstance(dataset, numpy.ndarray) and (self.__c_data_type is c_double) and \
+           (dataset.dtype == numpy.float64) and dataset.flags['C_CONTIGUOUS']:
+            # buffer of the array is used by the core without copying, the array should live while the package is used
+            dataset_package.data = dataset.ctypes.data_as(POINTER(c_void_p))
+            return pointer(dataset_package)
+        
+        array_object = (self.__c_data_type * (rows * cols))()
+        index = 0
+        for row_index in range(rows):
+            for col_index in range(cols):
+                array_object[index] = dataset[row_index, col_index] if isinstance(dataset, numpy.ndarray) else dataset[row_index][col_index]
+                index += 1
+        
+        dataset_package.data = cast(array_object, POINTER(c_void_p))
+        return pointer(dataset_package)
+
+
     def __get_type(self, pyclustering_data_type):
         if self.__c_data_type is None:
             return pyclustering_data_type
@@ -280,11 +346,26 @@ class package_extractor:
         return result
 
 
+    def __unpack_matrix_data(self, pointer_package):
+        package = pointer_package[0]
+        pointer_data = cast(package.data, POINTER(pyclustering_type_data.get_ctype(package.element_type)))
+        
+        result = []
+        for index_row in range(package.size):
+            begin = index_row * package.stride
+            result.append(pointer_data[begin:begin + package.columns])
+        
+        return result
+
+
     def __unpack_pointer_data(self, pointer_package):
         type_package = pointer_package[0].type
         
         if pointer_package[0].size == 0:
             return []
         
+        if type_package == pyclustering_type_data.PYCLUSTERING_TYPE_MATRIX:
+            return self.__unpack_matrix_data(pointer_package)
+        
         pointer_data = cast(pointer_package[0].data, POINTER(pyclustering_type_data.get_ctype(type_package)))
         return self.__unpack_data(pointer_package, pointer_data, type_package)
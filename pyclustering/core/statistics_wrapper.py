@@ -0,0 +1,81 @@
+"""!
+
+@brief CCORE Wrapper for performance statistics (counters and execution time of phases) of algorithms.
+
+@authors Andrei Novikov (pyclustering@yandex.ru)
+@date 2014-2018
+@copyright GNU Public License
+
+@cond GNU_PUBLIC_LICENSE
+    PyClustering is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PyClustering is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+@endcond
+
+"""
+
+
+from pyclustering.core.wrapper import ccore_library
+
+from pyclustering.core.pyclustering_package import pyclustering_package, package_extractor
+
+from ctypes import c_bool, POINTER
+
+
+## Names of counters in order of the core.
+STATISTICS_COUNTERS = ["iterations", "distance_calculations", "neighbor_queries", "kdtree_nodes_visited", "simulation_steps"]
+
+## Names of phases in order of the core.
+STATISTICS_PHASES = ["process", "update_clusters", "update_centers", "neighbor_search", "simulation"]
+
+
+def enable_statistics(enabled):
+    """!
+    @brief Enables or disables collection of performance statistics by all following calls of algorithms of the core.
+
+    @param[in] enabled (bool): If True then algorithms collect counters and execution time of their phases.
+
+    """
+    ccore = ccore_library.get()
+    ccore.statistics_enable(c_bool(enabled))
+
+
+def is_statistics_enabled():
+    """!
+    @brief Returns True if algorithms of the core collect performance statistics.
+
+    """
+    ccore = ccore_library.get()
+    ccore.statistics_is_enabled.restype = c_bool
+    return ccore.statistics_is_enabled()
+
+
+def get_last_statistics():
+    """!
+    @brief Returns performance statistics of the last call of an algorithm of the core from the current thread.
+
+    @return (dict) Dictionary with keys 'counters', 'phases' and 'memory', counters are values, phases are execution
+             time in seconds, memory is peak and current amount of bytes of tracked containers, for example,
+             {'counters': {'iterations': 5, ...}, 'phases': {'process': 0.01, ...}, 'memory': {'peak': 4096, 'current': 0}}.
+
+    """
+    ccore = ccore_library.get()
+    ccore.statistics_get_last.restype = POINTER(pyclustering_package)
+    package = ccore.statistics_get_last()
+
+    result = package_extractor(package).extract()
+    ccore.free_pyclustering_package(package)
+
+    counters, phases, memory = result[0], result[1], result[2]
+    return { 'counters': dict(zip(STATISTICS_COUNTERS, counters)),
+             'phases': dict(zip(STATISTICS_PHASES, phases)),
+             'memory': { 'peak': memory[0], 'current': memory[1] } }
@@ -0,0 +1,97 @@
+"""!
+
+@brief Unit-tests for execution context of ccore library.
+
+@authors Andrei Novikov (pyclustering@yandex.ru)
+@date 2014-2018
+@copyright GNU Public License
+
+@cond GNU_PUBLIC_LICENSE
+    PyClustering is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    
+    PyClustering is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+    
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+@endcond
+
+"""
+
+
+import unittest
+
+from pyclustering.cluster.agglomerative import agglomerative
+
+from pyclustering.core.execution_context_wrapper import execution_context, cancellation_token
+
+from pyclustering.samples.definitions import SIMPLE_SAMPLES
+
+from pyclustering.utils import read_sample
+
+
+class Test(unittest.TestCase):
+    def setUp(self):
+        self.sample = read_sample(SIMPLE_SAMPLES.SAMPLE_SIMPLE1)
+
+
+    def amount_clusters(self):
+        agglomerative_instance = agglomerative(self.sample, 2, ccore=True)
+        agglomerative_instance.process()
+        return len(agglomerative_instance.get_clusters())
+
+
+    def testCancelledContext(self):
+        token = cancellation_token()
+        token.cancel()
+
+        with execution_context(token=token):
+            self.assertGreater(self.amount_clusters(), 2)
+
+        self.assertEqual(2, self.amount_clusters())
+
+
+    def testNestedContextRestoresOuter(self):
+        token = cancellation_token()
+        token.cancel()
+
+        with execution_context(token=token):
+            with execution_context(serial=True):
+                self.assertEqual(2, self.amount_clusters())
+
+            self.assertGreater(self.amount_clusters(), 2)
+
+        self.assertEqual(2, self.amount_clusters())
+
+
+    def testHugeTimeout(self):
+        for timeout in [1e20, float('inf')]:
+            token = cancellation_token(timeout=timeout)
+            self.assertFalse(token.is_cancelled())
+
+
+    def testWrongTimeout(self):
+        token = cancellation_token()
+
+        self.assertRaises(ValueError, token.set_timeout, -1.0)
+        self.assertRaises(ValueError, token.set_timeout, float('nan'))
+        self.assertFalse(token.is_cancelled())
+
+
+    def testNestedSameContext(self):
+        token = cancellation_token()
+        token.cancel()
+
+        context = execution_context(token=token)
+        with context:
+            with context:
+                self.assertGreater(self.amount_clusters(), 2)
+
+            self.assertGreater(self.amount_clusters(), 2)
+
+        self.assertEqual(2, self.amount_clusters())
@@ -0,0 +1,55 @@
+"""!
+
+@brief CCORE Wrapper for tracing of algorithms to Chrome trace-event timeline.
+
+@authors Andrei Novikov (pyclustering@yandex.ru)
+@date 2014-2018
+@copyright GNU Public License
+
+@cond GNU_PUBLIC_LICENSE
+    PyClustering is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    PyClustering is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+@endcond
+
+"""
+
+
+from pyclustering.core.wrapper import ccore_library
+
+from ctypes import c_bool, c_char_p
+
+
+def start_trace(path):
+    """!
+    @brief Starts recording of events of algorithms of the core: phases, parallel chunks, tasks and ODE integration.
+
+    @details The trace can be opened by 'chrome://tracing' or Perfetto UI. Tracing can be also enabled by environment
+              variable 'CCORE_TRACE_FILE' before the core is loaded.
+
+    @param[in] path (string): Path to the file where events are written by 'stop_trace'.
+
+    """
+    ccore = ccore_library.get()
+    ccore.trace_start(c_char_p(path.encode('utf-8')))
+
+
+def stop_trace():
+    """!
+    @brief Stops recording and writes events to the file that has been specified by 'start_trace'.
+
+    @return (bool) False if tracing has not been started or the file cannot be written.
+
+    """
+    ccore = ccore_library.get()
+    ccore.trace_stop.restype = c_bool
+    return ccore.trace_stop()
@@ -50,6 +50,21 @@ class type_metric(IntEnum):
     ## Minkowski distance, for more information see function 'minkowski_distance'.
     MINKOWSKI = 4
 
+    ## Cosine distance, for more information see function 'cosine_distance'.
+    COSINE = 5
+
+    ## Mahalanobis distance, for more information see function 'mahalanobis_distance'.
+    MAHALANOBIS = 6
+
+    ## Weighted Euclidean distance, for more information see function 'weighted_euclidean_distance'.
+    WEIGHTED_EUCLIDEAN = 7
+
+    ## Canberra distance, for more information see function 'canberra_distance'.
+    CANBERRA = 8
+
+    ## Gower distance for numerical data, for more information see function 'gower_distance'.
+    GOWER = 9
+
     ## User defined function for distance calculation between two points.
     USER_DEFINED = 1000
 
@@ -81,6 +96,12 @@ class distance_metric:
         distance = metric([4.0, 9.2, 1.0], [3.4, 2.5, 6.2])
     @endcode
 
+    Metrics with parameters like weighted Euclidean, Gower or Mahalanobis distance require corresponding argument:
+    @code
+        metric = distance_metric(type_metric.MAHALANOBIS, inverse_covariance=[[2.0, 0.5], [0.5, 1.0]])
+        distance = metric([1.0, 2.5], [-1.2, 3.4])
+    @endcode
+
     User may define its own function for distance calculation:
     @code
         user_function = lambda point1, point2: point1[0] + point2[0] + 2
@@ -101,6 +122,10 @@ class distance_metric:
             - func (callable): Callable object with two arguments (point #1 and point #2) or (object #1 and object #2) in case of numpy usage.
                                 This argument is used only if metric is 'type_metric.USER_DEFINED'.
             - degree (numeric): Only for 'type_metric.MINKOWSKI' - degree of Minkowski equation.
+            - weights (array_like): Only for 'type_metric.WEIGHTED_EUCLIDEAN' - weight of each coordinate.
+            - max_range (array_like): Only for 'type_metric.GOWER' - range (maximum minus minimum) of each feature.
+            - inverse_covariance (array_like): Only for 'type_metric.MAHALANOBIS' - inverse covariance matrix
+               that should be symmetric positive-definite.
             - numpy_usage (bool): If True then numpy is used for calculation (by default is False).
 
         """
@@ -212,6 +237,21 @@ class distance_metric:
         elif self.__type == type_metric.MINKOWSKI:
             return lambda point1, point2: minkowski_distance(point1, point2, self.__args.get('degree', 2))
 
+        elif self.__type == type_metric.COSINE:
+            return cosine_distance
+
+        elif self.__type == type_metric.CANBERRA:
+            return canberra_distance
+
+        elif self.__type == type_metric.WEIGHTED_EUCLIDEAN:
+            return lambda point1, point2: weighted_euclidean_distance(point1, point2, self.__args['weights'])
+
+        elif self.__type == type_metric.GOWER:
+            return lambda point1, point2: gower_distance(point1, point2, self.__args['max_range'])
+
+        elif self.__type == type_metric.MAHALANOBIS:
+            return lambda point1, point2: mahalanobis_distance(point1, point2, self.__args['inverse_covariance'])
+
         elif self.__type == type_metric.USER_DEFINED:
             return self.__func
 
@@ -241,6 +281,21 @@ class distance_metric:
         elif self.__type == type_metric.MINKOWSKI:
             return lambda object1, object2: minkowski_distance_numpy(object1, object2, self.__args.get('degree', 2))
 
+        elif self.__type == type_metric.COSINE:
+            return cosine_distance_numpy
+
+        elif self.__type == type_metric.CANBERRA:
+            return canberra_distance_numpy
+
+        elif self.__type == type_metric.WEIGHTED_EUCLIDEAN:
+            return lambda object1, object2: weighted_euclidean_distance_numpy(object1, object2, self.__args['weights'])
+
+        elif self.__type == type_metric.GOWER:
+            return lambda object1, object2: gower_distance_numpy(object1, object2, self.__args['max_range'])
+
+        elif self.__type == type_metric.MAHALANOBIS:
+            return lambda object1, object2: mahalanobis_distance_numpy(object1, object2, self.__args['inverse_covariance'])
+
         elif self.__type == type_metric.USER_DEFINED:
             return self.__func
 
@@ -402,7 +457,7 @@ def minkowski_distance(point1, point2, degree=2):
     @brief Calculate Minkowski distance between two vectors.
 
     \f[
-    dist(a, b) = \sqrt[p]{ \sum_{i=0}^{N}\left(a_{i} - b_{i}\right)^{p} };
+    dist(a, b) = \sqrt[p]{ \sum_{i=0}^{N}\left | a_{i} - b_{i} \right |^{p} };
     \f]
 
     @param[in] point1 (array_like): The first vector.
@@ -416,7 +471,7 @@ def minkowski_distance(point1, point2, degree=2):
     """
     distance = 0.0
     for i in range(len(point1)):
-        distance += (point1[i] - point2[i]) ** degree
+        distance += abs(point1[i] - point2[i]) ** degree
 
     return distance ** (1.0 / degree)
 
@@ -432,4 +487,211 @@ def minkowski_distance_numpy(object1, object2, degree=2):
     @return (double) Minkowski distance between two object.
 
     """
-    return numpy.sum(numpy.power(numpy.power(object1 - object2, degree), 1/degree), axis=1).T
\ No newline at end of file
+    return numpy.power(numpy.sum(numpy.power(numpy.absolute(object1 - object2), degree), axis=1), 1.0 / degree).T
+
+
+def cosine_distance(point1, point2):
+    """!
+    @brief Calculate cosine distance between two vectors.
+
+    \f[
+    dist(a, b) = 1 - \frac{ \sum_{i=0}^{N}a_{i}b_{i} }{ \sqrt{ \sum_{i=0}^{N}a_{i}^{2} } \sqrt{ \sum_{i=0}^{N}b_{i}^{2} } };
+    \f]
+
+    If one of vectors is zero vector then distance is 1.0, if both of them are zero vectors then distance is 0.0.
+
+    @param[in] point1 (array_like): The first vector.
+    @param[in] point2 (array_like): The second vector.
+
+    @return (double) Cosine distance between two vectors.
+
+    """
+    product, norm1, norm2 = 0.0, 0.0, 0.0
+    for i in range(len(point1)):
+        product += point1[i] * point2[i]
+        norm1 += point1[i] * point1[i]
+        norm2 += point2[i] * point2[i]
+
+    if norm1 == 0.0 or norm2 == 0.0:
+        return 0.0 if norm1 == norm2 else 1.0
+
+    return 1.0 - product / (norm1 * norm2) ** 0.5
+
+
+def cosine_distance_numpy(object1, object2):
+    """!
+    @brief Calculate cosine distance between two objects using numpy.
+
+    @param[in] object1 (array_like): The first array_like object.
+    @param[in] object2 (array_like): The second array_like object.
+
+    @return (double) Cosine distance between two objects.
+
+    """
+    product = numpy.sum(object1 * object2, axis=1)
+    norms = numpy.sqrt(numpy.sum(numpy.square(object1), axis=1) * numpy.sum(numpy.square(object2), axis=1))
+    return (1.0 - product / norms).T
+
+
+def canberra_distance(point1, point2):
+    """!
+    @brief Calculate Canberra distance between two vectors.
+
+    \f[
+    dist(a, b) = \sum_{i=0}^{N}\frac{\left | a_{i} - b_{i} \right |}{\left | a_{i} \right | + \left | b_{i} \right |};
+    \f]
+
+    Coordinates where both vectors are zero do not contribute to the distance.
+
+    @param[in] point1 (array_like): The first vector.
+    @param[in] point2 (array_like): The second vector.
+
+    @return (double) Canberra distance between two vectors.
+
+    """
+    distance = 0.0
+    for i in range(len(point1)):
+        divider = abs(point1[i]) + abs(point2[i])
+        if divider > 0.0:
+            distance += abs(point1[i] - point2[i]) / divider
+
+    return distance
+
+
+def canberra_distance_numpy(object1, object2):
+    """!
+    @brief Calculate Canberra distance between two objects using numpy.
+
+    @param[in] object1 (array_like): The first array_like object.
+    @param[in] object2 (array_like): The second array_like object.
+
+    @return (double) Canberra distance between two objects.
+
+    """
+    divider = numpy.absolute(object1) + numpy.absolute(object2)
+    difference = numpy.absolute(object1 - object2)
+    return numpy.sum(numpy.divide(difference, divider, out=numpy.zeros_like(difference, dtype=float), where=divider > 0), axis=1).T
+
+
+def weighted_euclidean_distance(point1, point2, weights):
+    """!
+    @brief Calculate weighted Euclidean distance between two vectors.
+
+    \f[
+    dist(a, b) = \sqrt{ \sum_{i=0}^{N}w_{i}(a_{i} - b_{i})^{2} };
+    \f]
+
+    @param[in] point1 (array_like): The first vector.
+    @param[in] point2 (array_like): The second vector.
+    @param[in] weights (array_like): Weight of each coordinate.
+
+    @return (double) Weighted Euclidean distance between two vectors.
+
+    """
+    distance = 0.0
+    for i in range(len(point1)):
+        distance += weights[i] * (point1[i] - point2[i]) ** 2.0
+
+    return distance ** 0.5
+
+
+def weighted_euclidean_distance_numpy(object1, object2, weights):
+    """!
+    @brief Calculate weighted Euclidean distance between two objects using numpy.
+
+    @param[in] object1 (array_like): The first array_like object.
+    @param[in] object2 (array_like): The second array_like object.
+    @param[in] weights (array_like): Weight of each coordinate.
+
+    @return (double) Weighted Euclidean distance between two objects.
+
+    """
+    return numpy.sqrt(numpy.sum(numpy.asarray(weights) * numpy.square(object1 - object2), axis=1)).T
+
+
+def gower_distance(point1, point2, max_range):
+    """!
+    @brief Calculate Gower distance between two vectors with numerical coordinates.
+
+    \f[
+    dist(a, b) = \frac{1}{N} \sum_{i=0}^{N}\frac{\left | a_{i} - b_{i} \right |}{R_{i}};
+    \f]
+
+    Where R is a range (maximum minus minimum) of each feature, features with zero range do not contribute to
+     the distance.
+
+    @param[in] point1 (array_like): The first vector.
+    @param[in] point2 (array_like): The second vector.
+    @param[in] max_range (array_like): Range of each feature.
+
+    @return (double) Gower distance between two vectors.
+
+    """
+    distance = 0.0
+    dimension = len(point1)
+
+    for i in range(dimension):
+        if max_range[i] > 0.0:
+            distance += abs(point1[i] - point2[i]) / max_range[i]
+
+    return distance / dimension if dimension > 0 else 0.0
+
+
+def gower_distance_numpy(object1, object2, max_range):
+    """!
+    @brief Calculate Gower distance between two objects using numpy.
+
+    @param[in] object1 (array_like): The first array_like object.
+    @param[in] object2 (array_like): The second array_like object.
+    @param[in] max_range (array_like): Range of each feature.
+
+    @return (double) Gower distance between two objects.
+
+    """
+    max_range = numpy.asarray(max_range, dtype=float)
+    difference = numpy.absolute(object1 - object2)
+    normalized = numpy.divide(difference, max_range, out=numpy.zeros_like(difference, dtype=float), where=max_range > 0)
+    return numpy.mean(normalized, axis=1).T
+
+
+def mahalanobis_distance(point1, point2, inverse_covariance):
+    """!
+    @brief Calculate Mahalanobis distance between two vectors.
+
+    \f[
+    dist(a, b) = \sqrt{ (a - b)^{T} S^{-1} (a - b) };
+    \f]
+
+    Where S is a covariance matrix.
+
+    @param[in] point1 (array_like): The first vector.
+    @param[in] point2 (array_like): The second vector.
+    @param[in] inverse_covariance (array_like): Inverse covariance matrix.
+
+    @return (double) Mahalanobis distance between two vectors.
+
+    """
+    dimension = len(point1)
+    difference = [point1[i] - point2[i] for i in range(dimension)]
+
+    distance = 0.0
+    for i in range(dimension):
+        for j in range(dimension):
+            distance += difference[i] * inverse_covariance[i][j] * difference[j]
+
+    return distance ** 0.5
+
+
+def mahalanobis_distance_numpy(object1, object2, inverse_covariance):
+    """!
+    @brief Calculate Mahalanobis distance between two objects using numpy.
+
+    @param[in] object1 (array_like): The first array_like object.
+    @param[in] object2 (array_like): The second array_like object.
+    @param[in] inverse_covariance (array_like): Inverse covariance matrix.
+
+    @return (double) Mahalanobis distance between two objects.
+
+    """
+    difference = numpy.atleast_2d(object1 - object2)
+    return numpy.sqrt(numpy.sum(numpy.dot(difference, numpy.asarray(inverse_covariance)) * difference, axis=1)).T
\ No newline at end of file
@@ -63,6 +63,41 @@ class MetricUnitTest(unittest.TestCase):
         assertion.eq(2.0, metric_instance([0.0, 0.0], [2.0, 0.0]));
 
 
+    def testBatchManhattanMetric(self):
+        metric_instance = metric_wrapper(type_metric.MANHATTAN, [], None);
+        assertion.eq([1.0, 2.0, 3.0], metric_instance.calculate_batch([1.0, 2.0], [[1.0, 1.0], [2.0, 1.0], [-1.0, 3.0]]));
+
+
+    def testPairwiseEuclideanSquareMetric(self):
+        metric_instance = metric_wrapper(type_metric.EUCLIDEAN_SQUARE, [], None);
+        distances = metric_instance.calculate_pairwise([[0.0, 0.0], [1.0, 1.0], [2.0, 0.0]], [[0.0, 0.0], [0.0, 2.0]]);
+        assertion.eq([[0.0, 4.0], [2.0, 2.0], [4.0, 8.0]], distances);
+
+
+    def testBatchWrongDimension(self):
+        metric_instance = metric_wrapper(type_metric.EUCLIDEAN, [], None);
+        self.assertRaises(ValueError, metric_instance.calculate_batch, [1.0, 2.0, 3.0], [[1.0, 1.0]]);
+
+
+    def testCosineMetric(self):
+        metric_instance = metric_wrapper(type_metric.COSINE, [], None);
+        assertion.eq(1.0, metric_instance([1.0, 0.0], [0.0, 3.0]));
+
+
+    def testWeightedEuclideanMetric(self):
+        metric_instance = metric_wrapper(type_metric.WEIGHTED_EUCLIDEAN, [4.0, 0.0], None);
+        assertion.eq(2.0, metric_instance([0.0, 0.0], [1.0, 10.0]));
+
+
+    def testMahalanobisMetric(self):
+        metric_instance = metric_wrapper(type_metric.MAHALANOBIS, [4.0, 0.0, 0.0, 1.0], None);
+        assertion.eq(5.0, metric_instance([0.0, 0.0], [2.0, 3.0]));
+
+
+    def testMahalanobisIncorrectMatrix(self):
+        self.assertRaises(ValueError, metric_wrapper, type_metric.MAHALANOBIS, [1.0, 2.0, 2.0, 1.0], None);
+
+
     # TODO: doesn't work for some platforms.
     #def testUserDefinedMetric(self):
     #    user_metric = lambda p1, p2 : p1[0] + p2[0];
@@ -83,10 +83,38 @@ class MetricUnitTest(unittest.TestCase):
     def testMinkowskiDistance(self):
         assertion.eq(0.0, metric.minkowski_distance([0], [0]));
         assertion.eq(0.0, metric.minkowski_distance([0], [0], 2));
-        assertion.eq(-2.0, metric.minkowski_distance([3.0, 3.0], [5.0, 3.0], 1));
+        assertion.eq(2.0, metric.minkowski_distance([3.0, 3.0], [5.0, 3.0], 1));
         assertion.eq(2.0, metric.minkowski_distance([3.0, 3.0], [5.0, 3.0], 2));
+        assertion.eq(2.0, metric.minkowski_distance([3.0, 3.0], [5.0, 3.0], 3));
         assertion.eq(2.0, metric.minkowski_distance([3.0, 3.0], [5.0, 3.0], 4));
 
 
+    def testCosineDistance(self):
+        assertion.eq(0.0, metric.cosine_distance([0.0, 0.0], [0.0, 0.0]));
+        assertion.eq(1.0, metric.cosine_distance([0.0, 0.0], [1.0, 0.0]));
+        assertion.eq(1.0, metric.cosine_distance([1.0, 0.0], [0.0, 3.0]));
+        assertion.eq(2.0, metric.cosine_distance([1.0, 0.0], [-1.0, 0.0]));
+
+
+    def testCanberraDistance(self):
+        assertion.eq(0.0, metric.canberra_distance([0.0, 0.0], [0.0, 0.0]));
+        assertion.eq(1.0, metric.canberra_distance([1.0, 0.0, 0.0], [-1.0, 0.0, 0.0]));
+
+
+    def testWeightedEuclideanDistance(self):
+        assertion.eq(2.0, metric.weighted_euclidean_distance([0.0, 0.0], [1.0, 10.0], [4.0, 0.0]));
+        assertion.eq(2.0, metric.distance_metric(metric.type_metric.WEIGHTED_EUCLIDEAN, weights=[4.0, 0.0])([0.0, 0.0], [1.0, 10.0]));
+
+
+    def testGowerDistance(self):
+        assertion.eq(1.5, metric.gower_distance([0.0, 5.0, 1.0], [1.0, 3.0, 5.0], [2.0, 0.0, 1.0]));
+        assertion.eq(1.0, metric.distance_metric(metric.type_metric.GOWER, max_range=[2.0, 4.0])([0.0, 0.0], [2.0, 4.0]));
+
+
+    def testMahalanobisDistance(self):
+        assertion.eq(5.0, metric.mahalanobis_distance([0.0, 0.0], [2.0, 3.0], [[4.0, 0.0], [0.0, 1.0]]));
+        assertion.eq(5.0, metric.distance_metric(metric.type_metric.MAHALANOBIS, inverse_covariance=[[4.0, 0.0], [0.0, 1.0]])([0.0, 0.0], [2.0, 3.0]));
+
+
 if __name__ == "__main__":
     unittest.main();
\ No newline at end of file